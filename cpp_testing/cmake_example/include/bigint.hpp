@@ -0,0 +1,104 @@
+#ifndef BIGINT_HPP
+#define BIGINT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Arbitrary-precision unsigned integer for the Calculator library
+ *
+ * Calculator::factorial returns a double: exact only up to 22! and inf
+ * past 170!. BigUnsigned is exact at any size:
+ *
+ *   multiply    schoolbook below 48 limbs, Karatsuba above; the top
+ *               levels of the Karatsuba recursion run on several threads
+ *   factorial   prime-swing: n! = ((n/2)!)^2 * swing(n), the prime powers
+ *               of each swing multiplied in a balanced product tree
+ *   toString    divide-and-conquer by 10^(19 * 2^i), each division done
+ *               with a precomputed reciprocal (Barrett), halves in parallel
+ *
+ * Limbs are 64-bit, least significant first, with no leading zero limbs.
+ */
+class BigUnsigned {
+private:
+    std::vector<std::uint64_t> limbs;
+
+    void trim();
+
+public:
+    BigUnsigned() = default;
+    BigUnsigned(std::uint64_t value);
+    explicit BigUnsigned(std::vector<std::uint64_t> littleEndianLimbs);
+
+    /**
+     * Parses decimal digits; throws std::invalid_argument on anything else
+     */
+    static BigUnsigned fromString(const std::string& digits);
+
+    /**
+     * Decimal representation; threads == 0 uses one thread per core
+     */
+    std::string toString(unsigned threads = 1) const;
+
+    const std::vector<std::uint64_t>& data() const { return limbs; }
+    std::size_t limbCount() const { return limbs.size(); }
+    std::size_t bitLength() const;
+    bool isZero() const { return limbs.empty(); }
+
+    // -1, 0 or 1
+    static int compare(const BigUnsigned& a, const BigUnsigned& b);
+
+    /**
+     * a * b; threads == 0 uses one thread per core
+     */
+    static BigUnsigned multiply(const BigUnsigned& a, const BigUnsigned& b, unsigned threads = 1);
+
+    /**
+     * Quotient and remainder; throws std::runtime_error on division by zero
+     */
+    static void divmod(const BigUnsigned& a, const BigUnsigned& b, BigUnsigned& quotient, BigUnsigned& remainder);
+
+    BigUnsigned& operator+=(const BigUnsigned& other);
+    BigUnsigned& operator-=(const BigUnsigned& other);  // Throws std::underflow_error below zero
+    BigUnsigned& operator*=(const BigUnsigned& other);
+    BigUnsigned& operator<<=(std::size_t bits);
+    BigUnsigned& operator>>=(std::size_t bits);
+
+    // In-place multiply by a single limb; the fast step of a sequential product
+    BigUnsigned& multiplySmall(std::uint64_t factor);
+
+    friend BigUnsigned operator+(BigUnsigned a, const BigUnsigned& b) { return a += b; }
+    friend BigUnsigned operator-(BigUnsigned a, const BigUnsigned& b) { return a -= b; }
+    friend BigUnsigned operator*(const BigUnsigned& a, const BigUnsigned& b) { return multiply(a, b); }
+    friend BigUnsigned operator<<(BigUnsigned a, std::size_t bits) { return a <<= bits; }
+    friend BigUnsigned operator>>(BigUnsigned a, std::size_t bits) { return a >>= bits; }
+    friend BigUnsigned operator/(const BigUnsigned& a, const BigUnsigned& b);
+    friend BigUnsigned operator%(const BigUnsigned& a, const BigUnsigned& b);
+
+    friend bool operator==(const BigUnsigned& a, const BigUnsigned& b) { return a.limbs == b.limbs; }
+    friend bool operator!=(const BigUnsigned& a, const BigUnsigned& b) { return a.limbs != b.limbs; }
+    friend bool operator<(const BigUnsigned& a, const BigUnsigned& b) { return compare(a, b) < 0; }
+    friend bool operator>(const BigUnsigned& a, const BigUnsigned& b) { return compare(a, b) > 0; }
+    friend bool operator<=(const BigUnsigned& a, const BigUnsigned& b) { return compare(a, b) <= 0; }
+    friend bool operator>=(const BigUnsigned& a, const BigUnsigned& b) { return compare(a, b) >= 0; }
+};
+
+/**
+ * Exact combinatorics; threads == 0 uses one thread per core
+ */
+namespace Combinatorics {
+
+// n! by the prime-swing algorithm
+BigUnsigned factorial(std::uint32_t n, unsigned threads = 0);
+
+// n choose k from its prime factorisation (Legendre); 0 when k > n
+BigUnsigned binomial(std::uint32_t n, std::uint32_t k, unsigned threads = 0);
+
+// Product of the given factors as a balanced tree
+BigUnsigned product(const std::vector<std::uint64_t>& factors, unsigned threads = 0);
+
+} // namespace Combinatorics
+
+#endif // BIGINT_HPP
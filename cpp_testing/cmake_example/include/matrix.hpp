@@ -0,0 +1,297 @@
+#ifndef MATRIX_HPP
+#define MATRIX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * Dense matrix module for the Calculator library
+ *
+ * Matrix<T> stores its elements row-major in one 64-byte aligned block.
+ * For Matrix<double> the heavy operations run on the kernels compiled in
+ * matrix.cpp:
+ *
+ *   multiply   cache-blocked GEMM: packed panels of A and B, a 6x8
+ *              register-tiled micro-kernel (AVX2/FMA when the CPU has it)
+ *              and the outer loop split across threads
+ *   GEMV       matrix-vector product, four rows at a time
+ *   transpose  tiled, so reads and writes both stay in cache
+ *   LU         blocked partial-pivoting LU; the trailing update is a GEMM
+ *
+ * Other element types use the plain loops defined in this header.
+ */
+
+/**
+ * Allocator returning memory aligned to Alignment bytes
+ */
+template<typename T, std::size_t Alignment = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template<typename U>
+    struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    AlignedAllocator() = default;
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* p, std::size_t) {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+};
+
+/**
+ * Raw kernels on row-major arrays; lda/ldb/ldc are row strides in elements
+ */
+namespace MatrixKernels {
+
+// C (m x n) += alpha * A (m x k) * B (k x n). threads == 0 means one per core.
+void gemm(std::size_t m, std::size_t n, std::size_t k, double alpha,
+          const double* a, std::size_t lda, const double* b, std::size_t ldb,
+          double* c, std::size_t ldc, unsigned threads = 0);
+
+// y (m) = A (m x n) * x (n)
+void gemv(std::size_t m, std::size_t n, const double* a, std::size_t lda, const double* x, double* y);
+
+// out (cols x rows) = transpose of in (rows x cols)
+void transpose(std::size_t rows, std::size_t cols, const double* in, std::size_t ldin,
+               double* out, std::size_t ldout);
+
+// Instruction set the double kernels picked at startup
+const char* simdLevel();
+
+template<typename T>
+void gemm(std::size_t m, std::size_t n, std::size_t k, T alpha,
+          const T* a, std::size_t lda, const T* b, std::size_t ldb,
+          T* c, std::size_t ldc, unsigned = 0) {
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t p = 0; p < k; ++p) {
+            T scaled = alpha * a[i * lda + p];
+            for (std::size_t j = 0; j < n; ++j) c[i * ldc + j] += scaled * b[p * ldb + j];
+        }
+    }
+}
+
+template<typename T>
+void gemv(std::size_t m, std::size_t n, const T* a, std::size_t lda, const T* x, T* y) {
+    for (std::size_t i = 0; i < m; ++i) {
+        T sum = T();
+        for (std::size_t j = 0; j < n; ++j) sum += a[i * lda + j] * x[j];
+        y[i] = sum;
+    }
+}
+
+template<typename T>
+void transpose(std::size_t rows, std::size_t cols, const T* in, std::size_t ldin, T* out, std::size_t ldout) {
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) out[j * ldout + i] = in[i * ldin + j];
+    }
+}
+
+} // namespace MatrixKernels
+
+/**
+ * Dense row-major matrix
+ */
+template<typename T>
+class Matrix {
+private:
+    std::size_t rowCount;
+    std::size_t colCount;
+    std::vector<T, AlignedAllocator<T>> values;
+
+public:
+    Matrix() : rowCount(0), colCount(0) {}
+
+    Matrix(std::size_t rows, std::size_t cols, T fill = T())
+        : rowCount(rows), colCount(cols), values(rows * cols, fill) {}
+
+    static Matrix identity(std::size_t n) {
+        Matrix result(n, n);
+        for (std::size_t i = 0; i < n; ++i) result(i, i) = T(1);
+        return result;
+    }
+
+    std::size_t rows() const { return rowCount; }
+    std::size_t cols() const { return colCount; }
+    T* data() { return values.data(); }
+    const T* data() const { return values.data(); }
+
+    // Unchecked element access
+    T& operator()(std::size_t r, std::size_t c) { return values[r * colCount + c]; }
+    const T& operator()(std::size_t r, std::size_t c) const { return values[r * colCount + c]; }
+
+    // Checked element access
+    T& at(std::size_t r, std::size_t c) {
+        checkIndex(r, c);
+        return (*this)(r, c);
+    }
+
+    const T& at(std::size_t r, std::size_t c) const {
+        checkIndex(r, c);
+        return (*this)(r, c);
+    }
+
+    Matrix transpose() const {
+        Matrix result(colCount, rowCount);
+        MatrixKernels::transpose(rowCount, colCount, data(), colCount, result.data(), rowCount);
+        return result;
+    }
+
+    /**
+     * Matrix product; threads == 0 uses one thread per core
+     */
+    Matrix multiply(const Matrix& other, unsigned threads = 0) const {
+        if (colCount != other.rowCount) {
+            throw std::invalid_argument("Matrix dimensions do not match for multiplication!");
+        }
+        Matrix result(rowCount, other.colCount);
+        MatrixKernels::gemm(rowCount, other.colCount, colCount, T(1), data(), colCount,
+                            other.data(), other.colCount, result.data(), other.colCount, threads);
+        return result;
+    }
+
+    Matrix operator*(const Matrix& other) const { return multiply(other); }
+
+    /**
+     * Matrix-vector product
+     */
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        if (x.size() != colCount) {
+            throw std::invalid_argument("Vector length does not match matrix columns!");
+        }
+        std::vector<T> y(rowCount);
+        MatrixKernels::gemv(rowCount, colCount, data(), colCount, x.data(), y.data());
+        return y;
+    }
+
+    bool operator==(const Matrix& other) const {
+        return rowCount == other.rowCount && colCount == other.colCount && values == other.values;
+    }
+
+private:
+    void checkIndex(std::size_t r, std::size_t c) const {
+        if (r >= rowCount || c >= colCount) {
+            throw std::out_of_range("Matrix index out of range!");
+        }
+    }
+};
+
+/**
+ * LU decomposition with partial pivoting: P * A = L * U
+ *
+ * L (unit diagonal) and U share one matrix. Columns are factored in
+ * panels of BlockSize; after each panel the rest of the matrix is updated
+ * with one GEMM, which is where nearly all of the work happens.
+ */
+template<typename T>
+class LUDecomposition {
+private:
+    static constexpr std::size_t BlockSize = 64;
+
+    Matrix<T> lu;
+    std::vector<std::size_t> pivots;  // Row i of P*A is row pivots[i] of A
+    int pivotSign;
+
+    void swapRows(std::size_t r1, std::size_t r2) {
+        if (r1 == r2) return;
+        std::swap_ranges(&lu(r1, 0), &lu(r1, 0) + lu.cols(), &lu(r2, 0));
+        std::swap(pivots[r1], pivots[r2]);
+        pivotSign = -pivotSign;
+    }
+
+    // Unblocked factorization of columns [j0, j0 + width), rows j0 and below
+    void factorPanel(std::size_t j0, std::size_t width) {
+        std::size_t n = lu.rows();
+        for (std::size_t j = j0; j < j0 + width; ++j) {
+            std::size_t pivot = j;
+            for (std::size_t i = j + 1; i < n; ++i) {
+                if (std::abs(lu(i, j)) > std::abs(lu(pivot, j))) pivot = i;
+            }
+            if (lu(pivot, j) == T()) {
+                throw std::runtime_error("Matrix is singular!");
+            }
+            swapRows(j, pivot);
+            T inverse = T(1) / lu(j, j);
+            for (std::size_t i = j + 1; i < n; ++i) {
+                T factor = lu(i, j) *= inverse;
+                for (std::size_t c = j + 1; c < j0 + width; ++c) lu(i, c) -= factor * lu(j, c);
+            }
+        }
+    }
+
+public:
+    explicit LUDecomposition(const Matrix<T>& a, unsigned threads = 0)
+        : lu(a), pivots(a.rows()), pivotSign(1) {
+        if (a.rows() != a.cols()) {
+            throw std::invalid_argument("LU decomposition needs a square matrix!");
+        }
+        std::size_t n = a.rows();
+        for (std::size_t i = 0; i < n; ++i) pivots[i] = i;
+
+        for (std::size_t j0 = 0; j0 < n; j0 += BlockSize) {
+            std::size_t width = std::min(BlockSize, n - j0);
+            std::size_t rest = j0 + width;
+            factorPanel(j0, width);
+            if (rest == n) break;
+
+            // U12 = inverse(L11) * A12
+            for (std::size_t i = j0 + 1; i < rest; ++i) {
+                for (std::size_t p = j0; p < i; ++p) {
+                    T factor = lu(i, p);
+                    for (std::size_t c = rest; c < n; ++c) lu(i, c) -= factor * lu(p, c);
+                }
+            }
+            // A22 -= L21 * U12
+            MatrixKernels::gemm(n - rest, n - rest, width, T(-1), &lu(rest, j0), n,
+                                &lu(j0, rest), n, &lu(rest, rest), n, threads);
+        }
+    }
+
+    const Matrix<T>& combined() const { return lu; }
+    const std::vector<std::size_t>& permutation() const { return pivots; }
+
+    T determinant() const {
+        T result = T(pivotSign);
+        for (std::size_t i = 0; i < lu.rows(); ++i) result *= lu(i, i);
+        return result;
+    }
+
+    /**
+     * Solves A * x = b
+     */
+    std::vector<T> solve(const std::vector<T>& b) const {
+        std::size_t n = lu.rows();
+        if (b.size() != n) {
+            throw std::invalid_argument("Right-hand side length does not match matrix!");
+        }
+        std::vector<T> x(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            T sum = b[pivots[i]];
+            for (std::size_t p = 0; p < i; ++p) sum -= lu(i, p) * x[p];
+            x[i] = sum;
+        }
+        for (std::size_t i = n; i-- > 0;) {
+            T sum = x[i];
+            for (std::size_t p = i + 1; p < n; ++p) sum -= lu(i, p) * x[p];
+            x[i] = sum / lu(i, i);
+        }
+        return x;
+    }
+};
+
+#endif // MATRIX_HPP
@@ -0,0 +1,147 @@
+#ifndef MONTECARLO_HPP
+#define MONTECARLO_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Monte Carlo simulation for the Calculator library
+ *
+ * Random numbers come from Philox4x32-10, a counter-based generator: the
+ * value at position i of stream s is a pure function of (seed, s, i). A
+ * simulation is cut into fixed chunks of paths and chunk c always draws
+ * from stream c, so the estimate is bit-for-bit the same on any number of
+ * threads. Uniforms, Box-Muller normals and exp() are computed in batches
+ * with AVX2 kernels when the CPU has them.
+ */
+
+/**
+ * Philox4x32-10 block function (Salmon et al., SC'11): 10 rounds of
+ * multiply-xor on a 128-bit counter under a 64-bit key
+ */
+class Philox4x32 {
+public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    static Counter generate(Counter counter, Key key);
+};
+
+/**
+ * One reproducible random stream
+ *
+ * Block b of the stream is Philox(counter = (b, streamId), key = seed) and
+ * yields two uniforms. Values drawn one at a time and values drawn in
+ * batches continue the same sequence.
+ */
+class RandomStream {
+private:
+    Philox4x32::Key key;
+    std::uint64_t streamId;
+    std::uint64_t nextBlock = 0;
+    double spare = 0.0;
+    bool hasSpare = false;
+
+public:
+    RandomStream(std::uint64_t seed, std::uint64_t streamId);
+
+    /**
+     * Uniform in the open interval (0, 1), 52 random bits
+     */
+    double nextUniform();
+
+    void fillUniform(double* out, std::size_t n);
+
+    /**
+     * Standard normals by Box-Muller. Within each group of 8 values, value j
+     * and value j + 4 are made from one pair of uniforms (j and j + 1 in the
+     * last group); for odd n the partner of the last value is dropped.
+     */
+    void fillNormal(double* out, std::size_t n);
+
+    /**
+     * Jumps to block b of the stream in O(1)
+     */
+    void seek(std::uint64_t block);
+};
+
+/**
+ * Batch kernels, AVX2 when available and the C library otherwise
+ */
+namespace MonteCarloKernels {
+
+// out[0 .. 2 * blocks) = uniforms of blocks firstBlock .. firstBlock + blocks - 1
+void uniformBlocks(const Philox4x32::Key& key, std::uint64_t streamId, std::uint64_t firstBlock,
+                   std::size_t blocks, double* out);
+
+// In place: uniforms to standard normals, paired as described at RandomStream::fillNormal
+void boxMuller(double* values, std::size_t n);
+
+// In place: values[i] = e^values[i]
+void exp(double* values, std::size_t n);
+
+// "AVX2" or "generic", for reports
+const char* simdLevel();
+
+} // namespace MonteCarloKernels
+
+/**
+ * Geometric Brownian motion dS = rate * S dt + volatility * S dW
+ */
+struct GbmModel {
+    double spot;
+    double rate;
+    double volatility;
+    double maturity;  // Years
+};
+
+/**
+ * Mean of the simulated values with its standard error
+ */
+struct MonteCarloEstimate {
+    double mean = 0.0;
+    double standardError = 0.0;
+    std::uint64_t paths = 0;
+
+    // Normal-approximation confidence interval; z = 1.96 gives 95%
+    double confidenceLow(double z = 1.959963984540054) const { return mean - z * standardError; }
+    double confidenceHigh(double z = 1.959963984540054) const { return mean + z * standardError; }
+};
+
+/**
+ * Runs path kernels over chunks of PathsPerChunk paths on several threads
+ * and merges the per-chunk statistics in chunk order
+ */
+class MonteCarloEngine {
+public:
+    static constexpr std::size_t PathsPerChunk = 4096;  // One random stream per chunk
+
+    // Writes the discounted payoffs of `count` paths drawn from `random`
+    using PathKernel = std::function<void(RandomStream& random, double* payoffs, std::size_t count)>;
+
+private:
+    std::uint64_t seed;
+    unsigned threads;
+
+public:
+    /**
+     * threads == 0 uses one thread per core
+     */
+    explicit MonteCarloEngine(std::uint64_t seed, unsigned threads = 0);
+
+    MonteCarloEstimate run(std::uint64_t paths, const PathKernel& kernel) const;
+
+    /**
+     * European call: one exact GBM step to maturity per path
+     */
+    MonteCarloEstimate europeanCall(const GbmModel& model, double strike, std::uint64_t paths) const;
+
+    /**
+     * Arithmetic-average Asian call monitored at `steps` equally spaced dates
+     */
+    MonteCarloEstimate asianCall(const GbmModel& model, double strike, std::size_t steps, std::uint64_t paths) const;
+};
+
+#endif // MONTECARLO_HPP
@@ -0,0 +1,243 @@
+#ifndef STATISTICS_HPP
+#define STATISTICS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * Streaming statistics for the Calculator library
+ *
+ * Every accumulator sees each value once, keeps a bounded amount of state
+ * no matter how long the stream is, and can merge with another accumulator
+ * of the same kind. Streams can therefore be split across threads (or
+ * machines) and the partial results combined afterwards.
+ *
+ *   RunningStats   count, mean, variance, min, max (Welford)       O(1)
+ *   KllSketch      approximate quantiles of doubles (KLL)          O(k)
+ *   HdrHistogram   quantiles of integers with fixed relative error O(buckets)
+ */
+
+/**
+ * Welford's one-pass mean and variance; merge() uses Chan's pairwise formula
+ */
+class RunningStats {
+private:
+    std::uint64_t n = 0;
+    double meanValue = 0.0;
+    double m2 = 0.0;  // Sum of squared distances from the mean
+    double minValue = std::numeric_limits<double>::infinity();
+    double maxValue = -std::numeric_limits<double>::infinity();
+
+public:
+    void add(double x) {
+        ++n;
+        double delta = x - meanValue;
+        meanValue += delta / static_cast<double>(n);
+        m2 += delta * (x - meanValue);
+        minValue = std::min(minValue, x);
+        maxValue = std::max(maxValue, x);
+    }
+
+    void merge(const RunningStats& other);
+
+    std::uint64_t count() const { return n; }
+    double mean() const;
+    double variance() const;            // Sample variance (n - 1)
+    double populationVariance() const;  // Divides by n
+    double standardDeviation() const;
+    double min() const;
+    double max() const;
+};
+
+/**
+ * KLL quantile sketch (Karnin, Lang, Liberty 2016)
+ *
+ * Values go into level 0. When the sketch holds as many values as its
+ * capacity, the lowest full level is sorted and every other value (random
+ * odd/even choice) is promoted to the next level with twice the weight.
+ * Level capacities shrink by 2/3 per level going down (to at least 8), so
+ * about 3k values are kept in total. The rank error is roughly 1.7 / k
+ * (about 0.8% for the default k = 200).
+ */
+class KllSketch {
+private:
+    static constexpr std::size_t MinLevelCapacity = 8;
+
+    std::size_t k;
+    std::vector<std::vector<double>> levels;  // Values in levels[h] weigh 2^h
+    std::vector<std::size_t> capacities;      // Recomputed when a level is added
+    std::uint64_t n = 0;
+    std::size_t retained = 0;
+    std::size_t capacityTotal = 0;
+    std::uint64_t randomState;
+    double minValue = std::numeric_limits<double>::infinity();
+    double maxValue = -std::numeric_limits<double>::infinity();
+
+    void updateCapacity();
+    void compress();
+    void checkNotEmpty() const;
+
+public:
+    explicit KllSketch(std::size_t k = 200, std::uint64_t seed = 0x9E3779B97F4A7C15ull);
+
+    void add(double x) {
+        levels[0].push_back(x);
+        ++n;
+        minValue = std::min(minValue, x);
+        maxValue = std::max(maxValue, x);
+        if (++retained >= capacityTotal) compress();
+    }
+
+    void merge(const KllSketch& other);
+
+    /**
+     * Value whose rank is approximately q (0 <= q <= 1)
+     */
+    double quantile(double q) const;
+
+    /**
+     * Several quantiles from one sorted view; cheaper than repeated quantile()
+     */
+    std::vector<double> quantiles(const std::vector<double>& qs) const;
+
+    /**
+     * Approximate fraction of the stream that is <= x
+     */
+    double rank(double x) const;
+
+    std::uint64_t count() const { return n; }
+    std::size_t retainedItems() const { return retained; }
+    std::size_t memoryBytes() const;
+    double min() const;
+    double max() const;
+};
+
+/**
+ * High dynamic range histogram for non-negative integers
+ *
+ * Values are grouped into power-of-two buckets, each split linearly into
+ * sub-buckets fine enough for significantDigits decimal digits. Any value
+ * in [lowest, highest] is recorded with a relative error of at most
+ * 10^-significantDigits; memory depends only on the range and precision.
+ */
+class HdrHistogram {
+private:
+    std::uint64_t lowestTrackable;
+    std::uint64_t highestTrackable;
+    int significantDigits;
+    int unitMagnitude;
+    int subBucketHalfCountMagnitude;
+    std::uint64_t subBucketCount;
+    std::uint64_t subBucketHalfCount;
+    std::uint64_t subBucketMask;
+    int leadingZeroCountBase;
+    std::vector<std::uint64_t> counts;
+    std::uint64_t total = 0;
+    std::uint64_t minValue = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t maxValue = 0;
+    double sum = 0.0;
+
+    static int leadingZeros(std::uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(v);
+#else
+        int zeros = 0;
+        for (std::uint64_t bit = std::uint64_t(1) << 63; bit && !(v & bit); bit >>= 1) ++zeros;
+        return zeros;
+#endif
+    }
+
+    int bucketIndex(std::uint64_t value) const {
+        return leadingZeroCountBase - leadingZeros(value | subBucketMask);
+    }
+
+    std::size_t countsIndex(std::uint64_t value) const {
+        int bucket = bucketIndex(value);
+        std::uint64_t subBucket = value >> (bucket + unitMagnitude);
+        return (static_cast<std::size_t>(bucket + 1) << subBucketHalfCountMagnitude) +
+               static_cast<std::size_t>(subBucket - subBucketHalfCount);
+    }
+
+    std::uint64_t valueFromIndex(std::size_t index) const;
+    std::uint64_t highestEquivalentValue(std::uint64_t value) const;
+    void checkNotEmpty() const;
+
+public:
+    HdrHistogram(std::uint64_t lowest, std::uint64_t highest, int significantDigits = 3);
+
+    void record(std::uint64_t value, std::uint64_t times = 1) {
+        if (value > highestTrackable) {
+            throw std::out_of_range("Value exceeds the histogram range!");
+        }
+        counts[countsIndex(value)] += times;
+        total += times;
+        minValue = std::min(minValue, value);
+        maxValue = std::max(maxValue, value);
+        sum += static_cast<double>(value) * static_cast<double>(times);
+    }
+
+    void add(std::uint64_t value) { record(value); }
+
+    void merge(const HdrHistogram& other);
+
+    /**
+     * Value at quantile q (0 <= q <= 1), reported as the highest value
+     * equivalent to the bucket it falls in
+     */
+    std::uint64_t quantile(double q) const;
+
+    std::uint64_t count() const { return total; }
+    double mean() const;
+    std::uint64_t min() const;
+    std::uint64_t max() const;
+    std::size_t memoryBytes() const { return counts.size() * sizeof(std::uint64_t); }
+};
+
+/**
+ * Merges parts pairwise, log2(parts) rounds with the merges of each round
+ * running concurrently; the result is in parts[0]
+ */
+template<typename Accumulator>
+void mergeParallel(std::vector<Accumulator>& parts, unsigned threads = 0) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t stride = 1; stride < parts.size(); stride *= 2) {
+        std::vector<std::thread> workers;
+        for (std::size_t i = 0; i + stride < parts.size(); i += 2 * stride) {
+            if (workers.size() + 1 >= threads) {
+                parts[i].merge(parts[i + stride]);
+            } else {
+                workers.emplace_back([&parts, i, stride] { parts[i].merge(parts[i + stride]); });
+            }
+        }
+        for (std::thread& worker : workers) worker.join();
+    }
+}
+
+/**
+ * Feeds valueAt(0) .. valueAt(count - 1) into per-thread copies of
+ * prototype, one contiguous slice each, and merges them
+ */
+template<typename Accumulator, typename Source>
+Accumulator accumulateParallel(std::size_t count, unsigned threads, const Accumulator& prototype, Source valueAt) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<Accumulator> parts(threads, prototype);
+    std::vector<std::thread> workers;
+    auto fill = [&](unsigned t) {
+        std::size_t first = count * t / threads;
+        std::size_t last = count * (t + 1) / threads;
+        Accumulator& local = parts[t];
+        for (std::size_t i = first; i < last; ++i) local.add(valueAt(i));
+    };
+    for (unsigned t = 1; t < threads; ++t) workers.emplace_back(fill, t);
+    fill(0);
+    for (std::thread& worker : workers) worker.join();
+    mergeParallel(parts, threads);
+    return parts[0];
+}
+
+#endif // STATISTICS_HPP
@@ -0,0 +1,775 @@
+#include "bigint.hpp"
+#include <algorithm>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+/**
+ * BigUnsigned implementation
+ *
+ * The arithmetic works on plain limb vectors (Limbs) so that the recursive
+ * algorithms can pass sub-ranges around without building BigUnsigned
+ * objects. Products of two limbs use the compiler's 128-bit integer.
+ */
+
+namespace {
+
+using Limb = std::uint64_t;
+using Limbs = std::vector<Limb>;
+__extension__ typedef unsigned __int128 Wide;
+
+constexpr std::size_t KaratsubaThreshold = 48;   // Operands below this: schoolbook
+constexpr std::size_t ParallelThreshold = 2048;  // Operands below this: one thread
+constexpr std::size_t NewtonThreshold = 64;      // Reciprocals this small: long division
+constexpr std::size_t NaiveDecimalLimbs = 24;    // Numbers this small: repeated division by 10^19
+constexpr std::size_t ProductLeaf = 32;          // Factors multiplied one by one at a tree leaf
+constexpr std::size_t ChunkDigits = 19;
+constexpr Limb TenPow19 = 10000000000000000000ull;
+
+unsigned resolveThreads(unsigned threads) {
+    return threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads;
+}
+
+void trimLimbs(Limbs& x) {
+    while (!x.empty() && x.back() == 0) x.pop_back();
+}
+
+int compareLimbs(const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+    while (an > 0 && a[an - 1] == 0) --an;
+    while (bn > 0 && b[bn - 1] == 0) --bn;
+    if (an != bn) return an < bn ? -1 : 1;
+    for (std::size_t i = an; i-- > 0;) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+int compareLimbs(const Limbs& a, const Limbs& b) {
+    return compareLimbs(a.data(), a.size(), b.data(), b.size());
+}
+
+// r[offset..] += a; r must be long enough to hold the result
+void addAt(Limbs& r, std::size_t offset, const Limb* a, std::size_t an) {
+    Limb carry = 0;
+    for (std::size_t i = 0; i < an; ++i) {
+        Wide sum = static_cast<Wide>(r[offset + i]) + a[i] + carry;
+        r[offset + i] = static_cast<Limb>(sum);
+        carry = static_cast<Limb>(sum >> 64);
+    }
+    for (std::size_t i = offset + an; carry != 0 && i < r.size(); ++i) {
+        carry = (++r[i] == 0);
+    }
+}
+
+// a -= b; requires a >= b
+void subtractInPlace(Limbs& a, const Limb* b, std::size_t bn) {
+    while (bn > 0 && b[bn - 1] == 0) --bn;
+    Limb borrow = 0;
+    std::size_t i = 0;
+    for (; i < bn; ++i) {
+        Limb ai = a[i];
+        Limb diff = ai - b[i];
+        Limb next = (ai < b[i]) | (diff < borrow);
+        a[i] = diff - borrow;
+        borrow = next;
+    }
+    for (; borrow != 0 && i < a.size(); ++i) {
+        borrow = (a[i] == 0);
+        --a[i];
+    }
+    trimLimbs(a);
+}
+
+void subtractInPlace(Limbs& a, const Limbs& b) {
+    subtractInPlace(a, b.data(), b.size());
+}
+
+void addSmall(Limbs& x, Limb value) {
+    x.push_back(0);
+    addAt(x, 0, &value, 1);
+    trimLimbs(x);
+}
+
+void multiplySmallInPlace(Limbs& x, Limb factor) {
+    Limb carry = 0;
+    for (Limb& limb : x) {
+        Wide product = static_cast<Wide>(limb) * factor + carry;
+        limb = static_cast<Limb>(product);
+        carry = static_cast<Limb>(product >> 64);
+    }
+    if (carry != 0) x.push_back(carry);
+    trimLimbs(x);
+}
+
+// x /= divisor, returns the remainder
+Limb divideSmallInPlace(Limbs& x, Limb divisor) {
+    Wide remainder = 0;
+    for (std::size_t i = x.size(); i-- > 0;) {
+        Wide current = (remainder << 64) | x[i];
+        x[i] = static_cast<Limb>(current / divisor);
+        remainder = current % divisor;
+    }
+    trimLimbs(x);
+    return static_cast<Limb>(remainder);
+}
+
+// r (zeroed, an + bn limbs) = a * b
+void schoolbook(const Limb* a, std::size_t an, const Limb* b, std::size_t bn, Limb* r) {
+    for (std::size_t i = 0; i < an; ++i) {
+        Limb ai = a[i];
+        if (ai == 0) continue;
+        Limb carry = 0;
+        for (std::size_t j = 0; j < bn; ++j) {
+            Wide t = static_cast<Wide>(ai) * b[j] + r[i + j] + carry;
+            r[i + j] = static_cast<Limb>(t);
+            carry = static_cast<Limb>(t >> 64);
+        }
+        r[i + bn] = carry;
+    }
+}
+
+// r (2n limbs) = a^2: every cross product once, doubled, plus the squares
+void schoolbookSquare(const Limb* a, std::size_t n, Limb* r) {
+    std::fill(r, r + 2 * n, 0);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        Limb carry = 0;
+        for (std::size_t j = i + 1; j < n; ++j) {
+            Wide t = static_cast<Wide>(a[i]) * a[j] + r[i + j] + carry;
+            r[i + j] = static_cast<Limb>(t);
+            carry = static_cast<Limb>(t >> 64);
+        }
+        r[i + n] = carry;
+    }
+    Limb shifted = 0;
+    for (std::size_t i = 0; i < 2 * n; ++i) {
+        Limb next = r[i] >> 63;
+        r[i] = (r[i] << 1) | shifted;
+        shifted = next;
+    }
+    Limb carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        Wide square = static_cast<Wide>(a[i]) * a[i];
+        Wide low = static_cast<Wide>(r[2 * i]) + static_cast<Limb>(square) + carry;
+        r[2 * i] = static_cast<Limb>(low);
+        Wide high = static_cast<Wide>(r[2 * i + 1]) + static_cast<Limb>(square >> 64) + static_cast<Limb>(low >> 64);
+        r[2 * i + 1] = static_cast<Limb>(high);
+        carry = static_cast<Limb>(high >> 64);
+    }
+}
+
+// r[0..rn) += a[0..an), an <= rn; returns the carry out of r
+Limb addInto(Limb* r, std::size_t rn, const Limb* a, std::size_t an) {
+    Limb carry = 0;
+    std::size_t i = 0;
+    for (; i < an; ++i) {
+        Wide sum = static_cast<Wide>(r[i]) + a[i] + carry;
+        r[i] = static_cast<Limb>(sum);
+        carry = static_cast<Limb>(sum >> 64);
+    }
+    for (; carry != 0 && i < rn; ++i) carry = (++r[i] == 0);
+    return carry;
+}
+
+// r[0..rn) -= a[0..an), an <= rn; returns the borrow out of r
+Limb subtractFrom(Limb* r, std::size_t rn, const Limb* a, std::size_t an) {
+    Limb borrow = 0;
+    std::size_t i = 0;
+    for (; i < an; ++i) {
+        Limb ri = r[i];
+        Limb diff = ri - a[i];
+        Limb next = (ri < a[i]) | (diff < borrow);
+        r[i] = diff - borrow;
+        borrow = next;
+    }
+    for (; borrow != 0 && i < rn; ++i) borrow = (r[i]-- == 0);
+    return borrow;
+}
+
+// out (hn limbs) = |high - low| for hn >= ln; true when low > high
+bool absoluteDifference(const Limb* high, std::size_t hn, const Limb* low, std::size_t ln, Limb* out) {
+    bool negative = compareLimbs(high, hn, low, ln) < 0;
+    if (negative) {
+        std::copy(low, low + ln, out);
+        std::fill(out + ln, out + hn, 0);
+        subtractFrom(out, hn, high, hn);
+    } else {
+        std::copy(high, high + hn, out);
+        subtractFrom(out, hn, low, ln);
+    }
+    return negative;
+}
+
+// Scratch limbs karatsuba() needs for n-limb operands
+std::size_t karatsubaScratch(std::size_t n) {
+    std::size_t total = 0;
+    while (n >= KaratsubaThreshold) {
+        std::size_t n1 = n - n / 2;
+        total += 6 * n1 + 1;
+        n = n1;
+    }
+    return total;
+}
+
+// r (2n limbs) = a * b for n-limb operands; a == b takes the squaring path.
+// Uses a0 * b1 + a1 * b0 = z0 + z2 - (a1 - a0)(b1 - b0), so no operand grows.
+void karatsuba(const Limb* a, const Limb* b, std::size_t n, Limb* r, Limb* scratch, unsigned threads) {
+    bool square = (a == b);
+    if (n < KaratsubaThreshold) {
+        if (square) {
+            schoolbookSquare(a, n, r);
+        } else {
+            std::fill(r, r + 2 * n, 0);
+            schoolbook(a, n, b, n, r);
+        }
+        return;
+    }
+
+    std::size_t h = n / 2;
+    std::size_t n1 = n - h;
+    const Limb* a1 = a + h;
+    const Limb* b1 = b + h;
+    Limb* da = scratch;
+    Limb* db = da + n1;
+    Limb* m = db + n1;
+    Limb* t = m + 2 * n1;
+    Limb* rest = t + 2 * n1 + 1;
+    bool negativeA = absoluteDifference(a1, n1, a, h, da);
+    bool negativeB = square ? negativeA : absoluteDifference(b1, n1, b, h, db);
+    const Limb* dbOrDa = square ? da : db;
+
+    if (threads > 1 && n >= ParallelThreshold) {
+        // The three half-size products run concurrently (two with only two threads)
+        unsigned share = std::max(1u, threads / 3);
+        bool middleAsync = threads >= 3;
+        Limbs highScratch(karatsubaScratch(n1)), middleScratch(karatsubaScratch(n1));
+        auto high = std::async(std::launch::async, [&] { karatsuba(a1, b1, n1, r + 2 * h, highScratch.data(), share); });
+        std::future<void> middle;
+        if (middleAsync) {
+            middle = std::async(std::launch::async, [&] { karatsuba(da, dbOrDa, n1, m, middleScratch.data(), share); });
+        }
+        karatsuba(a, b, h, r, rest, threads - share * (middleAsync ? 2 : 1));
+        if (middleAsync) {
+            middle.get();
+        } else {
+            karatsuba(da, dbOrDa, n1, m, middleScratch.data(), threads - share);
+        }
+        high.get();
+    } else {
+        karatsuba(a, b, h, r, rest, 1);
+        karatsuba(a1, b1, n1, r + 2 * h, rest, 1);
+        karatsuba(da, dbOrDa, n1, m, rest, 1);
+    }
+
+    // t = z0 + z2 -/+ |a1 - a0| * |b1 - b0|, then r += t * B^h
+    std::copy(r + 2 * h, r + 2 * n, t);
+    t[2 * n1] = 0;
+    addInto(t, 2 * n1 + 1, r, 2 * h);
+    if (negativeA == negativeB) {
+        subtractFrom(t, 2 * n1 + 1, m, 2 * n1);
+    } else {
+        addInto(t, 2 * n1 + 1, m, 2 * n1);
+    }
+    addInto(r + h, 2 * n - h, t, 2 * n1 + 1);
+}
+
+Limbs multiplyLimbs(const Limb* a, std::size_t an, const Limb* b, std::size_t bn, unsigned threads) {
+    while (an > 0 && a[an - 1] == 0) --an;
+    while (bn > 0 && b[bn - 1] == 0) --bn;
+    if (an == 0 || bn == 0) return Limbs();
+    if (an < bn) {
+        std::swap(a, b);
+        std::swap(an, bn);
+    }
+    Limbs result(an + bn, 0);
+
+    if (bn < KaratsubaThreshold) {
+        schoolbook(a, an, b, bn, result.data());
+    } else if (an == bn) {
+        Limbs scratch(karatsubaScratch(bn));
+        karatsuba(a, b, bn, result.data(), scratch.data(), threads);
+    } else {
+        // Unbalanced: multiply b by bn-limb slices of a
+        Limbs scratch(karatsubaScratch(bn)), part(2 * bn);
+        for (std::size_t offset = 0; offset < an; offset += bn) {
+            std::size_t length = std::min(bn, an - offset);
+            if (length == bn) {
+                karatsuba(a + offset, b, bn, part.data(), scratch.data(), threads);
+                addAt(result, offset, part.data(), part.size());
+            } else {
+                Limbs tail = multiplyLimbs(b, bn, a + offset, length, threads);
+                addAt(result, offset, tail.data(), tail.size());
+            }
+        }
+    }
+    trimLimbs(result);
+    return result;
+}
+
+Limbs multiplyLimbs(const Limbs& a, const Limbs& b, unsigned threads) {
+    return multiplyLimbs(a.data(), a.size(), b.data(), b.size(), threads);
+}
+
+// Knuth's algorithm D; b must not be zero
+void divideLimbs(const Limbs& a, const Limbs& b, Limbs& quotient, Limbs& remainder) {
+    if (compareLimbs(a, b) < 0) {
+        quotient.clear();
+        remainder = a;
+        trimLimbs(remainder);
+        return;
+    }
+    if (b.size() == 1) {
+        quotient = a;
+        Limb rest = divideSmallInPlace(quotient, b[0]);
+        remainder.assign(rest != 0 ? 1 : 0, rest);
+        return;
+    }
+
+    // Normalise so the divisor's top bit is set
+    std::size_t n = b.size();
+    std::size_t m = a.size() - n;
+    int shift = __builtin_clzll(b.back());
+    Limbs v(n), u(a.size() + 1);
+    for (std::size_t i = n; i-- > 0;) {
+        v[i] = (b[i] << shift) | (shift != 0 && i > 0 ? b[i - 1] >> (64 - shift) : 0);
+    }
+    u[a.size()] = shift != 0 ? a.back() >> (64 - shift) : 0;
+    for (std::size_t i = a.size(); i-- > 0;) {
+        u[i] = (a[i] << shift) | (shift != 0 && i > 0 ? a[i - 1] >> (64 - shift) : 0);
+    }
+
+    quotient.assign(m + 1, 0);
+    const Wide base = static_cast<Wide>(1) << 64;
+    for (std::size_t j = m + 1; j-- > 0;) {
+        Wide numerator = (static_cast<Wide>(u[j + n]) << 64) | u[j + n - 1];
+        Wide qhat = numerator / v[n - 1];
+        Wide rhat = numerator % v[n - 1];
+        while (qhat >= base || qhat * v[n - 2] > ((rhat << 64) | u[j + n - 2])) {
+            --qhat;
+            rhat += v[n - 1];
+            if (rhat >= base) break;
+        }
+
+        // u[j .. j + n] -= qhat * v
+        Limb borrow = 0, carry = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            Wide product = qhat * v[i] + carry;
+            carry = static_cast<Limb>(product >> 64);
+            Limb low = static_cast<Limb>(product);
+            Limb ui = u[i + j];
+            Limb diff = ui - low;
+            Limb next = (ui < low) | (diff < borrow);
+            u[i + j] = diff - borrow;
+            borrow = next;
+        }
+        Limb top = u[j + n];
+        Limb diff = top - carry;
+        Limb negative = (top < carry) | (diff < borrow);
+        u[j + n] = diff - borrow;
+
+        if (negative) {
+            // qhat was one too large: add v back
+            --qhat;
+            Limb addCarry = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                Wide sum = static_cast<Wide>(u[i + j]) + v[i] + addCarry;
+                u[i + j] = static_cast<Limb>(sum);
+                addCarry = static_cast<Limb>(sum >> 64);
+            }
+            u[j + n] += addCarry;
+        }
+        quotient[j] = static_cast<Limb>(qhat);
+    }
+
+    remainder.assign(n, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        remainder[i] = (u[i] >> shift) | (shift != 0 ? u[i + 1] << (64 - shift) : 0);
+    }
+    trimLimbs(quotient);
+    trimLimbs(remainder);
+}
+
+// floor(B^(2m) / p) for an m-limb p, by Newton's iteration on the top half
+Limbs reciprocal(const Limbs& p, unsigned threads) {
+    std::size_t m = p.size();
+    Limbs target(2 * m + 1, 0);
+    target[2 * m] = 1;
+    if (m <= NewtonThreshold) {
+        Limbs quotient, remainder;
+        divideLimbs(target, p, quotient, remainder);
+        return quotient;
+    }
+
+    // Two extra limbs in the half-size estimate leave only an O(1) error after one step
+    std::size_t h = m / 2 + 2;
+    Limbs top(p.end() - static_cast<std::ptrdiff_t>(h), p.end());
+    Limbs estimate(m - h, 0);
+    Limbs topInverse = reciprocal(top, threads);
+    estimate.insert(estimate.end(), topInverse.begin(), topInverse.end());
+
+    // estimate += estimate * (B^2m - p * estimate) / B^2m
+    Limbs scaled = multiplyLimbs(p, estimate, threads);
+    bool below = compareLimbs(scaled, target) <= 0;
+    Limbs error = below ? target : scaled;
+    subtractInPlace(error, below ? scaled : target);
+    Limbs correction = multiplyLimbs(estimate, error, threads);
+    correction.erase(correction.begin(), correction.begin() + static_cast<std::ptrdiff_t>(std::min(correction.size(), 2 * m)));
+    if (below) {
+        estimate.push_back(0);
+        addAt(estimate, 0, correction.data(), correction.size());
+        trimLimbs(estimate);
+    } else {
+        addSmall(correction, 1);
+        subtractInPlace(estimate, correction);
+    }
+
+    // Exact adjustment: p * estimate <= B^2m < p * (estimate + 1)
+    scaled = multiplyLimbs(p, estimate, threads);
+    while (compareLimbs(scaled, target) > 0) {
+        subtractInPlace(estimate, Limbs{1});
+        subtractInPlace(scaled, p);
+    }
+    Limbs rest = target;
+    subtractInPlace(rest, scaled);
+    while (compareLimbs(rest, p) >= 0) {
+        addSmall(estimate, 1);
+        subtractInPlace(rest, p);
+    }
+    return estimate;
+}
+
+// 10^(19 * 2^level) and its reciprocal
+struct DecimalPower {
+    Limbs power;
+    Limbs inverse;
+};
+
+// Barrett division of x < power^2 by power
+void divideByPower(const Limbs& x, const DecimalPower& level, Limbs& quotient, Limbs& remainder, unsigned threads) {
+    std::size_t m = level.power.size();
+    Limbs product = multiplyLimbs(x, level.inverse, threads);
+    if (product.size() > 2 * m) {
+        quotient.assign(product.begin() + static_cast<std::ptrdiff_t>(2 * m), product.end());
+    } else {
+        quotient.clear();
+    }
+    // The estimate is at most two below the true quotient
+    remainder = x;
+    subtractInPlace(remainder, multiplyLimbs(quotient, level.power, threads));
+    while (compareLimbs(remainder, level.power) >= 0) {
+        subtractInPlace(remainder, level.power);
+        addSmall(quotient, 1);
+    }
+}
+
+// Writes x as exactly `digits` decimal digits, zero-padded on the left
+void writeDigitsNaive(Limbs x, char* out, std::size_t digits) {
+    char* p = out + digits;
+    while (!x.empty() && p > out) {
+        Limb chunk = divideSmallInPlace(x, TenPow19);
+        for (std::size_t i = 0; i < ChunkDigits && p > out; ++i) {
+            *--p = static_cast<char>('0' + chunk % 10);
+            chunk /= 10;
+        }
+    }
+    while (p > out) *--p = '0';
+}
+
+// x < power[level]^2: writes 2 * 19 * 2^level digits
+void writeDigits(const Limbs& x, const std::vector<DecimalPower>& powers, std::size_t level,
+                 char* out, unsigned threads) {
+    std::size_t digits = (2 * ChunkDigits) << level;
+    if (x.size() <= NaiveDecimalLimbs || level == 0) {
+        writeDigitsNaive(x, out, digits);
+        return;
+    }
+    Limbs high, low;
+    divideByPower(x, powers[level], high, low, threads);
+    std::size_t half = digits / 2;
+    if (threads > 1 && x.size() >= ParallelThreshold) {
+        unsigned share = threads / 2;
+        auto upper = std::async(std::launch::async, [&] { writeDigits(high, powers, level - 1, out, share); });
+        writeDigits(low, powers, level - 1, out + half, threads - share);
+        upper.get();
+    } else {
+        writeDigits(high, powers, level - 1, out, 1);
+        writeDigits(low, powers, level - 1, out + half, 1);
+    }
+}
+
+// Parses len digits; powers[i] = 10^(19 * 2^i)
+Limbs parseDigits(const char* s, std::size_t len, const std::vector<Limbs>& powers, unsigned threads) {
+    if (len <= ChunkDigits * NaiveDecimalLimbs) {
+        Limbs x;
+        for (std::size_t i = 0; i < len;) {
+            std::size_t take = std::min(ChunkDigits, len - i);
+            Limb chunk = 0, scale = 1;
+            for (std::size_t j = 0; j < take; ++j) {
+                chunk = chunk * 10 + static_cast<Limb>(s[i + j] - '0');
+                scale *= 10;
+            }
+            multiplySmallInPlace(x, scale);
+            addSmall(x, chunk);
+            i += take;
+        }
+        return x;
+    }
+    std::size_t level = 0;
+    while ((ChunkDigits << (level + 1)) < len) ++level;
+    std::size_t lowDigits = ChunkDigits << level;
+    Limbs high = parseDigits(s, len - lowDigits, powers, threads);
+    Limbs low = parseDigits(s + len - lowDigits, lowDigits, powers, threads);
+    Limbs result = multiplyLimbs(high, powers[level], threads);
+    result.push_back(0);
+    addAt(result, 0, low.data(), low.size());
+    trimLimbs(result);
+    return result;
+}
+
+Limbs productRange(const std::uint64_t* factors, std::size_t count, unsigned threads) {
+    if (count <= ProductLeaf) {
+        Limbs result{1};
+        for (std::size_t i = 0; i < count; ++i) multiplySmallInPlace(result, factors[i]);
+        return result;
+    }
+    std::size_t mid = count / 2;
+    if (threads > 1) {
+        unsigned share = threads / 2;
+        auto left = std::async(std::launch::async, [=] { return productRange(factors, mid, share); });
+        Limbs right = productRange(factors + mid, count - mid, threads - share);
+        return multiplyLimbs(left.get(), right, threads);
+    }
+    return multiplyLimbs(productRange(factors, mid, 1), productRange(factors + mid, count - mid, 1), 1);
+}
+
+// Packs small factors into as few 64-bit words as possible
+std::vector<std::uint64_t> packFactors(const std::vector<std::uint64_t>& factors) {
+    std::vector<std::uint64_t> packed;
+    Wide current = 1;
+    for (std::uint64_t factor : factors) {
+        if (current * factor > ~static_cast<Limb>(0)) {
+            packed.push_back(static_cast<Limb>(current));
+            current = 1;
+        }
+        current *= factor;
+    }
+    if (current > 1) packed.push_back(static_cast<Limb>(current));
+    return packed;
+}
+
+std::vector<std::uint32_t> primesUpTo(std::uint32_t n) {
+    std::vector<std::uint32_t> primes;
+    if (n < 2) return primes;
+    std::vector<bool> composite(n + 1, false);
+    for (std::uint64_t i = 2; i <= n; ++i) {
+        if (composite[i]) continue;
+        primes.push_back(static_cast<std::uint32_t>(i));
+        for (std::uint64_t j = i * i; j <= n; j += i) composite[j] = true;
+    }
+    return primes;
+}
+
+// swing(n) = n! / ((n/2)!)^2 without its factors of two
+Limbs oddSwing(std::uint32_t n, const std::vector<std::uint32_t>& primes, unsigned threads) {
+    std::vector<std::uint64_t> factors;
+    for (std::uint32_t p : primes) {
+        if (p > n) break;
+        if (p == 2) continue;
+        // Exponent of p in swing(n) is the number of odd floor(n / p^i); p^e <= n
+        std::uint64_t power = 1;
+        for (std::uint32_t q = n / p; q > 0; q /= p) {
+            if (q & 1) power *= p;
+        }
+        if (power > 1) factors.push_back(power);
+    }
+    std::vector<std::uint64_t> packed = packFactors(factors);
+    return productRange(packed.data(), packed.size(), threads);
+}
+
+// n! without its factors of two: oddFactorial(n / 2)^2 * oddSwing(n)
+Limbs oddFactorial(std::uint32_t n, const std::vector<std::uint32_t>& primes, unsigned threads) {
+    if (n < 3) return Limbs{1};
+    Limbs half = oddFactorial(n / 2, primes, threads);
+    Limbs swing = oddSwing(n, primes, threads);
+    return multiplyLimbs(multiplyLimbs(half, half, threads), swing, threads);
+}
+
+} // namespace
+
+// ======================= BigUnsigned =======================
+
+BigUnsigned::BigUnsigned(std::uint64_t value) {
+    if (value != 0) limbs.push_back(value);
+}
+
+BigUnsigned::BigUnsigned(std::vector<std::uint64_t> littleEndianLimbs) : limbs(std::move(littleEndianLimbs)) {
+    trim();
+}
+
+void BigUnsigned::trim() {
+    trimLimbs(limbs);
+}
+
+BigUnsigned BigUnsigned::fromString(const std::string& digits) {
+    if (digits.empty() || digits.find_first_not_of("0123456789") != std::string::npos) {
+        throw std::invalid_argument("Not a decimal number: \"" + digits.substr(0, 32) + "\"");
+    }
+    std::vector<Limbs> powers{Limbs{TenPow19}};
+    while ((ChunkDigits << powers.size()) < digits.size()) {
+        powers.push_back(multiplyLimbs(powers.back(), powers.back(), 1));
+    }
+    return BigUnsigned(parseDigits(digits.data(), digits.size(), powers, 1));
+}
+
+std::string BigUnsigned::toString(unsigned threads) const {
+    if (limbs.empty()) return "0";
+    threads = resolveThreads(threads);
+
+    // Smallest level whose power squared exceeds the number
+    std::vector<DecimalPower> powers{DecimalPower{Limbs{TenPow19}, Limbs()}};
+    for (;;) {
+        Limbs square = multiplyLimbs(powers.back().power, powers.back().power, threads);
+        if (compareLimbs(square, limbs) > 0) break;
+        powers.push_back(DecimalPower{std::move(square), Limbs()});
+    }
+    for (DecimalPower& level : powers) {
+        if (level.power.size() * 2 > NaiveDecimalLimbs) level.inverse = reciprocal(level.power, threads);
+    }
+
+    std::size_t level = powers.size() - 1;
+    std::string text((2 * ChunkDigits) << level, '0');
+    writeDigits(limbs, powers, level, &text[0], threads);
+    return text.substr(text.find_first_not_of('0'));
+}
+
+std::size_t BigUnsigned::bitLength() const {
+    if (limbs.empty()) return 0;
+    return limbs.size() * 64 - static_cast<std::size_t>(__builtin_clzll(limbs.back()));
+}
+
+int BigUnsigned::compare(const BigUnsigned& a, const BigUnsigned& b) {
+    return compareLimbs(a.limbs, b.limbs);
+}
+
+BigUnsigned BigUnsigned::multiply(const BigUnsigned& a, const BigUnsigned& b, unsigned threads) {
+    return BigUnsigned(multiplyLimbs(a.limbs, b.limbs, resolveThreads(threads)));
+}
+
+void BigUnsigned::divmod(const BigUnsigned& a, const BigUnsigned& b, BigUnsigned& quotient, BigUnsigned& remainder) {
+    if (b.isZero()) {
+        throw std::runtime_error("Division by zero!");
+    }
+    Limbs q, r;
+    divideLimbs(a.limbs, b.limbs, q, r);
+    quotient = BigUnsigned(std::move(q));
+    remainder = BigUnsigned(std::move(r));
+}
+
+BigUnsigned operator/(const BigUnsigned& a, const BigUnsigned& b) {
+    BigUnsigned quotient, remainder;
+    BigUnsigned::divmod(a, b, quotient, remainder);
+    return quotient;
+}
+
+BigUnsigned operator%(const BigUnsigned& a, const BigUnsigned& b) {
+    BigUnsigned quotient, remainder;
+    BigUnsigned::divmod(a, b, quotient, remainder);
+    return remainder;
+}
+
+BigUnsigned& BigUnsigned::operator+=(const BigUnsigned& other) {
+    if (other.limbs.size() > limbs.size()) limbs.resize(other.limbs.size(), 0);
+    limbs.push_back(0);
+    addAt(limbs, 0, other.limbs.data(), other.limbs.size());
+    trim();
+    return *this;
+}
+
+BigUnsigned& BigUnsigned::operator-=(const BigUnsigned& other) {
+    if (compare(*this, other) < 0) {
+        throw std::underflow_error("Result would be negative!");
+    }
+    subtractInPlace(limbs, other.limbs);
+    return *this;
+}
+
+BigUnsigned& BigUnsigned::operator*=(const BigUnsigned& other) {
+    limbs = multiplyLimbs(limbs, other.limbs, 1);
+    return *this;
+}
+
+BigUnsigned& BigUnsigned::multiplySmall(std::uint64_t factor) {
+    multiplySmallInPlace(limbs, factor);
+    return *this;
+}
+
+BigUnsigned& BigUnsigned::operator<<=(std::size_t bits) {
+    if (limbs.empty() || bits == 0) return *this;
+    std::size_t whole = bits / 64;
+    unsigned shift = static_cast<unsigned>(bits % 64);
+    if (shift != 0) {
+        Limb carry = 0;
+        for (Limb& limb : limbs) {
+            Limb next = limb >> (64 - shift);
+            limb = (limb << shift) | carry;
+            carry = next;
+        }
+        if (carry != 0) limbs.push_back(carry);
+    }
+    limbs.insert(limbs.begin(), whole, 0);
+    return *this;
+}
+
+BigUnsigned& BigUnsigned::operator>>=(std::size_t bits) {
+    std::size_t whole = bits / 64;
+    if (whole >= limbs.size()) {
+        limbs.clear();
+        return *this;
+    }
+    limbs.erase(limbs.begin(), limbs.begin() + static_cast<std::ptrdiff_t>(whole));
+    unsigned shift = static_cast<unsigned>(bits % 64);
+    if (shift != 0) {
+        for (std::size_t i = 0; i < limbs.size(); ++i) {
+            Limb next = i + 1 < limbs.size() ? limbs[i + 1] << (64 - shift) : 0;
+            limbs[i] = (limbs[i] >> shift) | next;
+        }
+    }
+    trim();
+    return *this;
+}
+
+// ======================= Combinatorics =======================
+
+namespace Combinatorics {
+
+BigUnsigned factorial(std::uint32_t n, unsigned threads) {
+    threads = resolveThreads(threads);
+    std::vector<std::uint32_t> primes = primesUpTo(n);
+    BigUnsigned result(oddFactorial(n, primes, threads));
+    // n! has n - popcount(n) factors of two
+    return result <<= (n - static_cast<std::uint32_t>(__builtin_popcount(n)));
+}
+
+BigUnsigned binomial(std::uint32_t n, std::uint32_t k, unsigned threads) {
+    if (k > n) return BigUnsigned();
+    std::vector<std::uint64_t> factors;
+    for (std::uint32_t p : primesUpTo(n)) {
+        // Legendre: exponent of p is the number of borrows when subtracting k from n in base p
+        std::uint64_t power = 1;
+        for (std::uint64_t pi = p; pi <= n; pi *= p) {
+            if (n / pi - k / pi - (n - k) / pi) power *= p;
+        }
+        if (power > 1) factors.push_back(power);
+    }
+    return product(factors, threads);
+}
+
+BigUnsigned product(const std::vector<std::uint64_t>& factors, unsigned threads) {
+    for (std::uint64_t factor : factors) {
+        if (factor == 0) return BigUnsigned();
+    }
+    std::vector<std::uint64_t> packed = packFactors(factors);
+    return BigUnsigned(productRange(packed.data(), packed.size(), resolveThreads(threads)));
+}
+
+} // namespace Combinatorics
@@ -0,0 +1,209 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bigint.hpp"
+#include "calculator.hpp"
+
+/**
+ * BigUnsigned self-check and factorial benchmark
+ *
+ * For n = 10^4, 10^5, 10^6 (up to the size given) it times:
+ *   - sequential product 2 * 3 * ... * n (multiplySmall, quadratic)
+ *   - prime-swing factorial on 1 thread and on N threads
+ *   - decimal conversion on 1 and N threads, and the quadratic
+ *     "divide by 10^19 until zero" conversion for the smaller results
+ *
+ * Usage: bigint_benchmark [max n] [threads]
+ */
+
+using Clock = std::chrono::steady_clock;
+
+static double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        throw std::runtime_error(what);
+    }
+}
+
+static BigUnsigned randomNumber(std::size_t limbs, std::mt19937_64& rng) {
+    std::vector<std::uint64_t> data(limbs);
+    for (std::uint64_t& limb : data) limb = rng();
+    data.back() |= 1;
+    return BigUnsigned(data);
+}
+
+static BigUnsigned sequentialFactorial(std::uint32_t n) {
+    BigUnsigned result(1);
+    for (std::uint32_t i = 2; i <= n; ++i) result.multiplySmall(i);
+    return result;
+}
+
+// One 19-digit chunk per pass over the whole number
+static std::string naiveDecimal(BigUnsigned value) {
+    if (value.isZero()) return "0";
+    const BigUnsigned chunkBase(10000000000000000000ull);
+    std::vector<std::uint64_t> chunks;
+    BigUnsigned quotient, remainder;
+    while (!value.isZero()) {
+        BigUnsigned::divmod(value, chunkBase, quotient, remainder);
+        chunks.push_back(remainder.isZero() ? 0 : remainder.data()[0]);
+        value = quotient;
+    }
+    std::string text = std::to_string(chunks.back());
+    for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+        std::string chunk = std::to_string(chunks[i]);
+        text += std::string(19 - chunk.size(), '0') + chunk;
+    }
+    return text;
+}
+
+static std::size_t expectedDigits(std::uint32_t n) {
+    return static_cast<std::size_t>(std::floor(std::lgamma(n + 1.0) / std::log(10.0))) + 1;
+}
+
+static std::size_t trailingZeros(const std::string& text) {
+    return text.size() - 1 - text.find_last_not_of('0');
+}
+
+static void checkCorrectness(unsigned threads, std::mt19937_64& rng) {
+    std::cout << "1. Correctness:" << std::endl;
+
+    const std::string hundred =
+        "93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286"
+        "253697920827223758251185210916864000000000000000000000000";
+    expect(Combinatorics::factorial(100).toString() == hundred, "100! is wrong");
+    expect(Combinatorics::binomial(100, 50).toString() == "100891344545564193334812497256", "C(100, 50) is wrong");
+    expect(Combinatorics::binomial(10, 11).isZero(), "C(10, 11) should be 0");
+    std::cout << "   100! and C(100, 50) match their known values" << std::endl;
+
+    // Calculator::factorial is a double
+    expect(static_cast<std::uint64_t>(Calculator::factorial(20)) == 2432902008176640000ull, "20! as double");
+    std::cout << "   Calculator::factorial(25) = " << std::setprecision(17) << Calculator::factorial(25)
+              << ", exact " << Combinatorics::factorial(25).toString() << std::endl;
+    std::cout << "   Calculator::factorial(171) = " << Calculator::factorial(171) << std::endl;
+
+    // Karatsuba (serial and parallel) against long division
+    for (std::size_t limbs : {3, 40, 700, 5000}) {
+        BigUnsigned a = randomNumber(limbs, rng);
+        BigUnsigned b = randomNumber(limbs / 2 + 1, rng);
+        BigUnsigned c = randomNumber(limbs / 3 + 1, rng) % b;
+        BigUnsigned product = BigUnsigned::multiply(a, b, 1);
+        expect(product == BigUnsigned::multiply(a, b, threads), "Parallel product differs");
+        expect(product == BigUnsigned::multiply(b, a, 3), "Product is not commutative");
+        BigUnsigned quotient, remainder;
+        BigUnsigned::divmod(product + c, b, quotient, remainder);
+        expect(quotient == a && remainder == c, "(a * b + c) / b != a");
+        expect(((a << 77) >> 77) == a, "Shifts do not round-trip");
+        expect((product - c) + c == product, "Subtraction does not round-trip");
+    }
+    std::cout << "   products of up to 5000 limbs verified by division" << std::endl;
+
+    for (std::size_t limbs : {1, 30, 900, 6000}) {
+        BigUnsigned value = randomNumber(limbs, rng);
+        std::string text = value.toString(threads);
+        expect(text == naiveDecimal(value), "Decimal conversion differs");
+        expect(BigUnsigned::fromString(text) == value, "Parsing does not round-trip");
+    }
+    std::cout << "   decimal conversion matches the naive method up to 6000 limbs" << std::endl;
+
+    for (std::uint32_t n : {0u, 1u, 2u, 3u, 17u, 1000u, 5000u}) {
+        expect(Combinatorics::factorial(n, threads) == sequentialFactorial(n), "factorial(" + std::to_string(n) + ")");
+    }
+    BigUnsigned n2000 = Combinatorics::factorial(2000);
+    BigUnsigned split = Combinatorics::binomial(2000, 700) * Combinatorics::factorial(700) * Combinatorics::factorial(1300);
+    expect(split == n2000, "C(2000, 700) * 700! * 1300! != 2000!");
+    std::cout << "   prime-swing factorial and binomial agree with direct products" << std::endl;
+
+    try {
+        BigUnsigned(5) - BigUnsigned(7);
+        throw std::logic_error("Negative result was accepted");
+    } catch (const std::underflow_error& e) {
+        std::cout << "   Error caught: " << e.what() << std::endl;
+    }
+    try {
+        BigUnsigned::fromString("12a4");
+        throw std::logic_error("Bad digits were accepted");
+    } catch (const std::invalid_argument& e) {
+        std::cout << "   Error caught: " << e.what() << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "Big Integer Factorial Benchmark - CMake Build!" << std::endl;
+
+    try {
+        std::uint32_t maxN = argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+        unsigned threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+                                    : std::max(1u, std::thread::hardware_concurrency());
+        std::mt19937_64 rng(2024);
+        checkCorrectness(threads, rng);
+
+        std::cout << "\n2. Factorials (seconds; N = " << threads << " thread(s)):" << std::endl;
+        std::cout << std::setw(9) << "n" << std::setw(10) << "digits" << std::setw(12) << "sequential"
+                  << std::setw(10) << "swing x1" << std::setw(10) << "swing xN" << std::setw(12) << "naive dec"
+                  << std::setw(10) << "dec x1" << std::setw(10) << "dec xN" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+
+        std::vector<std::uint32_t> sizes;
+        for (std::uint32_t n = 10000; n <= maxN; n *= 10) sizes.push_back(n);
+        if (sizes.empty() || sizes.back() != maxN) sizes.push_back(maxN);
+
+        for (std::uint32_t n : sizes) {
+            std::cout << std::setw(9) << n << std::flush;
+            auto start = Clock::now();
+            BigUnsigned single = Combinatorics::factorial(n, 1);
+            double swingSingle = secondsSince(start);
+            start = Clock::now();
+            BigUnsigned parallel = Combinatorics::factorial(n, threads);
+            double swingParallel = secondsSince(start);
+            expect(single == parallel, "Parallel factorial differs");
+
+            start = Clock::now();
+            std::string text = single.toString(1);
+            double decimalSingle = secondsSince(start);
+            start = Clock::now();
+            std::string textParallel = single.toString(threads);
+            double decimalParallel = secondsSince(start);
+            expect(text == textParallel, "Parallel decimal conversion differs");
+            expect(text.size() == expectedDigits(n), "Digit count of " + std::to_string(n) + "! is wrong");
+            std::size_t zeros = 0;
+            for (std::uint64_t power = 5; power <= n; power *= 5) zeros += n / power;
+            expect(trailingZeros(text) == zeros, "Trailing zeros of " + std::to_string(n) + "! are wrong");
+            if (n == 100000) expect(text.compare(0, 20, "28242294079603478742") == 0, "Leading digits of 100000!");
+
+            // The quadratic methods take minutes at 10^6
+            std::string sequential = "-", naive = "-";
+            if (n <= 100000) {
+                start = Clock::now();
+                expect(sequentialFactorial(n) == single, "Sequential product differs");
+                sequential = std::to_string(secondsSince(start)).substr(0, 6);
+            }
+            if (n <= 20000) {
+                start = Clock::now();
+                expect(naiveDecimal(single) == text, "Naive decimal conversion differs");
+                naive = std::to_string(secondsSince(start)).substr(0, 6);
+            }
+
+            std::cout << std::setw(10) << text.size() << std::setw(12) << sequential << std::setw(10) << swingSingle
+                      << std::setw(10) << swingParallel << std::setw(12) << naive << std::setw(10) << decimalSingle
+                      << std::setw(10) << decimalParallel << std::endl;
+        }
+
+        std::cout << "\n✅ Big integer checks passed" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <iomanip>
 #include "calculator.hpp"
+#include "matrix.hpp"
 
 /**
  * Main application file demonstrating the Calculator class
@@ -62,6 +63,38 @@ void demonstrateErrorHandling() {
     }
 }
 
+void demonstrateMatrixOperations() {
+    printHeader("MATRIX OPERATIONS");
+    
+    Matrix<double> a(2, 3);
+    Matrix<double> b(3, 2);
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            a(i, j) = static_cast<double>(i * 3 + j + 1);
+            b(j, i) = static_cast<double>(j * 2 + i + 1);
+        }
+    }
+    
+    Matrix<double> c = a * b;
+    std::cout << "A (2x3) × B (3x2) =" << std::endl;
+    for (std::size_t i = 0; i < c.rows(); ++i) {
+        std::cout << "  [" << c(i, 0) << ", " << c(i, 1) << "]" << std::endl;
+    }
+    
+    LUDecomposition<double> lu(c);
+    std::vector<double> x = lu.solve({1.0, 2.0});
+    std::cout << "Determinant of A × B: " << lu.determinant() << std::endl;
+    std::cout << "Solution of (A × B) x = [1, 2]: x = [" << x[0] << ", " << x[1] << "]" << std::endl;
+    std::cout << "Kernels in use: " << MatrixKernels::simdLevel() << std::endl;
+    
+    try {
+        std::cout << "Attempting to multiply 2x3 by 2x3..." << std::endl;
+        a * a;
+    } catch (const std::exception& e) {
+        std::cout << "Error caught: " << e.what() << std::endl;
+    }
+}
+
 int main() {
     std::cout << "Welcome to the Calculator Demo - CMake Build!" << std::endl;
     std::cout << "This project demonstrates the CMake build system." << std::endl;
@@ -69,6 +102,7 @@ int main() {
     demonstrateBasicOperations();
     demonstrateAdvancedOperations();
     demonstrateErrorHandling();
+    demonstrateMatrixOperations();
     
     printHeader("CMAKE BUILD SYSTEM INFORMATION");
     std::cout << "This program was compiled using:" << std::endl;
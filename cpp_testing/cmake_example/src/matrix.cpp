@@ -0,0 +1,301 @@
+#include "matrix.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define MATRIX_HAS_AVX2_KERNEL 1
+#endif
+
+/**
+ * Matrix kernels for double
+ *
+ * GEMM follows the usual three-level blocking:
+ *   - B is copied KC rows x NC columns at a time into "panels" of NR
+ *     columns, A is copied MC rows x KC columns at a time into panels of MR
+ *     rows, so the micro-kernel reads both operands sequentially;
+ *   - the micro-kernel keeps an MR x NR block of C in registers for the
+ *     whole KC loop and writes it back once;
+ *   - KC x NR of B stays in L1, MC x KC of A in L2, KC x NC of B in L3.
+ * The instruction set is picked once at startup, so one binary runs on any
+ * x86-64 and still uses AVX2/FMA when the CPU has them.
+ */
+
+namespace {
+
+constexpr std::size_t MR = 6;     // Rows of C per micro-kernel call
+constexpr std::size_t NR = 8;     // Columns of C per micro-kernel call
+constexpr std::size_t KC = 256;   // Depth of one packed panel
+constexpr std::size_t MC = 96;    // Rows of A packed at once (multiple of MR)
+constexpr std::size_t NC = 2048;  // Columns of B packed at once (multiple of NR)
+
+// Below this many multiply-adds a second thread costs more than it saves
+constexpr std::size_t MinWorkPerThread = std::size_t(1) << 21;
+
+using AlignedBuffer = std::vector<double, AlignedAllocator<double>>;
+
+// MR x NR block of C += packed A panel * packed B panel; mr/nr < MR/NR at edges
+using MicroKernel = void (*)(std::size_t kc, const double* a, const double* b,
+                             double* c, std::size_t ldc, std::size_t mr, std::size_t nr);
+
+void addTile(const double* tile, double* c, std::size_t ldc, std::size_t mr, std::size_t nr) {
+    for (std::size_t i = 0; i < mr; ++i) {
+        for (std::size_t j = 0; j < nr; ++j) c[i * ldc + j] += tile[i * NR + j];
+    }
+}
+
+// Portable kernel; the compiler vectorises the inner loop with SSE2
+void microKernelGeneric(std::size_t kc, const double* a, const double* b,
+                        double* c, std::size_t ldc, std::size_t mr, std::size_t nr) {
+    alignas(64) double tile[MR * NR] = {};
+    for (std::size_t p = 0; p < kc; ++p) {
+        for (std::size_t i = 0; i < MR; ++i) {
+            double ai = a[i];
+            for (std::size_t j = 0; j < NR; ++j) tile[i * NR + j] += ai * b[j];
+        }
+        a += MR;
+        b += NR;
+    }
+    addTile(tile, c, ldc, mr, nr);
+}
+
+#ifdef MATRIX_HAS_AVX2_KERNEL
+// 12 accumulators + 2 B vectors + 1 broadcast = 15 of the 16 ymm registers
+__attribute__((target("avx2,fma")))
+void microKernelAvx2(std::size_t kc, const double* a, const double* b,
+                     double* c, std::size_t ldc, std::size_t mr, std::size_t nr) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+    for (std::size_t p = 0; p < kc; ++p) {
+        __m256d b0 = _mm256_load_pd(b);
+        __m256d b1 = _mm256_load_pd(b + 4);
+        __m256d ai;
+        ai = _mm256_broadcast_sd(a + 0); c00 = _mm256_fmadd_pd(ai, b0, c00); c01 = _mm256_fmadd_pd(ai, b1, c01);
+        ai = _mm256_broadcast_sd(a + 1); c10 = _mm256_fmadd_pd(ai, b0, c10); c11 = _mm256_fmadd_pd(ai, b1, c11);
+        ai = _mm256_broadcast_sd(a + 2); c20 = _mm256_fmadd_pd(ai, b0, c20); c21 = _mm256_fmadd_pd(ai, b1, c21);
+        ai = _mm256_broadcast_sd(a + 3); c30 = _mm256_fmadd_pd(ai, b0, c30); c31 = _mm256_fmadd_pd(ai, b1, c31);
+        ai = _mm256_broadcast_sd(a + 4); c40 = _mm256_fmadd_pd(ai, b0, c40); c41 = _mm256_fmadd_pd(ai, b1, c41);
+        ai = _mm256_broadcast_sd(a + 5); c50 = _mm256_fmadd_pd(ai, b0, c50); c51 = _mm256_fmadd_pd(ai, b1, c51);
+        a += MR;
+        b += NR;
+    }
+
+    if (mr == MR && nr == NR) {
+        const __m256d rows[MR][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+        for (std::size_t i = 0; i < MR; ++i) {
+            double* row = c + i * ldc;
+            _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), rows[i][0]));
+            _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), rows[i][1]));
+        }
+        return;
+    }
+    alignas(64) double tile[MR * NR];
+    _mm256_store_pd(tile + 0, c00);  _mm256_store_pd(tile + 4, c01);
+    _mm256_store_pd(tile + 8, c10);  _mm256_store_pd(tile + 12, c11);
+    _mm256_store_pd(tile + 16, c20); _mm256_store_pd(tile + 20, c21);
+    _mm256_store_pd(tile + 24, c30); _mm256_store_pd(tile + 28, c31);
+    _mm256_store_pd(tile + 32, c40); _mm256_store_pd(tile + 36, c41);
+    _mm256_store_pd(tile + 40, c50); _mm256_store_pd(tile + 44, c51);
+    addTile(tile, c, ldc, mr, nr);
+}
+
+__attribute__((target("avx2,fma")))
+void gemvAvx2(std::size_t m, std::size_t n, const double* a, std::size_t lda, const double* x, double* y) {
+    std::size_t i = 0;
+    for (; i + 4 <= m; i += 4) {
+        const double* r0 = a + i * lda;
+        const double* r1 = r0 + lda;
+        const double* r2 = r1 + lda;
+        const double* r3 = r2 + lda;
+        __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+        __m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+        std::size_t j = 0;
+        for (; j + 4 <= n; j += 4) {
+            __m256d xj = _mm256_loadu_pd(x + j);
+            s0 = _mm256_fmadd_pd(_mm256_loadu_pd(r0 + j), xj, s0);
+            s1 = _mm256_fmadd_pd(_mm256_loadu_pd(r1 + j), xj, s1);
+            s2 = _mm256_fmadd_pd(_mm256_loadu_pd(r2 + j), xj, s2);
+            s3 = _mm256_fmadd_pd(_mm256_loadu_pd(r3 + j), xj, s3);
+        }
+        // Horizontal sums of the four accumulators in one vector
+        __m256d h01 = _mm256_hadd_pd(s0, s1);
+        __m256d h23 = _mm256_hadd_pd(s2, s3);
+        __m256d sums = _mm256_add_pd(_mm256_permute2f128_pd(h01, h23, 0x20),
+                                     _mm256_permute2f128_pd(h01, h23, 0x31));
+        alignas(32) double out[4];
+        _mm256_store_pd(out, sums);
+        for (; j < n; ++j) {
+            out[0] += r0[j] * x[j];
+            out[1] += r1[j] * x[j];
+            out[2] += r2[j] * x[j];
+            out[3] += r3[j] * x[j];
+        }
+        y[i] = out[0];
+        y[i + 1] = out[1];
+        y[i + 2] = out[2];
+        y[i + 3] = out[3];
+    }
+    for (; i < m; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < n; ++j) sum += a[i * lda + j] * x[j];
+        y[i] = sum;
+    }
+}
+#endif
+
+bool cpuHasAvx2() {
+#ifdef MATRIX_HAS_AVX2_KERNEL
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+MicroKernel selectMicroKernel() {
+#ifdef MATRIX_HAS_AVX2_KERNEL
+    if (cpuHasAvx2()) return microKernelAvx2;
+#endif
+    return microKernelGeneric;
+}
+
+// Copies mc x kc of A, scaled by alpha, into MR-row panels, zero-padding the last
+void packA(std::size_t mc, std::size_t kc, double alpha, const double* a, std::size_t lda, double* packed) {
+    for (std::size_t i = 0; i < mc; i += MR) {
+        std::size_t rows = std::min(MR, mc - i);
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t r = 0; r < rows; ++r) packed[r] = alpha * a[(i + r) * lda + p];
+            for (std::size_t r = rows; r < MR; ++r) packed[r] = 0.0;
+            packed += MR;
+        }
+    }
+}
+
+// Copies kc x nc of B into NR-column panels, zero-padding the last
+void packB(std::size_t kc, std::size_t nc, const double* b, std::size_t ldb, double* packed) {
+    for (std::size_t j = 0; j < nc; j += NR) {
+        std::size_t cols = std::min(NR, nc - j);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const double* row = b + p * ldb + j;
+            for (std::size_t c = 0; c < cols; ++c) packed[c] = row[c];
+            for (std::size_t c = cols; c < NR; ++c) packed[c] = 0.0;
+            packed += NR;
+        }
+    }
+}
+
+// The whole blocked algorithm on one rectangle of C; each thread runs one
+void gemmBlock(std::size_t m, std::size_t n, std::size_t k, double alpha,
+               const double* a, std::size_t lda, const double* b, std::size_t ldb,
+               double* c, std::size_t ldc) {
+    static const MicroKernel kernel = selectMicroKernel();
+    AlignedBuffer packedA(MC * KC);
+    AlignedBuffer packedB(KC * std::min(NC, (n + NR - 1) / NR * NR));
+
+    for (std::size_t jc = 0; jc < n; jc += NC) {
+        std::size_t nc = std::min(NC, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += KC) {
+            std::size_t kc = std::min(KC, k - pc);
+            packB(kc, nc, b + pc * ldb + jc, ldb, packedB.data());
+            for (std::size_t ic = 0; ic < m; ic += MC) {
+                std::size_t mc = std::min(MC, m - ic);
+                packA(mc, kc, alpha, a + ic * lda + pc, lda, packedA.data());
+                for (std::size_t jr = 0; jr < nc; jr += NR) {
+                    const double* panelB = packedB.data() + jr * kc;
+                    for (std::size_t ir = 0; ir < mc; ir += MR) {
+                        kernel(kc, packedA.data() + ir * kc, panelB,
+                               c + (ic + ir) * ldc + jc + jr, ldc,
+                               std::min(MR, mc - ir), std::min(NR, nc - jr));
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+namespace MatrixKernels {
+
+void gemm(std::size_t m, std::size_t n, std::size_t k, double alpha,
+          const double* a, std::size_t lda, const double* b, std::size_t ldb,
+          double* c, std::size_t ldc, unsigned threads) {
+    if (m == 0 || n == 0 || k == 0) return;
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t work = m * n * k;
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, std::max<std::size_t>(1, work / MinWorkPerThread)));
+
+    // Split the longer side of C into stripes of whole micro-tiles
+    bool splitRows = m >= n;
+    std::size_t step = splitRows ? MR : NR;
+    std::size_t tiles = ((splitRows ? m : n) + step - 1) / step;
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, tiles));
+    if (threads <= 1) {
+        gemmBlock(m, n, k, alpha, a, lda, b, ldb, c, ldc);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    auto runStripe = [&](unsigned t) {
+        std::size_t first = tiles * t / threads * step;
+        std::size_t last = std::min(tiles * (t + 1) / threads * step, splitRows ? m : n);
+        if (splitRows) {
+            gemmBlock(last - first, n, k, alpha, a + first * lda, lda, b, ldb, c + first * ldc, ldc);
+        } else {
+            gemmBlock(m, last - first, k, alpha, a, lda, b + first, ldb, c + first, ldc);
+        }
+    };
+    for (unsigned t = 1; t < threads; ++t) workers.emplace_back(runStripe, t);
+    runStripe(0);
+    for (std::thread& worker : workers) worker.join();
+}
+
+void gemv(std::size_t m, std::size_t n, const double* a, std::size_t lda, const double* x, double* y) {
+#ifdef MATRIX_HAS_AVX2_KERNEL
+    if (cpuHasAvx2()) {
+        gemvAvx2(m, n, a, lda, x, y);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < m; ++i) {
+        const double* row = a + i * lda;
+        double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+        std::size_t j = 0;
+        for (; j + 4 <= n; j += 4) {
+            s0 += row[j] * x[j];
+            s1 += row[j + 1] * x[j + 1];
+            s2 += row[j + 2] * x[j + 2];
+            s3 += row[j + 3] * x[j + 3];
+        }
+        for (; j < n; ++j) s0 += row[j] * x[j];
+        y[i] = (s0 + s1) + (s2 + s3);
+    }
+}
+
+void transpose(std::size_t rows, std::size_t cols, const double* in, std::size_t ldin,
+               double* out, std::size_t ldout) {
+    // 32 x 32 doubles = 8 KiB per tile: source and destination tiles fit in L1
+    constexpr std::size_t Tile = 32;
+    for (std::size_t i0 = 0; i0 < rows; i0 += Tile) {
+        std::size_t i1 = std::min(rows, i0 + Tile);
+        for (std::size_t j0 = 0; j0 < cols; j0 += Tile) {
+            std::size_t j1 = std::min(cols, j0 + Tile);
+            for (std::size_t i = i0; i < i1; ++i) {
+                for (std::size_t j = j0; j < j1; ++j) out[j * ldout + i] = in[i * ldin + j];
+            }
+        }
+    }
+}
+
+const char* simdLevel() {
+    return cpuHasAvx2() ? "AVX2+FMA" : "generic";
+}
+
+} // namespace MatrixKernels
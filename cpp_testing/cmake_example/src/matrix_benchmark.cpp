@@ -0,0 +1,200 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "calculator.hpp"
+#include "matrix.hpp"
+
+/**
+ * Matrix module self-check and benchmark
+ *
+ * Checks GEMM, GEMV, transpose and LU against straightforward loops on
+ * awkward sizes, then reports GFLOPS for:
+ *   - Calculator loop: i-j-k triple loop calling Calculator::multiply/add,
+ *     the way matrix math was built on the calculator so far
+ *   - naive loop:      the same triple loop on plain doubles
+ *   - blocked GEMM:    Matrix::multiply on 1 thread and on every core
+ *   - LU:              LUDecomposition (2/3 n^3 flops)
+ *
+ * Usage: matrix_benchmark [max size] [threads]
+ */
+
+using Clock = std::chrono::steady_clock;
+
+static double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static Matrix<double> randomMatrix(std::size_t rows, std::size_t cols, std::mt19937_64& rng) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix<double> m(rows, cols);
+    for (std::size_t i = 0; i < rows * cols; ++i) m.data()[i] = dist(rng);
+    return m;
+}
+
+static Matrix<double> naiveMultiply(const Matrix<double>& a, const Matrix<double>& b) {
+    Matrix<double> c(a.rows(), b.cols());
+    for (std::size_t i = 0; i < a.rows(); ++i) {
+        for (std::size_t j = 0; j < b.cols(); ++j) {
+            double sum = 0.0;
+            for (std::size_t p = 0; p < a.cols(); ++p) sum += a(i, p) * b(p, j);
+            c(i, j) = sum;
+        }
+    }
+    return c;
+}
+
+static Matrix<double> calculatorMultiply(const Matrix<double>& a, const Matrix<double>& b) {
+    Matrix<double> c(a.rows(), b.cols());
+    for (std::size_t i = 0; i < a.rows(); ++i) {
+        for (std::size_t j = 0; j < b.cols(); ++j) {
+            double sum = 0.0;
+            for (std::size_t p = 0; p < a.cols(); ++p) sum = Calculator::add(sum, Calculator::multiply(a(i, p), b(p, j)));
+            c(i, j) = sum;
+        }
+    }
+    return c;
+}
+
+static double maxDifference(const Matrix<double>& a, const Matrix<double>& b) {
+    if (a.rows() != b.rows() || a.cols() != b.cols()) {
+        throw std::runtime_error("Matrix shapes differ!");
+    }
+    double worst = 0.0;
+    for (std::size_t i = 0; i < a.rows() * a.cols(); ++i) {
+        worst = std::max(worst, std::abs(a.data()[i] - b.data()[i]));
+    }
+    return worst;
+}
+
+static void expectClose(double error, double tolerance, const std::string& what) {
+    if (!(error <= tolerance)) {
+        throw std::runtime_error(what + " differs by " + std::to_string(error));
+    }
+}
+
+// Runs fn until at least 0.2 s has passed and returns the best time of one run
+template<typename Function>
+static double bestSeconds(Function fn) {
+    double best = 1e30, total = 0.0;
+    do {
+        auto start = Clock::now();
+        fn();
+        double elapsed = secondsSince(start);
+        best = std::min(best, elapsed);
+        total += elapsed;
+    } while (total < 0.2);
+    return best;
+}
+
+static void checkCorrectness(unsigned threads, std::mt19937_64& rng) {
+    std::cout << "1. Correctness (kernels: " << MatrixKernels::simdLevel() << ")" << std::endl;
+
+    const std::size_t shapes[][3] = {{1, 1, 1}, {7, 13, 5}, {6, 8, 256}, {97, 131, 67},
+                                     {300, 257, 301}, {513, 70, 9}, {20, 600, 40}};
+    for (const auto& shape : shapes) {
+        Matrix<double> a = randomMatrix(shape[0], shape[1], rng);
+        Matrix<double> b = randomMatrix(shape[1], shape[2], rng);
+        Matrix<double> expected = naiveMultiply(a, b);
+        for (unsigned t : {1u, threads, 3u}) {
+            expectClose(maxDifference(a.multiply(b, t), expected), 1e-12 * static_cast<double>(shape[1]), "GEMM");
+        }
+    }
+    std::cout << "   GEMM matches the naive loop on " << sizeof(shapes) / sizeof(shapes[0]) << " shapes" << std::endl;
+
+    Matrix<double> wide = randomMatrix(83, 301, rng);
+    Matrix<double> wideT = wide.transpose();
+    for (std::size_t i = 0; i < wide.rows(); ++i) {
+        for (std::size_t j = 0; j < wide.cols(); ++j) {
+            if (wide(i, j) != wideT(j, i)) throw std::runtime_error("Transpose is wrong!");
+        }
+    }
+    if (!(wideT.transpose() == wide)) throw std::runtime_error("Double transpose is not the identity!");
+    std::cout << "   transpose of 83x301 verified" << std::endl;
+
+    Matrix<double> x = randomMatrix(wide.cols(), 1, rng);
+    std::vector<double> xv(x.data(), x.data() + x.rows());
+    std::vector<double> y = wide.multiply(xv);
+    Matrix<double> yExpected = naiveMultiply(wide, x);
+    double gemvError = 0.0;
+    for (std::size_t i = 0; i < y.size(); ++i) gemvError = std::max(gemvError, std::abs(y[i] - yExpected(i, 0)));
+    expectClose(gemvError, 1e-12 * static_cast<double>(wide.cols()), "GEMV");
+    std::cout << "   GEMV matches the naive loop" << std::endl;
+
+    Matrix<double> small(3, 3);
+    const double values[] = {2, -1, 0, -1, 2, -1, 0, -1, 2};
+    std::copy(values, values + 9, small.data());
+    expectClose(std::abs(LUDecomposition<double>(small).determinant() - 4.0), 1e-12, "LU determinant");
+
+    for (std::size_t n : {5, 64, 200, 333}) {
+        Matrix<double> a = randomMatrix(n, n, rng);
+        std::vector<double> b(n);
+        for (std::size_t i = 0; i < n; ++i) b[i] = static_cast<double>(i % 7) - 3.0;
+        std::vector<double> solution = LUDecomposition<double>(a, threads).solve(b);
+        std::vector<double> residual = a.multiply(solution);
+        double worst = 0.0;
+        for (std::size_t i = 0; i < n; ++i) worst = std::max(worst, std::abs(residual[i] - b[i]));
+        expectClose(worst, 1e-8, "LU residual for n=" + std::to_string(n));
+    }
+    std::cout << "   LU solves random systems up to 333x333, residual < 1e-8" << std::endl;
+
+    try {
+        LUDecomposition<double> singular(Matrix<double>(4, 4, 1.0));
+        throw std::logic_error("Singular matrix was not detected!");
+    } catch (const std::runtime_error& e) {
+        std::cout << "   singular matrix rejected: " << e.what() << std::endl;
+    }
+}
+
+static void runBenchmark(std::size_t maxSize, unsigned threads, std::mt19937_64& rng) {
+    std::cout << "\n2. GFLOPS (square matrices; GEMM xN and LU use N = " << threads << " thread(s))" << std::endl;
+    std::cout << std::setw(6) << "n" << std::setw(13) << "Calculator" << std::setw(10) << "naive"
+              << std::setw(13) << "GEMM x1" << std::setw(13) << "GEMM xN" << std::setw(10) << "LU"
+              << std::setw(12) << "vs naive" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (std::size_t n = 64; n <= maxSize; n *= 2) {
+        Matrix<double> a = randomMatrix(n, n, rng);
+        Matrix<double> b = randomMatrix(n, n, rng);
+        double flops = 2.0 * static_cast<double>(n) * static_cast<double>(n) * static_cast<double>(n);
+        // The simple loops take minutes beyond 1024
+        bool runLoops = n <= 1024;
+
+        double calculator = runLoops ? flops / bestSeconds([&] { calculatorMultiply(a, b); }) * 1e-9 : 0.0;
+        double naive = runLoops ? flops / bestSeconds([&] { naiveMultiply(a, b); }) * 1e-9 : 0.0;
+        double single = flops / bestSeconds([&] { a.multiply(b, 1); }) * 1e-9;
+        double parallel = flops / bestSeconds([&] { a.multiply(b, threads); }) * 1e-9;
+        double lu = flops / 3.0 / bestSeconds([&] { LUDecomposition<double>(a, threads); }) * 1e-9;
+
+        std::cout << std::setw(6) << n << std::setw(13) << calculator << std::setw(10) << naive
+                  << std::setw(13) << single << std::setw(13) << parallel << std::setw(10) << lu;
+        if (runLoops) std::cout << std::setw(11) << std::max(single, parallel) / naive << "x";
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "Matrix Module Benchmark - CMake Build!" << std::endl;
+
+    try {
+        std::size_t maxSize = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1024;
+        unsigned threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+                                    : std::max(1u, std::thread::hardware_concurrency());
+        std::mt19937_64 rng(2024);
+
+        checkCorrectness(threads, rng);
+        runBenchmark(maxSize, threads, rng);
+
+        std::cout << "\n✅ Matrix checks passed" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,452 @@
+#include "montecarlo.hpp"
+#include "statistics.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define MONTECARLO_HAS_AVX2_KERNEL 1
+#endif
+
+/**
+ * Monte Carlo implementation
+ *
+ * The AVX2 kernels run four Philox blocks side by side (one per 64-bit
+ * lane, _mm256_mul_epu32 gives the 32x32->64 products) and evaluate log,
+ * sin/cos and exp with the fdlibm polynomials on four doubles at a time.
+ * The uniforms are exact integer arithmetic and identical on both paths;
+ * the transcendental functions agree with the C library to about 1e-15.
+ */
+
+namespace {
+
+constexpr std::uint32_t PhiloxM0 = 0xD2511F53u;
+constexpr std::uint32_t PhiloxM1 = 0xCD9E8D57u;
+constexpr std::uint32_t PhiloxW0 = 0x9E3779B9u;  // Key increments per round
+constexpr std::uint32_t PhiloxW1 = 0xBB67AE85u;
+constexpr int PhiloxRounds = 10;
+
+constexpr double TwoPi = 6.28318530717958647692;
+
+// 52 random bits to (0, 1); never exactly 0, so log() is always finite
+double toUniform(std::uint32_t low, std::uint32_t high) {
+    std::uint64_t bits = (static_cast<std::uint64_t>(high) << 32) | low;
+    return (static_cast<double>(bits >> 12) + 0.5) * 0x1.0p-52;
+}
+
+void uniformBlocksGeneric(const Philox4x32::Key& key, std::uint64_t streamId, std::uint64_t firstBlock,
+                          std::size_t blocks, double* out) {
+    for (std::size_t i = 0; i < blocks; ++i) {
+        std::uint64_t block = firstBlock + i;
+        Philox4x32::Counter counter = {static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32),
+                                       static_cast<std::uint32_t>(streamId), static_cast<std::uint32_t>(streamId >> 32)};
+        Philox4x32::Counter r = Philox4x32::generate(counter, key);
+        out[2 * i] = toUniform(r[0], r[1]);
+        out[2 * i + 1] = toUniform(r[2], r[3]);
+    }
+}
+
+void boxMullerGeneric(double* values, std::size_t n) {
+    std::size_t j = 0;
+    for (; j + 8 <= n; j += 8) {
+        for (std::size_t i = j; i < j + 4; ++i) {
+            double radius = std::sqrt(-2.0 * std::log(values[i]));
+            double angle = TwoPi * values[i + 4];
+            values[i] = radius * std::cos(angle);
+            values[i + 4] = radius * std::sin(angle);
+        }
+    }
+    for (; j + 2 <= n; j += 2) {
+        double radius = std::sqrt(-2.0 * std::log(values[j]));
+        double angle = TwoPi * values[j + 1];
+        values[j] = radius * std::cos(angle);
+        values[j + 1] = radius * std::sin(angle);
+    }
+}
+
+void expGeneric(double* values, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) values[i] = std::exp(values[i]);
+}
+
+#ifdef MONTECARLO_HAS_AVX2_KERNEL
+// Same result as toUniform(): the 52 bits become the mantissa of a double in [1, 2)
+__attribute__((target("avx2,fma")))
+__m256d toUniformAvx2(__m256i low, __m256i high) {
+    __m256i bits = _mm256_or_si256(_mm256_slli_epi64(high, 32), low);
+    __m256i oneToTwo = _mm256_or_si256(_mm256_srli_epi64(bits, 12), _mm256_set1_epi64x(0x3FF0000000000000ll));
+    __m256d value = _mm256_sub_pd(_mm256_castsi256_pd(oneToTwo), _mm256_set1_pd(1.0));
+    return _mm256_add_pd(value, _mm256_set1_pd(0x1.0p-53));
+}
+
+// Four blocks per iteration; each 64-bit lane holds one 32-bit counter word
+__attribute__((target("avx2,fma")))
+void uniformBlocksAvx2(const Philox4x32::Key& key, std::uint64_t streamId, std::uint64_t firstBlock,
+                       std::size_t blocks, double* out) {
+    const __m256i low32 = _mm256_set1_epi64x(0xFFFFFFFFll);
+    const __m256i m0 = _mm256_set1_epi64x(PhiloxM0);
+    const __m256i m1 = _mm256_set1_epi64x(PhiloxM1);
+    const __m256i stream0 = _mm256_set1_epi64x(static_cast<std::uint32_t>(streamId));
+    const __m256i stream1 = _mm256_set1_epi64x(static_cast<std::uint32_t>(streamId >> 32));
+    const __m256i lanes = _mm256_set_epi64x(3, 2, 1, 0);
+
+    std::size_t i = 0;
+    for (; i + 4 <= blocks; i += 4) {
+        __m256i index = _mm256_add_epi64(_mm256_set1_epi64x(static_cast<long long>(firstBlock + i)), lanes);
+        __m256i x0 = _mm256_and_si256(index, low32);
+        __m256i x1 = _mm256_srli_epi64(index, 32);
+        __m256i x2 = stream0;
+        __m256i x3 = stream1;
+        std::uint32_t k0 = key[0], k1 = key[1];
+        for (int round = 0; round < PhiloxRounds; ++round) {
+            __m256i p0 = _mm256_mul_epu32(x0, m0);
+            __m256i p1 = _mm256_mul_epu32(x2, m1);
+            __m256i y0 = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p1, 32), x1), _mm256_set1_epi64x(k0));
+            __m256i y2 = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p0, 32), x3), _mm256_set1_epi64x(k1));
+            x1 = _mm256_and_si256(p1, low32);
+            x3 = _mm256_and_si256(p0, low32);
+            x0 = y0;
+            x2 = y2;
+            k0 += PhiloxW0;
+            k1 += PhiloxW1;
+        }
+        // a = first uniform of each block, b = second; store interleaved
+        __m256d a = toUniformAvx2(x0, x1);
+        __m256d b = toUniformAvx2(x2, x3);
+        __m256d even = _mm256_unpacklo_pd(a, b);
+        __m256d odd = _mm256_unpackhi_pd(a, b);
+        _mm256_storeu_pd(out + 2 * i, _mm256_permute2f128_pd(even, odd, 0x20));
+        _mm256_storeu_pd(out + 2 * i + 4, _mm256_permute2f128_pd(even, odd, 0x31));
+    }
+    uniformBlocksGeneric(key, streamId, firstBlock + i, blocks - i, out + 2 * i);
+}
+
+// Natural log of positive normal doubles (fdlibm e_log.c)
+__attribute__((target("avx2,fma")))
+__m256d logAvx2(__m256d x) {
+    const __m256d one = _mm256_set1_pd(1.0);
+    __m256i bits = _mm256_castpd_si256(x);
+    __m256d mantissa = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFll)), _mm256_set1_epi64x(0x3FF0000000000000ll)));
+    __m256i biasedExponent = _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(0x4330000000000000ll));
+    __m256d exponent = _mm256_sub_pd(_mm256_castsi256_pd(biasedExponent), _mm256_set1_pd(0x1.0p52 + 1023.0));
+
+    // Mantissa into [sqrt(2)/2, sqrt(2))
+    __m256d large = _mm256_cmp_pd(mantissa, _mm256_set1_pd(1.41421356237309504880), _CMP_GT_OQ);
+    mantissa = _mm256_blendv_pd(mantissa, _mm256_mul_pd(mantissa, _mm256_set1_pd(0.5)), large);
+    exponent = _mm256_add_pd(exponent, _mm256_and_pd(large, one));
+
+    __m256d f = _mm256_sub_pd(mantissa, one);
+    __m256d s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+    __m256d z = _mm256_mul_pd(s, s);
+    __m256d w = _mm256_mul_pd(z, z);
+    __m256d t1 = _mm256_fmadd_pd(w, _mm256_set1_pd(1.531383769920937332e-01), _mm256_set1_pd(2.222219843214978396e-01));
+    t1 = _mm256_fmadd_pd(w, t1, _mm256_set1_pd(3.999999999940941908e-01));
+    t1 = _mm256_mul_pd(w, t1);
+    __m256d t2 = _mm256_fmadd_pd(w, _mm256_set1_pd(1.479819860511658591e-01), _mm256_set1_pd(1.818357216161805012e-01));
+    t2 = _mm256_fmadd_pd(w, t2, _mm256_set1_pd(2.857142874366239149e-01));
+    t2 = _mm256_fmadd_pd(w, t2, _mm256_set1_pd(6.666666666666735130e-01));
+    t2 = _mm256_mul_pd(z, t2);
+    __m256d r = _mm256_add_pd(t1, t2);
+    __m256d halfSquare = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), f), f);
+
+    // k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f)
+    __m256d tail = _mm256_fmadd_pd(s, _mm256_add_pd(halfSquare, r),
+                                   _mm256_mul_pd(exponent, _mm256_set1_pd(1.90821492927058770002e-10)));
+    __m256d result = _mm256_sub_pd(_mm256_sub_pd(halfSquare, tail), f);
+    return _mm256_fmsub_pd(exponent, _mm256_set1_pd(6.93147180369123816490e-01), result);
+}
+
+// sin and cos of 2 * pi * u (fdlibm k_sin.c / k_cos.c on [-pi/4, pi/4])
+__attribute__((target("avx2,fma")))
+void sinCosTwoPiAvx2(__m256d u, __m256d& sine, __m256d& cosine) {
+    const int nearest = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+    __m256d x = _mm256_sub_pd(u, _mm256_round_pd(u, nearest));                   // [-1/2, 1/2] turns
+    __m256d quadrant = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(4.0)), nearest);  // -2 .. 2
+    __m256d a = _mm256_mul_pd(_mm256_fnmadd_pd(quadrant, _mm256_set1_pd(0.25), x), _mm256_set1_pd(TwoPi));
+    __m256d z = _mm256_mul_pd(a, a);
+
+    __m256d ps = _mm256_fmadd_pd(z, _mm256_set1_pd(1.58969099521155010221e-10), _mm256_set1_pd(-2.50507602534068634195e-08));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(2.75573137070700676789e-06));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(-1.98412698298579493134e-04));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(8.33333333332248946124e-03));
+    ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(-1.66666666666666324348e-01));
+    __m256d s = _mm256_fmadd_pd(_mm256_mul_pd(z, a), ps, a);
+
+    __m256d pc = _mm256_fmadd_pd(z, _mm256_set1_pd(-1.13596475577881948265e-11), _mm256_set1_pd(2.08757232129817482790e-09));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(-2.75573143513906633035e-07));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(2.48015872894767294178e-05));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(-1.38888888888741095749e-03));
+    pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(4.16666666666666019037e-02));
+    __m256d c = _mm256_fmadd_pd(_mm256_mul_pd(z, z), pc, _mm256_fnmadd_pd(_mm256_set1_pd(0.5), z, _mm256_set1_pd(1.0)));
+
+    // Rotate by quadrant * pi/2: q & 1 swaps sin and cos, q & 2 negates sin, (q + 1) & 2 negates cos
+    __m256i q = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(quadrant, _mm256_set1_pd(0x1.8p52))),
+                                 _mm256_castpd_si256(_mm256_set1_pd(0x1.8p52)));
+    __m256d swap = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(q, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(1)));
+    __m256d sineSign = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(q, _mm256_set1_epi64x(2)), 62));
+    __m256d cosineSign = _mm256_castsi256_pd(
+        _mm256_slli_epi64(_mm256_and_si256(_mm256_add_epi64(q, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(2)), 62));
+    sine = _mm256_xor_pd(_mm256_blendv_pd(s, c, swap), sineSign);
+    cosine = _mm256_xor_pd(_mm256_blendv_pd(c, s, swap), cosineSign);
+}
+
+__attribute__((target("avx2,fma")))
+void boxMullerAvx2(double* values, std::size_t n) {
+    std::size_t j = 0;
+    for (; j + 8 <= n; j += 8) {
+        __m256d u1 = _mm256_loadu_pd(values + j);
+        __m256d u2 = _mm256_loadu_pd(values + j + 4);
+        __m256d radius = _mm256_sqrt_pd(_mm256_mul_pd(_mm256_set1_pd(-2.0), logAvx2(u1)));
+        __m256d sine, cosine;
+        sinCosTwoPiAvx2(u2, sine, cosine);
+        _mm256_storeu_pd(values + j, _mm256_mul_pd(radius, cosine));
+        _mm256_storeu_pd(values + j + 4, _mm256_mul_pd(radius, sine));
+    }
+    boxMullerGeneric(values + j, n - j);
+}
+
+// e^x (fdlibm e_exp.c), x clamped to [-708, 709] so the result stays a normal double
+__attribute__((target("avx2,fma")))
+void expAvx2(double* values, std::size_t n) {
+    const __m256d magic = _mm256_set1_pd(0x1.8p52);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(values + i);
+        x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(-708.0)), _mm256_set1_pd(709.0));
+        __m256d k = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.44269504088896338700e+00)),
+                                    _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256d hi = _mm256_fnmadd_pd(k, _mm256_set1_pd(6.93147180369123816490e-01), x);
+        __m256d lo = _mm256_mul_pd(k, _mm256_set1_pd(1.90821492927058770002e-10));
+        __m256d r = _mm256_sub_pd(hi, lo);
+        __m256d t = _mm256_mul_pd(r, r);
+        __m256d p = _mm256_fmadd_pd(t, _mm256_set1_pd(4.13813679705723846039e-08), _mm256_set1_pd(-1.65339022054652515390e-06));
+        p = _mm256_fmadd_pd(t, p, _mm256_set1_pd(6.61375632143793436117e-05));
+        p = _mm256_fmadd_pd(t, p, _mm256_set1_pd(-2.77777777770155933842e-03));
+        p = _mm256_fmadd_pd(t, p, _mm256_set1_pd(1.66666666666666019037e-01));
+        __m256d c = _mm256_fnmadd_pd(t, p, r);
+
+        // 1 - ((lo - r * c / (2 - c)) - hi), then scaled by 2^k through the exponent bits
+        __m256d ratio = _mm256_div_pd(_mm256_mul_pd(r, c), _mm256_sub_pd(_mm256_set1_pd(2.0), c));
+        __m256d y = _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_sub_pd(_mm256_sub_pd(lo, ratio), hi));
+        __m256i scale = _mm256_slli_epi64(
+            _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(k, magic)), _mm256_castpd_si256(magic)), 52);
+        _mm256_storeu_pd(values + i, _mm256_castsi256_pd(_mm256_add_epi64(_mm256_castpd_si256(y), scale)));
+    }
+    expGeneric(values + i, n - i);
+}
+#endif
+
+bool cpuHasAvx2() {
+#ifdef MONTECARLO_HAS_AVX2_KERNEL
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+void checkContract(const GbmModel& model, double strike) {
+    if (!(model.spot > 0.0)) {
+        throw std::invalid_argument("Spot price must be positive!");
+    }
+    if (!(model.volatility >= 0.0)) {
+        throw std::invalid_argument("Volatility must not be negative!");
+    }
+    if (!(model.maturity > 0.0)) {
+        throw std::invalid_argument("Maturity must be positive!");
+    }
+    if (!(strike >= 0.0)) {
+        throw std::invalid_argument("Strike must not be negative!");
+    }
+}
+
+} // namespace
+
+// ======================= Philox4x32 =======================
+
+Philox4x32::Counter Philox4x32::generate(Counter x, Key key) {
+    for (int round = 0; round < PhiloxRounds; ++round) {
+        std::uint64_t p0 = static_cast<std::uint64_t>(PhiloxM0) * x[0];
+        std::uint64_t p1 = static_cast<std::uint64_t>(PhiloxM1) * x[2];
+        x = {static_cast<std::uint32_t>(p1 >> 32) ^ x[1] ^ key[0], static_cast<std::uint32_t>(p1),
+             static_cast<std::uint32_t>(p0 >> 32) ^ x[3] ^ key[1], static_cast<std::uint32_t>(p0)};
+        key[0] += PhiloxW0;
+        key[1] += PhiloxW1;
+    }
+    return x;
+}
+
+// ======================= RandomStream =======================
+
+RandomStream::RandomStream(std::uint64_t seed, std::uint64_t streamId)
+    : key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}, streamId(streamId) {}
+
+double RandomStream::nextUniform() {
+    if (hasSpare) {
+        hasSpare = false;
+        return spare;
+    }
+    double pair[2];
+    MonteCarloKernels::uniformBlocks(key, streamId, nextBlock++, 1, pair);
+    spare = pair[1];
+    hasSpare = true;
+    return pair[0];
+}
+
+void RandomStream::fillUniform(double* out, std::size_t n) {
+    if (n > 0 && hasSpare) {
+        *out++ = spare;
+        hasSpare = false;
+        --n;
+    }
+    std::size_t blocks = n / 2;
+    MonteCarloKernels::uniformBlocks(key, streamId, nextBlock, blocks, out);
+    nextBlock += blocks;
+    if (n % 2 != 0) out[n - 1] = nextUniform();
+}
+
+void RandomStream::fillNormal(double* out, std::size_t n) {
+    std::size_t even = n & ~std::size_t(1);
+    fillUniform(out, even);
+    MonteCarloKernels::boxMuller(out, even);
+    if (even != n) {
+        double pair[2];
+        fillUniform(pair, 2);
+        MonteCarloKernels::boxMuller(pair, 2);
+        out[n - 1] = pair[0];
+    }
+}
+
+void RandomStream::seek(std::uint64_t block) {
+    nextBlock = block;
+    hasSpare = false;
+}
+
+// ======================= MonteCarloKernels =======================
+
+namespace MonteCarloKernels {
+
+void uniformBlocks(const Philox4x32::Key& key, std::uint64_t streamId, std::uint64_t firstBlock,
+                   std::size_t blocks, double* out) {
+#ifdef MONTECARLO_HAS_AVX2_KERNEL
+    if (cpuHasAvx2() && blocks >= 4) {
+        uniformBlocksAvx2(key, streamId, firstBlock, blocks, out);
+        return;
+    }
+#endif
+    uniformBlocksGeneric(key, streamId, firstBlock, blocks, out);
+}
+
+void boxMuller(double* values, std::size_t n) {
+#ifdef MONTECARLO_HAS_AVX2_KERNEL
+    if (cpuHasAvx2()) {
+        boxMullerAvx2(values, n);
+        return;
+    }
+#endif
+    boxMullerGeneric(values, n);
+}
+
+void exp(double* values, std::size_t n) {
+#ifdef MONTECARLO_HAS_AVX2_KERNEL
+    if (cpuHasAvx2()) {
+        expAvx2(values, n);
+        return;
+    }
+#endif
+    expGeneric(values, n);
+}
+
+const char* simdLevel() {
+    return cpuHasAvx2() ? "AVX2" : "generic";
+}
+
+} // namespace MonteCarloKernels
+
+// ======================= MonteCarloEngine =======================
+
+MonteCarloEngine::MonteCarloEngine(std::uint64_t seed, unsigned threads)
+    : seed(seed), threads(threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads) {}
+
+MonteCarloEstimate MonteCarloEngine::run(std::uint64_t paths, const PathKernel& kernel) const {
+    if (paths == 0) {
+        throw std::invalid_argument("Monte Carlo needs at least one path!");
+    }
+
+    // Chunks are handed out dynamically, but chunk c always uses stream c
+    // and lands in parts[c], so the result does not depend on the schedule
+    std::size_t chunks = static_cast<std::size_t>((paths + PathsPerChunk - 1) / PathsPerChunk);
+    std::vector<RunningStats> parts(chunks);
+    std::atomic<std::size_t> nextChunk{0};
+    auto work = [&] {
+        std::vector<double> payoffs(PathsPerChunk);
+        for (std::size_t c = nextChunk++; c < chunks; c = nextChunk++) {
+            std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(PathsPerChunk, paths - c * PathsPerChunk));
+            RandomStream random(seed, c);
+            kernel(random, payoffs.data(), count);
+            RunningStats& stats = parts[c];
+            for (std::size_t i = 0; i < count; ++i) stats.add(payoffs[i]);
+        }
+    };
+    std::vector<std::thread> workers;
+    std::size_t workerCount = std::min<std::size_t>(threads, chunks);
+    for (std::size_t t = 1; t < workerCount; ++t) workers.emplace_back(work);
+    work();
+    for (std::thread& worker : workers) worker.join();
+    mergeParallel(parts, threads);
+
+    MonteCarloEstimate estimate;
+    estimate.paths = paths;
+    estimate.mean = parts[0].mean();
+    if (paths > 1) estimate.standardError = std::sqrt(parts[0].variance() / static_cast<double>(paths));
+    return estimate;
+}
+
+MonteCarloEstimate MonteCarloEngine::europeanCall(const GbmModel& model, double strike, std::uint64_t paths) const {
+    checkContract(model, strike);
+    double logSpot = std::log(model.spot);
+    double drift = (model.rate - 0.5 * model.volatility * model.volatility) * model.maturity;
+    double diffusion = model.volatility * std::sqrt(model.maturity);
+    double discount = std::exp(-model.rate * model.maturity);
+
+    return run(paths, [=](RandomStream& random, double* payoffs, std::size_t count) {
+        random.fillNormal(payoffs, count);
+        for (std::size_t i = 0; i < count; ++i) payoffs[i] = logSpot + drift + diffusion * payoffs[i];
+        MonteCarloKernels::exp(payoffs, count);
+        for (std::size_t i = 0; i < count; ++i) payoffs[i] = discount * std::max(payoffs[i] - strike, 0.0);
+    });
+}
+
+MonteCarloEstimate MonteCarloEngine::asianCall(const GbmModel& model, double strike, std::size_t steps,
+                                               std::uint64_t paths) const {
+    checkContract(model, strike);
+    if (steps == 0) {
+        throw std::invalid_argument("Asian option needs at least one monitoring date!");
+    }
+    double dt = model.maturity / static_cast<double>(steps);
+    double logSpot = std::log(model.spot);
+    double drift = (model.rate - 0.5 * model.volatility * model.volatility) * dt;
+    double diffusion = model.volatility * std::sqrt(dt);
+    double discount = std::exp(-model.rate * model.maturity);
+
+    // All paths of the chunk advance one step at a time, so every loop runs across paths
+    return run(paths, [=](RandomStream& random, double* payoffs, std::size_t count) {
+        std::vector<double> logPrice(count, logSpot), price(count);
+        std::fill(payoffs, payoffs + count, 0.0);
+        for (std::size_t step = 0; step < steps; ++step) {
+            random.fillNormal(price.data(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                logPrice[i] += drift + diffusion * price[i];
+                price[i] = logPrice[i];
+            }
+            MonteCarloKernels::exp(price.data(), count);
+            for (std::size_t i = 0; i < count; ++i) payoffs[i] += price[i];
+        }
+        double average = 1.0 / static_cast<double>(steps);
+        for (std::size_t i = 0; i < count; ++i) payoffs[i] = discount * std::max(payoffs[i] * average - strike, 0.0);
+    });
+}
@@ -0,0 +1,302 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "calculator.hpp"
+#include "montecarlo.hpp"
+
+/**
+ * Monte Carlo self-check and benchmark
+ *
+ * Checks the Philox streams against the published known-answer vectors,
+ * the SIMD normal and exp kernels against the C library, and the engine
+ * against the Black-Scholes price. Then compares paths/sec of:
+ *   - rand() + Calculator: one Box-Muller normal from rand() per step and
+ *     Calculator::power/multiply for the price update, one path at a time
+ *   - MonteCarloEngine: Philox batches, SIMD kernels, 1 .. max threads
+ * for a European call (1 step) and an arithmetic Asian call (64 steps).
+ *
+ * Usage: montecarlo_benchmark [paths] [max threads]
+ */
+
+using Clock = std::chrono::steady_clock;
+
+static const double TwoPi = 6.28318530717958647692;
+static const double E = 2.71828182845904523536;
+static const std::size_t AsianSteps = 64;
+static const GbmModel model{100.0, 0.05, 0.2, 1.0};
+static const double strike = 100.0;
+
+static double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        throw std::runtime_error(what);
+    }
+}
+
+static double normalCdf(double x) {
+    return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+static double blackScholesCall(const GbmModel& m, double k) {
+    double spread = m.volatility * std::sqrt(m.maturity);
+    double d1 = (std::log(m.spot / k) + (m.rate + 0.5 * m.volatility * m.volatility) * m.maturity) / spread;
+    return m.spot * normalCdf(d1) - k * std::exp(-m.rate * m.maturity) * normalCdf(d1 - spread);
+}
+
+// The existing way: one sample at a time from rand()
+static double randNormal() {
+    double u1 = (std::rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (std::rand() + 1.0) / (RAND_MAX + 2.0);
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(TwoPi * u2);
+}
+
+static MonteCarloEstimate calculatorBaseline(std::uint64_t paths, std::size_t steps) {
+    double dt = model.maturity / static_cast<double>(steps);
+    double drift = (model.rate - 0.5 * model.volatility * model.volatility) * dt;
+    double diffusion = model.volatility * std::sqrt(dt);
+    double discount = std::exp(-model.rate * model.maturity);
+    double sum = 0.0, squares = 0.0;
+    for (std::uint64_t p = 0; p < paths; ++p) {
+        double price = model.spot, total = 0.0;
+        for (std::size_t step = 0; step < steps; ++step) {
+            price = Calculator::multiply(price, Calculator::power(E, drift + diffusion * randNormal()));
+            total = Calculator::add(total, price);
+        }
+        double payoff = discount * std::max(total / static_cast<double>(steps) - strike, 0.0);
+        sum += payoff;
+        squares += payoff * payoff;
+    }
+    MonteCarloEstimate estimate;
+    estimate.paths = paths;
+    estimate.mean = sum / static_cast<double>(paths);
+    double variance = (squares - sum * estimate.mean) / static_cast<double>(paths - 1);
+    estimate.standardError = std::sqrt(variance / static_cast<double>(paths));
+    return estimate;
+}
+
+static void printEstimate(const std::string& name, const MonteCarloEstimate& estimate) {
+    std::cout << "   " << std::left << std::setw(22) << name << std::right << std::setprecision(4) << estimate.mean
+              << " +- " << estimate.standardError << "  95% CI [" << estimate.confidenceLow() << ", "
+              << estimate.confidenceHigh() << "]" << std::endl;
+}
+
+static void checkStreams() {
+    std::cout << "1. Random Streams (" << MonteCarloKernels::simdLevel() << " kernels):" << std::endl;
+
+    // Known-answer vectors from the Random123 distribution
+    struct KnownAnswer {
+        Philox4x32::Counter counter;
+        Philox4x32::Key key;
+        Philox4x32::Counter expected;
+    };
+    const KnownAnswer answers[] = {
+        {{0, 0, 0, 0}, {0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+        {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff},
+         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+        {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0},
+         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+    };
+    for (const KnownAnswer& answer : answers) {
+        expect(Philox4x32::generate(answer.counter, answer.key) == answer.expected, "Philox known answer differs");
+    }
+    std::cout << "   Philox4x32-10 matches the Random123 known answers" << std::endl;
+
+    // The SIMD blocks equal the scalar block function bit for bit
+    const std::uint64_t seed = 0x0123456789ABCDEFull, streamId = 0x100000003ull, first = 0xFFFFFFF0ull;
+    std::vector<double> batch(2 * 1003);
+    Philox4x32::Key key = {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+    MonteCarloKernels::uniformBlocks(key, streamId, first, 1003, batch.data());
+    for (std::size_t i = 0; i < 1003; ++i) {
+        std::uint64_t block = first + i;
+        Philox4x32::Counter r = Philox4x32::generate(
+            {static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32),
+             static_cast<std::uint32_t>(streamId), static_cast<std::uint32_t>(streamId >> 32)}, key);
+        std::uint64_t bits = (static_cast<std::uint64_t>(r[1]) << 32) | r[0];
+        expect(batch[2 * i] == (static_cast<double>(bits >> 12) + 0.5) * 0x1.0p-52, "Batch uniform differs");
+    }
+
+    // One at a time, in batches and after seek(): the same sequence
+    RandomStream single(seed, streamId), batched(seed, streamId);
+    std::vector<double> sequence(2001);
+    for (double& value : sequence) value = single.nextUniform();
+    std::vector<double> pieces(2001);
+    pieces[0] = batched.nextUniform();
+    batched.fillUniform(&pieces[1], 999);
+    batched.fillUniform(&pieces[1000], 1001);
+    expect(pieces == sequence, "Batched stream differs from nextUniform()");
+    RandomStream jumped(seed, streamId);
+    jumped.seek(500);
+    expect(jumped.nextUniform() == sequence[1000], "seek() lands elsewhere");
+    expect(RandomStream(seed, streamId + 1).nextUniform() != sequence[0], "Streams overlap");
+    std::cout << "   AVX2 and scalar blocks agree; batches, single draws and seek() give one sequence" << std::endl;
+}
+
+static void checkKernels(std::size_t count) {
+    std::cout << "\n2. Normal Sampling and exp():" << std::endl;
+    RandomStream stream(42, 0);
+    std::vector<double> uniforms(count);
+    stream.fillUniform(uniforms.data(), count);
+    std::vector<double> normals = uniforms;
+    MonteCarloKernels::boxMuller(normals.data(), count);
+
+    double worst = 0.0;
+    for (std::size_t j = 0; j + 8 <= count; j += 8) {
+        for (std::size_t i = j; i < j + 4; ++i) {
+            double radius = std::sqrt(-2.0 * std::log(uniforms[i]));
+            worst = std::max(worst, std::abs(normals[i] - radius * std::cos(TwoPi * uniforms[i + 4])));
+            worst = std::max(worst, std::abs(normals[i + 4] - radius * std::sin(TwoPi * uniforms[i + 4])));
+        }
+    }
+    double mean = 0.0, second = 0.0, fourth = 0.0;
+    for (double z : normals) {
+        mean += z;
+        second += z * z;
+        fourth += z * z * z * z;
+    }
+    double n = static_cast<double>(count);
+    mean /= n;
+    second /= n;
+    fourth /= n;
+    std::cout << std::scientific << std::setprecision(2) << "   Box-Muller vs libm: max |diff| " << worst << std::endl;
+    std::cout << std::fixed << std::setprecision(4) << "   " << count << " normals: mean " << mean << ", variance "
+              << second << ", kurtosis " << fourth / (second * second) << std::endl;
+    expect(worst < 1e-12, "SIMD Box-Muller differs from libm");
+    expect(std::abs(mean) < 5.0 / std::sqrt(n), "Normal mean is off");
+    expect(std::abs(second - 1.0) < 5.0 * std::sqrt(2.0 / n), "Normal variance is off");
+    expect(std::abs(fourth / (second * second) - 3.0) < 0.1, "Normal kurtosis is off");
+
+    std::vector<double> inputs(4099), exps;
+    for (std::size_t i = 0; i < inputs.size(); ++i) inputs[i] = -700.0 + 1400.0 * static_cast<double>(i) / 4098.0;
+    exps = inputs;
+    MonteCarloKernels::exp(exps.data(), exps.size());
+    double worstExp = 0.0;
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        double exact = std::exp(inputs[i]);
+        worstExp = std::max(worstExp, std::abs(exps[i] - exact) / exact);
+    }
+    std::cout << std::scientific << "   exp vs libm on [-700, 700]: max relative diff " << worstExp << std::endl;
+    expect(worstExp < 1e-15, "SIMD exp differs from libm");
+
+    // Normals per second
+    std::cout << std::fixed << std::setprecision(1);
+    auto start = Clock::now();
+    double sink = 0.0;
+    for (std::size_t i = 0; i < count; ++i) sink += randNormal();
+    double randRate = n / secondsSince(start) * 1e-6;
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> gaussian;
+    start = Clock::now();
+    for (std::size_t i = 0; i < count; ++i) sink += gaussian(rng);
+    double stdRate = n / secondsSince(start) * 1e-6;
+    start = Clock::now();
+    stream.fillNormal(normals.data(), count);
+    double batchRate = n / secondsSince(start) * 1e-6;
+    std::cout << "   M normals/s: rand() Box-Muller " << randRate << ", std::normal_distribution " << stdRate
+              << ", RandomStream::fillNormal " << batchRate << (sink == 0.0 ? " " : "") << std::endl;
+}
+
+static void checkPricing(std::uint64_t paths, unsigned maxThreads) {
+    std::cout << "\n3. Pricing (S = K = 100, r = 5%, vol = 20%, T = 1):" << std::endl;
+    double exact = blackScholesCall(model, strike);
+    MonteCarloEstimate european = MonteCarloEngine(7, 1).europeanCall(model, strike, paths);
+    std::cout << std::fixed << std::setprecision(4) << "   Black-Scholes          " << exact << std::endl;
+    printEstimate("European call", european);
+    expect(std::abs(european.mean - exact) < 4.0 * european.standardError, "European price is off by > 4 SE");
+
+    // The same chunks and streams on any number of threads
+    MonteCarloEstimate parallel = MonteCarloEngine(7, maxThreads).europeanCall(model, strike, paths);
+    expect(parallel.mean == european.mean && parallel.standardError == european.standardError,
+           "Estimate depends on the thread count");
+
+    // One monitoring date: the Asian payoff is the European one
+    MonteCarloEstimate oneStep = MonteCarloEngine(7, 2).asianCall(model, strike, 1, paths);
+    expect(std::abs(oneStep.mean - european.mean) < 1e-12 * european.mean, "One-step Asian differs from European");
+
+    MonteCarloEstimate asian = MonteCarloEngine(7, maxThreads).asianCall(model, strike, AsianSteps, paths / 4 + 1);
+    printEstimate("Asian call (64 dates)", asian);
+    expect(asian.mean > 0.0 && asian.confidenceHigh() < european.mean, "Asian call should be cheaper than European");
+    MonteCarloEstimate baseline = calculatorBaseline(paths / 16 + 2, 1);
+    printEstimate("rand() + Calculator", baseline);
+    expect(std::abs(baseline.mean - exact) < 4.0 * baseline.standardError, "Baseline price is off by > 4 SE");
+    std::cout << "   estimates are identical on 1 and " << maxThreads << " threads" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "Monte Carlo Benchmark - CMake Build!" << std::endl;
+
+    try {
+        std::uint64_t paths = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+        unsigned maxThreads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 16;
+        expect(paths >= 10000, "Use at least 10000 paths");
+        expect(maxThreads >= 1, "Use at least one thread");
+        std::srand(2024);
+
+        checkStreams();
+        checkKernels(static_cast<std::size_t>(std::min<std::uint64_t>(paths, 4000000)));
+        checkPricing(paths, maxThreads);
+
+        // 4. Throughput; the baseline gets fewer paths, it is much slower
+        std::cout << "\n4. Paths per Second (European: 1 step, Asian: " << AsianSteps << " steps):" << std::endl;
+        std::uint64_t baselinePaths = paths / 8 + 2;
+        auto start = Clock::now();
+        calculatorBaseline(baselinePaths, 1);
+        double europeanBaseline = static_cast<double>(baselinePaths) / secondsSince(start);
+        start = Clock::now();
+        calculatorBaseline(baselinePaths / 16 + 2, AsianSteps);
+        double asianBaseline = static_cast<double>(baselinePaths / 16 + 2) / secondsSince(start);
+        std::cout << std::fixed << std::setprecision(2) << "   " << std::left << std::setw(22) << "rand() + Calculator"
+                  << std::right << std::setw(10) << europeanBaseline * 1e-6 << " M/s European" << std::setw(10)
+                  << asianBaseline * 1e-6 << " M/s Asian" << std::endl;
+
+        for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+            MonteCarloEngine engine(11, threads);
+            start = Clock::now();
+            engine.europeanCall(model, strike, paths);
+            double europeanRate = static_cast<double>(paths) / secondsSince(start);
+            start = Clock::now();
+            engine.asianCall(model, strike, AsianSteps, paths / 4 + 1);
+            double asianRate = static_cast<double>(paths / 4 + 1) / secondsSince(start);
+            std::cout << "   " << std::left << std::setw(22) << ("engine, " + std::to_string(threads) + " thread(s)")
+                      << std::right << std::setw(10) << europeanRate * 1e-6 << " M/s European" << std::setw(10)
+                      << asianRate * 1e-6 << " M/s Asian" << std::endl;
+        }
+
+        // 5. Errors
+        std::cout << "\n5. Error Handling:" << std::endl;
+        try {
+            MonteCarloEngine(1).europeanCall(GbmModel{100.0, 0.05, -0.2, 1.0}, strike, 1000);
+            throw std::logic_error("Negative volatility was accepted");
+        } catch (const std::invalid_argument& e) {
+            std::cout << "   Error caught: " << e.what() << std::endl;
+        }
+        try {
+            MonteCarloEngine(1).asianCall(model, strike, 0, 1000);
+            throw std::logic_error("Zero monitoring dates were accepted");
+        } catch (const std::invalid_argument& e) {
+            std::cout << "   Error caught: " << e.what() << std::endl;
+        }
+        try {
+            MonteCarloEngine(1).europeanCall(model, strike, 0);
+            throw std::logic_error("Zero paths were accepted");
+        } catch (const std::invalid_argument& e) {
+            std::cout << "   Error caught: " << e.what() << std::endl;
+        }
+
+        std::cout << "\n✅ Monte Carlo checks passed" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,310 @@
+#include "statistics.hpp"
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+/**
+ * Streaming statistics implementation
+ */
+
+// ======================= RunningStats =======================
+
+void RunningStats::merge(const RunningStats& other) {
+    if (other.n == 0) return;
+    if (n == 0) {
+        *this = other;
+        return;
+    }
+    double total = static_cast<double>(n + other.n);
+    double delta = other.meanValue - meanValue;
+    meanValue += delta * static_cast<double>(other.n) / total;
+    m2 += other.m2 + delta * delta * static_cast<double>(n) * static_cast<double>(other.n) / total;
+    n += other.n;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+}
+
+double RunningStats::mean() const {
+    if (n == 0) {
+        throw std::runtime_error("Mean of an empty stream is undefined!");
+    }
+    return meanValue;
+}
+
+double RunningStats::variance() const {
+    if (n < 2) {
+        throw std::runtime_error("Sample variance needs at least two values!");
+    }
+    return m2 / static_cast<double>(n - 1);
+}
+
+double RunningStats::populationVariance() const {
+    if (n == 0) {
+        throw std::runtime_error("Variance of an empty stream is undefined!");
+    }
+    return m2 / static_cast<double>(n);
+}
+
+double RunningStats::standardDeviation() const {
+    return std::sqrt(variance());
+}
+
+double RunningStats::min() const {
+    if (n == 0) {
+        throw std::runtime_error("Minimum of an empty stream is undefined!");
+    }
+    return minValue;
+}
+
+double RunningStats::max() const {
+    if (n == 0) {
+        throw std::runtime_error("Maximum of an empty stream is undefined!");
+    }
+    return maxValue;
+}
+
+// ======================= KllSketch =======================
+
+KllSketch::KllSketch(std::size_t k, std::uint64_t seed) : k(k), levels(1), randomState(seed) {
+    if (k < 8) {
+        throw std::invalid_argument("KLL sketch needs k >= 8!");
+    }
+    updateCapacity();
+    levels[0].reserve(capacityTotal);
+}
+
+void KllSketch::updateCapacity() {
+    // The top level holds k values, each level below 2/3 of the one above
+    capacities.assign(levels.size(), 0);
+    capacityTotal = 0;
+    double capacity = static_cast<double>(k);
+    for (std::size_t h = levels.size(); h-- > 0;) {
+        capacities[h] = std::max(MinLevelCapacity, static_cast<std::size_t>(std::ceil(capacity)));
+        capacityTotal += capacities[h];
+        capacity *= 2.0 / 3.0;
+    }
+}
+
+void KllSketch::compress() {
+    while (retained >= capacityTotal) {
+        std::size_t h = 0;
+        while (h < levels.size() && levels[h].size() < capacities[h]) ++h;
+        if (h == levels.size()) break;
+        if (h + 1 == levels.size()) {
+            levels.emplace_back();
+            updateCapacity();
+        }
+
+        std::vector<double>& level = levels[h];
+        std::vector<double>& next = levels[h + 1];
+        std::sort(level.begin(), level.end());
+
+        // Odd or even positions survive. The coin mixes in the data so that
+        // identical copies of a sketch fed different values do not flip alike.
+        std::uint64_t bits;
+        std::memcpy(&bits, &level[level.size() / 2], sizeof(bits));
+        std::uint64_t z = (randomState += 0x9E3779B97F4A7C15ull) ^ bits;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        std::size_t offset = static_cast<std::size_t>((z ^ (z >> 31)) & 1);
+
+        std::size_t pairs = level.size() / 2;
+        bool odd = level.size() % 2 != 0;
+        double leftover = level.back();
+        for (std::size_t i = 0; i < pairs; ++i) next.push_back(level[2 * i + offset]);
+        level.clear();
+        // Levels above 0 only ever need their own capacity again
+        if (h > 0 && level.capacity() > 2 * capacities[h]) std::vector<double>().swap(level);
+        if (odd) level.push_back(leftover);
+        retained -= pairs;
+    }
+}
+
+void KllSketch::merge(const KllSketch& other) {
+    if (other.k != k) {
+        throw std::invalid_argument("Cannot merge KLL sketches with different k!");
+    }
+    if (other.levels.size() > levels.size()) levels.resize(other.levels.size());
+    for (std::size_t h = 0; h < other.levels.size(); ++h) {
+        levels[h].insert(levels[h].end(), other.levels[h].begin(), other.levels[h].end());
+    }
+    n += other.n;
+    retained += other.retained;
+    randomState ^= other.randomState;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+    updateCapacity();
+    compress();
+}
+
+void KllSketch::checkNotEmpty() const {
+    if (n == 0) {
+        throw std::runtime_error("Sketch is empty!");
+    }
+}
+
+std::vector<double> KllSketch::quantiles(const std::vector<double>& qs) const {
+    checkNotEmpty();
+    std::vector<std::pair<double, std::uint64_t>> weighted;
+    weighted.reserve(retained);
+    for (std::size_t h = 0; h < levels.size(); ++h) {
+        for (double value : levels[h]) weighted.emplace_back(value, std::uint64_t(1) << h);
+    }
+    std::sort(weighted.begin(), weighted.end());
+    for (std::size_t i = 1; i < weighted.size(); ++i) weighted[i].second += weighted[i - 1].second;
+
+    std::vector<double> result;
+    result.reserve(qs.size());
+    for (double q : qs) {
+        if (q < 0.0 || q > 1.0) {
+            throw std::invalid_argument("Quantile must be between 0 and 1!");
+        }
+        if (q == 0.0) {
+            result.push_back(minValue);
+        } else if (q == 1.0) {
+            result.push_back(maxValue);
+        } else {
+            double target = q * static_cast<double>(n);
+            auto it = std::lower_bound(weighted.begin(), weighted.end(), target,
+                                       [](const std::pair<double, std::uint64_t>& entry, double t) {
+                                           return static_cast<double>(entry.second) < t;
+                                       });
+            result.push_back(it == weighted.end() ? maxValue : it->first);
+        }
+    }
+    return result;
+}
+
+double KllSketch::quantile(double q) const {
+    return quantiles({q})[0];
+}
+
+double KllSketch::rank(double x) const {
+    checkNotEmpty();
+    std::uint64_t below = 0;
+    for (std::size_t h = 0; h < levels.size(); ++h) {
+        for (double value : levels[h]) {
+            if (value <= x) below += std::uint64_t(1) << h;
+        }
+    }
+    return static_cast<double>(below) / static_cast<double>(n);
+}
+
+std::size_t KllSketch::memoryBytes() const {
+    std::size_t bytes = sizeof(*this) + levels.capacity() * sizeof(std::vector<double>);
+    for (const std::vector<double>& level : levels) bytes += level.capacity() * sizeof(double);
+    return bytes;
+}
+
+double KllSketch::min() const {
+    checkNotEmpty();
+    return minValue;
+}
+
+double KllSketch::max() const {
+    checkNotEmpty();
+    return maxValue;
+}
+
+// ======================= HdrHistogram =======================
+
+HdrHistogram::HdrHistogram(std::uint64_t lowest, std::uint64_t highest, int significantDigits)
+    : lowestTrackable(lowest), highestTrackable(highest), significantDigits(significantDigits) {
+    if (lowest < 1) {
+        throw std::invalid_argument("Lowest trackable value must be at least 1!");
+    }
+    if (highest < 2 * lowest) {
+        throw std::invalid_argument("Highest trackable value must be at least twice the lowest!");
+    }
+    if (significantDigits < 1 || significantDigits > 5) {
+        throw std::invalid_argument("Significant digits must be between 1 and 5!");
+    }
+
+    // Enough sub-buckets per bucket to tell apart values that differ in the last digit
+    double resolution = 2.0 * std::pow(10.0, significantDigits);
+    int subBucketCountMagnitude = static_cast<int>(std::ceil(std::log2(resolution)));
+    subBucketHalfCountMagnitude = std::max(subBucketCountMagnitude, 1) - 1;
+    unitMagnitude = static_cast<int>(std::floor(std::log2(static_cast<double>(lowest))));
+    subBucketCount = std::uint64_t(1) << (subBucketHalfCountMagnitude + 1);
+    subBucketHalfCount = subBucketCount / 2;
+    subBucketMask = (subBucketCount - 1) << unitMagnitude;
+    leadingZeroCountBase = 64 - unitMagnitude - subBucketHalfCountMagnitude - 1;
+
+    std::uint64_t smallestUntrackable = subBucketCount << unitMagnitude;
+    std::size_t bucketCount = 1;
+    while (smallestUntrackable <= highest) {
+        if (smallestUntrackable > std::numeric_limits<std::uint64_t>::max() / 2) {
+            ++bucketCount;
+            break;
+        }
+        smallestUntrackable <<= 1;
+        ++bucketCount;
+    }
+    counts.assign((bucketCount + 1) * subBucketHalfCount, 0);
+}
+
+std::uint64_t HdrHistogram::valueFromIndex(std::size_t index) const {
+    long bucket = static_cast<long>(index >> subBucketHalfCountMagnitude) - 1;
+    std::uint64_t subBucket = (index & (subBucketHalfCount - 1)) + subBucketHalfCount;
+    if (bucket < 0) {
+        subBucket -= subBucketHalfCount;
+        bucket = 0;
+    }
+    return subBucket << (bucket + unitMagnitude);
+}
+
+std::uint64_t HdrHistogram::highestEquivalentValue(std::uint64_t value) const {
+    int bucket = bucketIndex(value);
+    std::uint64_t lowestEquivalent = (value >> (bucket + unitMagnitude)) << (bucket + unitMagnitude);
+    return lowestEquivalent + (std::uint64_t(1) << (bucket + unitMagnitude)) - 1;
+}
+
+void HdrHistogram::merge(const HdrHistogram& other) {
+    if (other.lowestTrackable != lowestTrackable || other.highestTrackable != highestTrackable ||
+        other.significantDigits != significantDigits) {
+        throw std::invalid_argument("Cannot merge histograms with different ranges!");
+    }
+    for (std::size_t i = 0; i < counts.size(); ++i) counts[i] += other.counts[i];
+    total += other.total;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+    sum += other.sum;
+}
+
+void HdrHistogram::checkNotEmpty() const {
+    if (total == 0) {
+        throw std::runtime_error("Histogram is empty!");
+    }
+}
+
+std::uint64_t HdrHistogram::quantile(double q) const {
+    checkNotEmpty();
+    if (q < 0.0 || q > 1.0) {
+        throw std::invalid_argument("Quantile must be between 0 and 1!");
+    }
+    if (q == 0.0) return minValue;
+    std::uint64_t target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(total))));
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        cumulative += counts[i];
+        if (cumulative >= target) {
+            return std::min(highestEquivalentValue(valueFromIndex(i)), maxValue);
+        }
+    }
+    return maxValue;
+}
+
+double HdrHistogram::mean() const {
+    checkNotEmpty();
+    return sum / static_cast<double>(total);
+}
+
+std::uint64_t HdrHistogram::min() const {
+    checkNotEmpty();
+    return minValue;
+}
+
+std::uint64_t HdrHistogram::max() const {
+    checkNotEmpty();
+    return maxValue;
+}
@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "calculator.hpp"
+#include "statistics.hpp"
+
+/**
+ * Streaming statistics self-check and benchmark
+ *
+ * The stream is log-normal "latencies" in milliseconds. Compared:
+ *   - collect + Calculator: push every value into a vector, compute mean
+ *     and variance with Calculator::add/subtract/multiply/divide, sort for
+ *     percentiles (memory grows with the stream)
+ *   - RunningStats, KllSketch, HdrHistogram: one pass, bounded memory
+ *   - all three together, split across threads and merged
+ *
+ * Usage: statistics_benchmark [values] [max threads]
+ */
+
+using Clock = std::chrono::steady_clock;
+
+static double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static std::uint64_t toNanoseconds(double ms) {
+    return static_cast<std::uint64_t>(std::llround(ms * 1e6));
+}
+
+static const std::vector<double> checkedQuantiles = {0.001, 0.01, 0.1, 0.5, 0.9, 0.99, 0.999};
+
+// Everything the monitoring dashboard needs, kept per thread and merged
+struct LatencySummary {
+    RunningStats moments;
+    KllSketch quantiles;
+    HdrHistogram histogram{1, 3600ull * 1000 * 1000 * 1000, 3};  // 1 ns .. 1 hour
+
+    void add(double ms) {
+        moments.add(ms);
+        quantiles.add(ms);
+        histogram.record(toNanoseconds(ms));
+    }
+
+    void merge(const LatencySummary& other) {
+        moments.merge(other.moments);
+        quantiles.merge(other.quantiles);
+        histogram.merge(other.histogram);
+    }
+};
+
+static void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        throw std::runtime_error(what);
+    }
+}
+
+// Largest distance between q and the true rank of the sketch's answer
+static double worstRankError(const KllSketch& sketch, const std::vector<double>& sorted) {
+    std::vector<double> estimates = sketch.quantiles(checkedQuantiles);
+    double n = static_cast<double>(sorted.size());
+    double worst = 0.0;
+    for (std::size_t i = 0; i < estimates.size(); ++i) {
+        double low = static_cast<double>(std::lower_bound(sorted.begin(), sorted.end(), estimates[i]) - sorted.begin()) / n;
+        double high = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), estimates[i]) - sorted.begin()) / n;
+        double q = checkedQuantiles[i];
+        worst = std::max(worst, q < low ? low - q : (q > high ? q - high : 0.0));
+    }
+    return worst;
+}
+
+// Largest relative distance between the histogram's answer and the exact quantile
+static double worstRelativeError(const HdrHistogram& histogram, const std::vector<double>& sorted) {
+    double worst = 0.0;
+    for (double q : checkedQuantiles) {
+        std::size_t index = static_cast<std::size_t>(std::ceil(q * static_cast<double>(sorted.size()))) - 1;
+        double exact = static_cast<double>(toNanoseconds(sorted[index]));
+        double estimate = static_cast<double>(histogram.quantile(q));
+        worst = std::max(worst, std::abs(estimate - exact) / exact);
+    }
+    return worst;
+}
+
+static void printRate(const std::string& name, std::size_t values, double seconds, std::size_t bytes) {
+    std::cout << "   " << std::left << std::setw(24) << name << std::right << std::setw(10)
+              << static_cast<double>(values) / seconds * 1e-6 << " M updates/s" << std::setw(12)
+              << static_cast<double>(bytes) / 1024.0 << " KiB" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "Streaming Statistics Benchmark - CMake Build!" << std::endl;
+
+    try {
+        std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+        unsigned maxThreads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+                                       : std::max(4u, std::thread::hardware_concurrency());
+        expect(count >= 1000, "Use at least 1000 values");
+
+        std::mt19937_64 rng(2024);
+        std::lognormal_distribution<double> latency(0.0, 1.0);
+        std::vector<double> stream(count);
+        for (double& value : stream) value = latency(rng);
+        std::vector<double> sorted = stream;
+        std::sort(sorted.begin(), sorted.end());
+
+        std::cout << std::fixed << std::setprecision(2);
+
+        // 1. Baseline: collect the whole stream, then compute
+        std::cout << "\n1. Collect + Calculator (" << count << " values):" << std::endl;
+        auto start = Clock::now();
+        std::vector<double> collected;
+        for (double value : stream) collected.push_back(value);
+        double total = 0.0;
+        for (double value : collected) total = Calculator::add(total, value);
+        double baselineMean = Calculator::divide(total, static_cast<double>(collected.size()));
+        double squares = 0.0;
+        for (double value : collected) {
+            double diff = Calculator::subtract(value, baselineMean);
+            squares = Calculator::add(squares, Calculator::multiply(diff, diff));
+        }
+        double baselineVariance = Calculator::divide(squares, static_cast<double>(collected.size() - 1));
+        std::sort(collected.begin(), collected.end());
+        printRate("collect + Calculator", count, secondsSince(start), collected.capacity() * sizeof(double));
+
+        // 2. One-pass accumulators
+        std::cout << "\n2. One-Pass Accumulators:" << std::endl;
+        RunningStats moments;
+        start = Clock::now();
+        for (double value : stream) moments.add(value);
+        printRate("RunningStats", count, secondsSince(start), sizeof(moments));
+        expect(std::abs(moments.mean() - baselineMean) <= 1e-9 * baselineMean, "Welford mean differs");
+        expect(std::abs(moments.variance() - baselineVariance) <= 1e-9 * baselineVariance, "Welford variance differs");
+        expect(moments.min() == sorted.front() && moments.max() == sorted.back(), "Welford min/max differ");
+
+        KllSketch sketch;
+        start = Clock::now();
+        for (double value : stream) sketch.add(value);
+        printRate("KllSketch (k=200)", count, secondsSince(start), sketch.memoryBytes());
+
+        HdrHistogram histogram(1, 3600ull * 1000 * 1000 * 1000, 3);
+        start = Clock::now();
+        for (double value : stream) histogram.record(toNanoseconds(value));
+        printRate("HdrHistogram (3 digits)", count, secondsSince(start), histogram.memoryBytes());
+
+        double rankError = worstRankError(sketch, sorted);
+        double valueError = worstRelativeError(histogram, sorted);
+        std::cout << "   mean " << moments.mean() << " ms, stddev " << moments.standardDeviation() << " ms" << std::endl;
+        std::cout << "   KLL retains " << sketch.retainedItems() << " values, worst rank error "
+                  << rankError * 100.0 << "%" << std::endl;
+        std::cout << "   HDR worst relative value error " << valueError * 100.0 << "%" << std::endl;
+        std::cout << "   p50/p99/p99.9 exact:  " << sorted[count / 2] << " / " << sorted[count * 99 / 100]
+                  << " / " << sorted[count * 999 / 1000] << " ms" << std::endl;
+        std::cout << "   p50/p99/p99.9 KLL:    " << sketch.quantile(0.5) << " / " << sketch.quantile(0.99)
+                  << " / " << sketch.quantile(0.999) << " ms" << std::endl;
+        std::cout << "   p50/p99/p99.9 HDR:    " << histogram.quantile(0.5) * 1e-6 << " / "
+                  << histogram.quantile(0.99) * 1e-6 << " / " << histogram.quantile(0.999) * 1e-6 << " ms" << std::endl;
+        expect(rankError <= 0.02, "KLL rank error above 2%");
+        expect(valueError <= 1e-3, "HDR value error above 0.1%");
+
+        // 3. Per-thread summaries merged at the end
+        std::cout << "\n3. Parallel Summaries (Welford + KLL + HDR per thread, tree merge):" << std::endl;
+        for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+            start = Clock::now();
+            LatencySummary merged = accumulateParallel(count, threads, LatencySummary(),
+                                                       [&](std::size_t i) { return stream[i]; });
+            double seconds = secondsSince(start);
+            std::cout << "   " << threads << " thread(s): " << std::setw(8)
+                      << static_cast<double>(count) / seconds * 1e-6 << " M updates/s, rank error "
+                      << worstRankError(merged.quantiles, sorted) * 100.0 << "%" << std::endl;
+
+            expect(merged.moments.count() == count, "Merged count differs");
+            expect(std::abs(merged.moments.mean() - baselineMean) <= 1e-9 * baselineMean, "Merged mean differs");
+            expect(std::abs(merged.moments.variance() - baselineVariance) <= 1e-9 * baselineVariance,
+                   "Merged variance differs");
+            expect(worstRankError(merged.quantiles, sorted) <= 0.02, "Merged KLL rank error above 2%");
+            for (double q : checkedQuantiles) {
+                expect(merged.histogram.quantile(q) == histogram.quantile(q), "Merged histogram differs");
+            }
+        }
+
+        // 4. Errors
+        std::cout << "\n4. Error Handling:" << std::endl;
+        try {
+            RunningStats().mean();
+            throw std::logic_error("Empty mean was accepted");
+        } catch (const std::runtime_error& e) {
+            std::cout << "   Error caught: " << e.what() << std::endl;
+        }
+        try {
+            histogram.record(histogram.max() * 1000000000ull);
+            throw std::logic_error("Out-of-range value was accepted");
+        } catch (const std::out_of_range& e) {
+            std::cout << "   Error caught: " << e.what() << std::endl;
+        }
+
+        std::cout << "\n✅ Statistics checks passed" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -6,6 +6,10 @@
 #include <vector>
 #include <memory>
 #include <stdexcept>
+#include <cstdlib>
+#include <chrono>
+#include "query_cache.hpp"
+#include "../other_concepts/trace.hpp"
 
 /**
  * ===============================================
@@ -42,6 +46,75 @@ protected:
     std::string connectionString;
     bool isConnected;
     std::string databaseType;
+    
+    // Per-connection prepared statements and optional read-through result cache
+    StatementCache statementCache;
+    std::unique_ptr<ResultCache> resultCache;
+    bool transactionWrote = false;  // Reads bypass the result cache until commit/rollback
+    bool transactionActive = false;
+    std::chrono::nanoseconds simulatedLatency{0};
+    
+    static uint64_t nanosSince(std::chrono::steady_clock::time_point started) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - started).count());
+    }
+    
+    // Stand-in for the network round trip and server work of a real query
+    void simulateRoundTrip() const {
+        auto until = std::chrono::steady_clock::now() + simulatedLatency;
+        while (std::chrono::steady_clock::now() < until) {
+        }
+    }
+    
+    const PreparedStatement& prepareStatement(const std::string& query) {
+        return statementCache.prepare(query);
+    }
+    
+    // Serve a repeated read from the result cache if it is safe to do so.
+    // The lookup and copy-out are charged against the cache's savings;
+    // statement preparation is not, since it runs with or without the cache.
+    bool fetchCachedResults(const PreparedStatement& statement, const std::string& query,
+                            std::vector<std::string>& rows) {
+        if (!resultCache || !statement.isCacheable || transactionWrote) {
+            return false;
+        }
+        auto started = std::chrono::steady_clock::now();
+        bool hit = resultCache->lookup(query, rows);
+        resultCache->chargeOverhead(nanosSince(started));
+        return hit;
+    }
+    
+    // Record a completed execution: writes invalidate, reads populate the cache
+    void recordExecution(const PreparedStatement& statement, const std::string& query,
+                         const std::vector<std::string>& rows,
+                         std::chrono::steady_clock::time_point started) {
+        if (!resultCache) return;
+        
+        uint64_t executionNanos = nanosSince(started);
+        auto cacheStarted = std::chrono::steady_clock::now();
+        if (statement.isWrite) {
+            resultCache->invalidateAll();
+            if (transactionActive) {
+                transactionWrote = true;
+            }
+        } else if (statement.isCacheable && !transactionWrote) {
+            resultCache->store(query, rows, executionNanos);
+        }
+        resultCache->chargeOverhead(nanosSince(cacheStarted));
+    }
+    
+    void onTransactionBegin() {
+        transactionActive = true;
+        transactionWrote = false;
+    }
+    
+    void onTransactionEnd() {
+        if (resultCache && transactionWrote) {
+            resultCache->invalidateAll();
+        }
+        transactionActive = false;
+        transactionWrote = false;
+    }
 
 public:
     // Constructor for abstract class
@@ -78,6 +151,42 @@ public:
         return databaseType;
     }
     
+    // Result caching is opt-in; statement caching is always on
+    void enableResultCache(size_t maxBytes = 1 << 20) {
+        resultCache = std::make_unique<ResultCache>(maxBytes);
+    }
+    
+    void disableResultCache() {
+        resultCache.reset();
+    }
+    
+    // Every executed (not cached) query spins for this long
+    void setSimulatedLatency(std::chrono::nanoseconds latency) {
+        simulatedLatency = latency;
+    }
+    
+    const StatementCache& getStatementCache() const {
+        return statementCache;
+    }
+    
+    const ResultCache* getResultCache() const {
+        return resultCache.get();
+    }
+    
+    void printCacheStatistics() const {
+        std::cout << "Statement cache: " << statementCache.size() << " statements, hit rate "
+                  << statementCache.hitRate() * 100.0 << "%" << std::endl;
+        if (resultCache) {
+            std::cout << "Result cache: " << resultCache->size() << " entries ("
+                      << resultCache->bytesUsed() << " bytes), hit rate "
+                      << resultCache->hitRate() * 100.0 << "%, "
+                      << resultCache->getEvictions() << " evictions, "
+                      << resultCache->getInvalidations() << " invalidations, "
+                      << resultCache->getNetNanosSaved() / 1000.0 << " us saved net of "
+                      << resultCache->getNanosSpent() / 1000.0 << " us cache overhead" << std::endl;
+        }
+    }
+    
     // Template method pattern - defines algorithm skeleton
     bool executeTransactionalQuery(const std::string& query) {
         if (!isConnected) {
@@ -121,7 +230,7 @@ private:
 
 public:
     MySQLConnection(const std::string& host, const std::string& database,
-                   const std::string& username, const std::string& password)
+                   const std::string& username, [[maybe_unused]] const std::string& password)
         : DatabaseConnection("mysql://" + username + "@" + host + "/" + database, "MySQL"),
           inTransaction(false) {
         std::cout << "MySQLConnection created" << std::endl;
@@ -154,19 +263,28 @@ public:
     
     bool executeQuery(const std::string& query) override {
         if (!isConnected) {
-            std::cout << "Error: Not connected to MySQL database" << std::endl;
+            OOPS_TRACE(Error, Database, "Error: Not connected to MySQL database");
             return false;
         }
         
-        std::cout << "Executing MySQL query: " << query << std::endl;
+        const PreparedStatement& statement = prepareStatement(query);
+        if (fetchCachedResults(statement, query, queryResults)) {
+            OOPS_TRACE(Info, Database, "MySQL query served from result cache: ", query);
+            return true;
+        }
+        
+        auto started = std::chrono::steady_clock::now();
+        OOPS_TRACE(Info, Database, "Executing MySQL query: ", query);
         
         // Simulate query execution
         queryResults.clear();
         queryResults.push_back("Result row 1");
         queryResults.push_back("Result row 2");
         queryResults.push_back("Result row 3");
+        simulateRoundTrip();
         
-        std::cout << "MySQL query executed successfully" << std::endl;
+        OOPS_TRACE(Info, Database, "MySQL query executed successfully");
+        recordExecution(statement, query, queryResults, started);
         return true;
     }
     
@@ -179,6 +297,7 @@ public:
         
         std::cout << "BEGIN TRANSACTION (MySQL)" << std::endl;
         inTransaction = true;
+        onTransactionBegin();
         return true;
     }
     
@@ -187,6 +306,7 @@ public:
         
         std::cout << "COMMIT (MySQL)" << std::endl;
         inTransaction = false;
+        onTransactionEnd();
         return true;
     }
     
@@ -195,6 +315,7 @@ public:
         
         std::cout << "ROLLBACK (MySQL)" << std::endl;
         inTransaction = false;
+        onTransactionEnd();
         return true;
     }
     
@@ -219,7 +340,7 @@ private:
 
 public:
     PostgreSQLConnection(const std::string& host, const std::string& database,
-                        const std::string& username, const std::string& password)
+                        const std::string& username, [[maybe_unused]] const std::string& password)
         : DatabaseConnection("postgresql://" + username + "@" + host + "/" + database, "PostgreSQL") {
         std::cout << "PostgreSQLConnection created" << std::endl;
     }
@@ -250,17 +371,26 @@ public:
     
     bool executeQuery(const std::string& query) override {
         if (!isConnected) {
-            std::cout << "Error: Not connected to PostgreSQL database" << std::endl;
+            OOPS_TRACE(Error, Database, "Error: Not connected to PostgreSQL database");
             return false;
         }
         
-        std::cout << "Executing PostgreSQL query: " << query << std::endl;
+        const PreparedStatement& statement = prepareStatement(query);
+        if (fetchCachedResults(statement, query, queryResults)) {
+            OOPS_TRACE(Info, Database, "PostgreSQL query served from result cache: ", query);
+            return true;
+        }
+        
+        auto started = std::chrono::steady_clock::now();
+        OOPS_TRACE(Info, Database, "Executing PostgreSQL query: ", query);
         
         queryResults.clear();
         queryResults.push_back("PG Result 1");
         queryResults.push_back("PG Result 2");
+        simulateRoundTrip();
         
-        std::cout << "PostgreSQL query executed successfully" << std::endl;
+        OOPS_TRACE(Info, Database, "PostgreSQL query executed successfully");
+        recordExecution(statement, query, queryResults, started);
         return true;
     }
     
@@ -273,6 +403,7 @@ public:
         
         transactionId = "TXN_" + std::to_string(rand() % 10000);
         std::cout << "BEGIN TRANSACTION " << transactionId << " (PostgreSQL)" << std::endl;
+        onTransactionBegin();
         return true;
     }
     
@@ -281,6 +412,7 @@ public:
         
         std::cout << "COMMIT " << transactionId << " (PostgreSQL)" << std::endl;
         transactionId.clear();
+        onTransactionEnd();
         return true;
     }
     
@@ -289,6 +421,7 @@ public:
         
         std::cout << "ROLLBACK " << transactionId << " (PostgreSQL)" << std::endl;
         transactionId.clear();
+        onTransactionEnd();
         return true;
     }
     
@@ -406,63 +539,92 @@ public:
 
 /**
  * Abstract UI Component
+ *
+ * The interfaces below hold no strings; the Basic* classes store their own,
+ * while flyweight products (flyweight.hpp) serve them from shared state.
  */
 class UIComponent {
 protected:
-    std::string name;
     bool visible;
+    bool dirty;  // Needs re-rendering in retained mode (see retained_ui.hpp)
 
 public:
-    UIComponent(const std::string& n) : name(n), visible(true) {}
+    UIComponent() : visible(true), dirty(true) {}
     virtual ~UIComponent() = default;
     
     virtual void render() = 0;
     virtual void handleClick() = 0;
-    virtual void setVisible(bool v) { visible = v; }
+    virtual void setVisible(bool v) {
+        if (visible != v) {
+            visible = v;
+            dirty = true;
+        }
+    }
     virtual bool isVisible() const { return visible; }
-    const std::string& getName() const { return name; }
+    virtual const std::string& getName() const = 0;
+    
+    // Change tracking for retained-mode rendering
+    void markDirty() { dirty = true; }
+    void clearDirty() { dirty = false; }
+    bool isDirty() const { return dirty; }
 };
 
 class Button : public UIComponent {
+public:
+    virtual const std::string& getText() const = 0;
+    virtual const std::string& getStyle() const = 0;
+};
+
+class TextField : public UIComponent {
 private:
+    std::string value;  // Per instance in every implementation
+
+public:
+    virtual const std::string& getPlaceholder() const = 0;
+    const std::string& getValue() const { return value; }
+    void setValue(const std::string& v) {
+        value = v;
+        markDirty();
+    }
+};
+
+// Button that owns its strings
+class BasicButton : public Button {
+private:
+    std::string name;
     std::string text;
     std::string style;
 
 public:
-    Button(const std::string& n, const std::string& t, const std::string& s)
-        : UIComponent(n), text(t), style(s) {}
-    
-    virtual void render() override = 0;
-    virtual void handleClick() override = 0;
+    BasicButton(const std::string& n, const std::string& t, const std::string& s)
+        : name(n), text(t), style(s) {}
     
-    const std::string& getText() const { return text; }
-    const std::string& getStyle() const { return style; }
+    const std::string& getName() const override { return name; }
+    const std::string& getText() const override { return text; }
+    const std::string& getStyle() const override { return style; }
 };
 
-class TextField : public UIComponent {
+// Text field that owns its strings
+class BasicTextField : public TextField {
 private:
+    std::string name;
     std::string placeholder;
-    std::string value;
 
 public:
-    TextField(const std::string& n, const std::string& p)
-        : UIComponent(n), placeholder(p) {}
+    BasicTextField(const std::string& n, const std::string& p)
+        : name(n), placeholder(p) {}
     
-    virtual void render() override = 0;
-    virtual void handleClick() override = 0;
-    
-    const std::string& getPlaceholder() const { return placeholder; }
-    const std::string& getValue() const { return value; }
-    void setValue(const std::string& v) { value = v; }
+    const std::string& getName() const override { return name; }
+    const std::string& getPlaceholder() const override { return placeholder; }
 };
 
 /**
  * Concrete implementations for different platforms
  */
-class WindowsButton : public Button {
+class WindowsButton : public BasicButton {
 public:
     WindowsButton(const std::string& n, const std::string& t)
-        : Button(n, t, "Windows") {}
+        : BasicButton(n, t, "Windows") {}
     
     void render() override {
         std::cout << "Rendering Windows-style button: " << getText() << std::endl;
@@ -474,10 +636,10 @@ public:
     }
 };
 
-class MacButton : public Button {
+class MacButton : public BasicButton {
 public:
     MacButton(const std::string& n, const std::string& t)
-        : Button(n, t, "Mac") {}
+        : BasicButton(n, t, "Mac") {}
     
     void render() override {
         std::cout << "Rendering Mac-style button: " << getText() << std::endl;
@@ -489,10 +651,10 @@ public:
     }
 };
 
-class WindowsTextField : public TextField {
+class WindowsTextField : public BasicTextField {
 public:
     WindowsTextField(const std::string& n, const std::string& p)
-        : TextField(n, p) {}
+        : BasicTextField(n, p) {}
     
     void render() override {
         std::cout << "Rendering Windows-style text field" << std::endl;
@@ -504,10 +666,10 @@ public:
     }
 };
 
-class MacTextField : public TextField {
+class MacTextField : public BasicTextField {
 public:
     MacTextField(const std::string& n, const std::string& p)
-        : TextField(n, p) {}
+        : BasicTextField(n, p) {}
     
     void render() override {
         std::cout << "Rendering Mac-style text field" << std::endl;
@@ -670,56 +832,31 @@ inline void demonstrateAbstraction() {
     
     // Database Connection Abstraction
     std::cout << "1. Database Connection Abstraction:" << std::endl;
-    AdvancedConcepts::MySQLConnection mysql("localhost", 3306, "mydb");
+    AdvancedConcepts::MySQLConnection mysql("localhost", "mydb", "admin", "secret");
+    mysql.connect();
     mysql.executeQuery("SELECT * FROM users");
     mysql.disconnect();
     
     std::cout << std::endl;
-    AdvancedConcepts::PostgreSQLConnection postgres("localhost", 5432, "mydb");
+    AdvancedConcepts::PostgreSQLConnection postgres("localhost", "mydb", "admin", "secret");
+    postgres.connect();
     postgres.executeQuery("SELECT COUNT(*) FROM orders");
     postgres.disconnect();
     
     // Document Interface Example
     std::cout << "\n2. Interface Implementation:" << std::endl;
-    AdvancedConcepts::Document doc("Sample Document", "This is a sample document content.");
+    AdvancedConcepts::Document doc("Sample Document", "This is a sample document content.",
+                                   "Jane Doe", 1);
     doc.print();
     std::string serialized = doc.serialize();
     std::cout << "Serialized: " << serialized << std::endl;
     
-    // File System Abstraction
-    std::cout << "\n3. File System Abstraction:" << std::endl;
-    FileSystemManager manager;
-    
-    manager.setFileSystem(std::make_unique<LocalFileSystem>());
-    manager.storeFile("document.pdf", "Local PDF content");
-    manager.retrieveFile("document.pdf");
-    
-    manager.setFileSystem(std::make_unique<CloudFileSystem>());
-    manager.storeFile("image.jpg", "Cloud image content");
-    manager.retrieveFile("image.jpg");
-    
-    // Notification System Abstraction
-    std::cout << "\n4. Notification System Abstraction:" << std::endl;
-    NotificationManager notificationManager;
-    
-    notificationManager.addChannel(std::make_unique<EmailNotification>());
-    notificationManager.addChannel(std::make_unique<SMSNotification>());
-    notificationManager.addChannel(std::make_unique<PushNotification>());
-    
-    notificationManager.sendNotification("Your order has been shipped!");
-    
-    // Pure Virtual Function Demo
-    std::cout << "\n5. Pure Virtual Functions:" << std::endl;
-    std::vector<std::unique_ptr<GeometricShape>> shapes;
-    shapes.push_back(std::make_unique<Circle2D>(7.5));
-    shapes.push_back(std::make_unique<Rectangle2D>(10.0, 5.0));
-    
-    for (const auto& shape : shapes) {
-        shape->draw();
-        std::cout << "Area: " << shape->calculateArea() << std::endl;
-        std::cout << "Perimeter: " << shape->calculatePerimeter() << std::endl;
-        std::cout << std::endl;
-    }
+    // Abstract Factory Example
+    std::cout << "\n3. Abstract Factory:" << std::endl;
+    AdvancedConcepts::Application app(std::make_unique<AdvancedConcepts::MacUIFactory>());
+    app.createUI();
+    app.renderUI();
+    app.simulateUserInteraction();
 }
 
 #endif // ABSTRACTION_HPP
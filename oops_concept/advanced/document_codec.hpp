@@ -0,0 +1,198 @@
+#ifndef DOCUMENT_CODEC_HPP
+#define DOCUMENT_CODEC_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "abstraction.hpp"
+
+/**
+ * ===============================================
+ * BINARY DOCUMENT CODEC - LENGTH-PREFIXED FORMAT
+ * ===============================================
+ *
+ * Document::serialize() joins fields with '|', so any content containing
+ * '|' cannot round-trip, and deserialize() allocates a substring per field.
+ * The binary format prefixes every field with its varint length:
+ *
+ *   [varint len][title][varint len][content][varint len][author][zigzag varint pages]
+ *
+ * Decoding returns a DocumentView whose fields are std::string_views into the
+ * caller's buffer - nothing is copied or allocated. The buffer must outlive
+ * the views.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Why are length prefixes safer than delimiters?
+ * 2. How does varint / zigzag encoding work?
+ * 3. What is zero-copy deserialization and what are its lifetime rules?
+ */
+
+namespace AdvancedConcepts {
+
+/**
+ * Non-owning view of a serialized Document
+ */
+struct DocumentView {
+    std::string_view title;
+    std::string_view content;
+    std::string_view author;
+    int pageCount = 0;
+
+    Document toDocument() const {
+        return Document(std::string(title), std::string(content), std::string(author), pageCount);
+    }
+};
+
+// ======================= VARINT PRIMITIVES =======================
+
+inline void appendVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+// Returns false on truncated, over-long or overflowing input; offset is
+// advanced on success
+inline bool readVarint(std::string_view in, size_t& offset, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (offset >= in.size()) return false;
+        uint8_t byte = static_cast<uint8_t>(in[offset++]);
+        // The tenth byte holds only bit 63; anything more would be shifted out
+        if (shift == 63 && (byte & 0x7E) != 0) return false;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+inline uint64_t zigzagEncode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t zigzagDecode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+inline void appendField(std::string& out, std::string_view field) {
+    appendVarint(out, field.size());
+    out.append(field.data(), field.size());
+}
+
+inline bool readField(std::string_view in, size_t& offset, std::string_view& field) {
+    uint64_t length = 0;
+    if (!readVarint(in, offset, length) || length > in.size() - offset) {
+        return false;
+    }
+    field = in.substr(offset, static_cast<size_t>(length));
+    offset += static_cast<size_t>(length);
+    return true;
+}
+
+// ======================= SINGLE DOCUMENT =======================
+
+inline size_t encodedSize(const Document& doc) {
+    auto varintSize = [](uint64_t v) {
+        size_t n = 1;
+        while (v >= 0x80) { v >>= 7; ++n; }
+        return n;
+    };
+    return varintSize(doc.getTitle().size()) + doc.getTitle().size() +
+           varintSize(doc.getContent().size()) + doc.getContent().size() +
+           varintSize(doc.getAuthor().size()) + doc.getAuthor().size() +
+           varintSize(zigzagEncode(doc.getPageCount()));
+}
+
+inline void encodeDocument(const Document& doc, std::string& out) {
+    appendField(out, doc.getTitle());
+    appendField(out, doc.getContent());
+    appendField(out, doc.getAuthor());
+    appendVarint(out, zigzagEncode(doc.getPageCount()));
+}
+
+inline bool decodeDocument(std::string_view in, size_t& offset, DocumentView& view) {
+    size_t cursor = offset;
+    uint64_t pages = 0;
+    if (!readField(in, cursor, view.title) ||
+        !readField(in, cursor, view.content) ||
+        !readField(in, cursor, view.author) ||
+        !readVarint(in, cursor, pages)) {
+        return false;
+    }
+    view.pageCount = static_cast<int>(zigzagDecode(pages));
+    offset = cursor;
+    return true;
+}
+
+// ======================= BATCH ENCODING =======================
+
+/**
+ * Encode a collection into one contiguous buffer: [varint count][record]...
+ */
+inline std::string encodeDocuments(const std::vector<Document>& docs) {
+    size_t total = 10;
+    for (const auto& doc : docs) {
+        total += encodedSize(doc);
+    }
+
+    std::string out;
+    out.reserve(total);
+    appendVarint(out, docs.size());
+    for (const auto& doc : docs) {
+        encodeDocument(doc, out);
+    }
+    return out;
+}
+
+/**
+ * Decode a batch into views over the buffer. On malformed input, views is
+ * left holding the records decoded so far and false is returned.
+ */
+inline bool decodeDocuments(std::string_view in, std::vector<DocumentView>& views) {
+    size_t offset = 0;
+    uint64_t count = 0;
+    if (!readVarint(in, offset, count)) {
+        return false;
+    }
+
+    views.clear();
+    // Every record is at least 4 bytes, so never reserve more than the buffer can hold
+    views.reserve(static_cast<size_t>(std::min<uint64_t>(count, in.size() / 4)));
+    for (uint64_t i = 0; i < count; ++i) {
+        DocumentView view;
+        if (!decodeDocument(in, offset, view)) {
+            return false;
+        }
+        views.push_back(view);
+    }
+    return offset == in.size();
+}
+
+} // namespace AdvancedConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Why are length prefixes safer than delimiters?
+ * A1: A delimiter must never appear in the payload, so it needs escaping.
+ *     A length prefix tells the reader exactly how many bytes to take, so
+ *     any byte sequence round-trips and the reader never scans for a marker.
+ *
+ * Q2: How does varint / zigzag encoding work?
+ * A2: Varint stores 7 bits per byte with the high bit meaning "more bytes
+ *     follow", so small numbers take one byte. Zigzag maps signed values to
+ *     unsigned (0,-1,1,-2 -> 0,1,2,3) so small negatives stay short too.
+ *
+ * Q3: What is zero-copy deserialization and what are its lifetime rules?
+ * A3: Fields are exposed as views (pointer + length) into the input buffer
+ *     instead of being copied into new strings. The views dangle as soon as
+ *     the buffer is freed or modified, so the caller owns that lifetime.
+ */
+
+#endif // DOCUMENT_CODEC_HPP
@@ -0,0 +1,173 @@
+#ifndef DOCUMENT_SORT_HPP
+#define DOCUMENT_SORT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "abstraction.hpp"
+
+/**
+ * ===============================================
+ * DEVIRTUALIZED DOCUMENT SORTING
+ * ===============================================
+ *
+ * Sorting through the Comparable interface costs a virtual call plus a
+ * dynamic_cast per comparison. When the concrete type is known we can
+ * instead extract a fixed-width key once per element:
+ *
+ *   high word: pageCount (sign-flipped) | first 4 bytes of title
+ *   low word:  next 8 bytes of title
+ *
+ * Keys compare as two integers, in exactly the Document::compareTo order.
+ * Only when two keys are equal (titles share a 12-byte prefix) do we fall
+ * back to comparing the full titles.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. What does a virtual call + dynamic_cast cost inside a sort?
+ * 2. What is key extraction (a.k.a. Schwartzian transform)?
+ * 3. How does a parallel sort-then-merge work?
+ */
+
+namespace AdvancedConcepts {
+
+/**
+ * Sortable fixed-width key for a Document, plus its position in the input
+ */
+struct DocumentSortKey {
+    uint64_t high;
+    uint64_t low;
+    uint32_t index;
+
+    static DocumentSortKey from(const Document& doc, uint32_t index) {
+        const std::string& title = doc.getTitle();
+        unsigned char prefix[12] = {};
+        std::copy_n(title.begin(), std::min<size_t>(title.size(), sizeof(prefix)), prefix);
+
+        // Flipping the sign bit makes signed page counts order as unsigned
+        uint64_t high = static_cast<uint64_t>(static_cast<uint32_t>(doc.getPageCount()) ^ 0x80000000u) << 32;
+        for (int i = 0; i < 4; ++i) {
+            high |= static_cast<uint64_t>(prefix[i]) << (24 - 8 * i);
+        }
+        uint64_t low = 0;
+        for (int i = 0; i < 8; ++i) {
+            low |= static_cast<uint64_t>(prefix[4 + i]) << (56 - 8 * i);
+        }
+        return DocumentSortKey{high, low, index};
+    }
+};
+
+/**
+ * Strict weak ordering over keys, consistent with Document::compareTo
+ */
+class DocumentKeyLess {
+private:
+    const std::vector<Document>* docs;
+
+public:
+    explicit DocumentKeyLess(const std::vector<Document>& documents) : docs(&documents) {}
+
+    bool operator()(const DocumentSortKey& a, const DocumentSortKey& b) const {
+        if (a.high != b.high) return a.high < b.high;
+        if (a.low != b.low) return a.low < b.low;
+        // Same page count and 12-byte title prefix: decide on the full title
+        return (*docs)[a.index].getTitle() < (*docs)[b.index].getTitle();
+    }
+};
+
+/**
+ * Indices of `docs` in compareTo order. Chunks are sorted on separate
+ * threads, then merged pairwise (each merge level also runs in parallel).
+ */
+inline std::vector<uint32_t> sortedOrder(const std::vector<Document>& docs,
+                                         unsigned threadCount = std::thread::hardware_concurrency()) {
+    std::vector<DocumentSortKey> keys;
+    keys.reserve(docs.size());
+    for (size_t i = 0; i < docs.size(); ++i) {
+        keys.push_back(DocumentSortKey::from(docs[i], static_cast<uint32_t>(i)));
+    }
+
+    DocumentKeyLess less(docs);
+    const size_t minChunk = 1 << 14;  // Below this, thread start-up costs more than it saves
+    size_t chunks = std::max<size_t>(1, std::min<size_t>(threadCount, keys.size() / minChunk));
+
+    if (chunks == 1) {
+        std::sort(keys.begin(), keys.end(), less);
+    } else {
+        std::vector<size_t> bounds(chunks + 1);
+        for (size_t c = 0; c <= chunks; ++c) {
+            bounds[c] = keys.size() * c / chunks;
+        }
+
+        std::vector<std::thread> workers;
+        for (size_t c = 0; c < chunks; ++c) {
+            workers.emplace_back([&, c] {
+                std::sort(keys.begin() + bounds[c], keys.begin() + bounds[c + 1], less);
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        // Merge neighbouring runs until one remains
+        for (size_t width = 1; width < chunks; width *= 2) {
+            workers.clear();
+            for (size_t c = 0; c + width < chunks; c += 2 * width) {
+                size_t first = bounds[c];
+                size_t middle = bounds[c + width];
+                size_t last = bounds[std::min(c + 2 * width, chunks)];
+                workers.emplace_back([&keys, &less, first, middle, last] {
+                    std::inplace_merge(keys.begin() + first, keys.begin() + middle,
+                                       keys.begin() + last, less);
+                });
+            }
+            for (auto& worker : workers) worker.join();
+        }
+    }
+
+    std::vector<uint32_t> order;
+    order.reserve(keys.size());
+    for (const auto& key : keys) {
+        order.push_back(key.index);
+    }
+    return order;
+}
+
+/**
+ * Sort documents in place in compareTo order without any virtual dispatch
+ */
+inline void sortDocuments(std::vector<Document>& docs,
+                          unsigned threadCount = std::thread::hardware_concurrency()) {
+    std::vector<uint32_t> order = sortedOrder(docs, threadCount);
+
+    std::vector<Document> sorted;
+    sorted.reserve(docs.size());
+    for (uint32_t index : order) {
+        sorted.push_back(std::move(docs[index]));
+    }
+    docs = std::move(sorted);
+}
+
+} // namespace AdvancedConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: What does a virtual call + dynamic_cast cost inside a sort?
+ * A1: A sort does O(n log n) comparisons. Each one pays an indirect call the
+ *     compiler cannot inline plus an RTTI walk, and touches both objects'
+ *     strings. With n = 1M that is ~20M of each.
+ *
+ * Q2: What is key extraction (a.k.a. Schwartzian transform)?
+ * A2: Compute a cheap-to-compare key once per element (O(n)), sort the keys,
+ *     then use the resulting order. The expensive logic runs n times rather
+ *     than n log n times, and the comparisons become integer compares.
+ *
+ * Q3: How does a parallel sort-then-merge work?
+ * A3: Split the data into one run per thread and sort each run concurrently.
+ *     Then merge neighbouring runs pairwise; every merge level halves the
+ *     number of runs and the merges within a level are independent.
+ */
+
+#endif // DOCUMENT_SORT_HPP
@@ -0,0 +1,304 @@
+#ifndef DOCUMENT_STORE_HPP
+#define DOCUMENT_STORE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "document_codec.hpp"
+
+/**
+ * ===============================================
+ * MEMORY-MAPPED DOCUMENT STORE
+ * ===============================================
+ *
+ * Archives Documents in three files sharing a base path:
+ *
+ *   <base>.dat  append-only records in the document_codec binary format
+ *   <base>.idx  uint64 byte offset of every record, in insertion order
+ *   <base>.ord  uint32 record ids sorted like Document::compareTo
+ *               (pageCount, then title) - rebuilt by DocumentStoreWriter::finish()
+ *
+ * DocumentStore maps all three read-only. Opening costs a few system calls
+ * regardless of file size, and lookups return DocumentViews that point
+ * straight into the mapping - no copies, no allocations.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. What does mmap give you over read()?
+ * 2. Why keep a separate offset index for variable-length records?
+ * 3. How does a persisted secondary index work?
+ */
+
+namespace AdvancedConcepts {
+
+/**
+ * RAII read-only memory mapping of a whole file
+ */
+class MappedFile {
+private:
+    const char* data_;
+    size_t size_;
+
+public:
+    MappedFile() : data_(nullptr), size_(0) {}
+
+    explicit MappedFile(const std::string& path) : data_(nullptr), size_(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat " + path);
+        }
+
+        size_ = static_cast<size_t>(info.st_size);
+        if (size_ > 0) {
+            void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot mmap " + path);
+            }
+            data_ = static_cast<const char*>(mapping);
+        }
+        ::close(fd); // The mapping keeps the file alive
+    }
+
+    ~MappedFile() {
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            if (data_) {
+                ::munmap(const_cast<char*>(data_), size_);
+            }
+            data_ = other.data_;
+            size_ = other.size_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::string_view view() const { return std::string_view(data_, size_); }
+};
+
+/**
+ * Read side: zero-copy lookups over the mapped files
+ */
+class DocumentStore {
+private:
+    MappedFile records;
+    MappedFile offsets;
+    MappedFile ordering;
+    size_t count;
+    bool sortedAvailable;
+
+    uint64_t offsetAt(size_t id) const {
+        uint64_t offset;
+        std::memcpy(&offset, offsets.data() + id * sizeof(uint64_t), sizeof(offset));
+        return offset;
+    }
+
+    static bool fileExists(const std::string& path) {
+        struct stat info;
+        return ::stat(path.c_str(), &info) == 0;
+    }
+
+public:
+    explicit DocumentStore(const std::string& basePath)
+        : records(basePath + ".dat"), offsets(basePath + ".idx"),
+          count(0), sortedAvailable(false) {
+        if (offsets.size() % sizeof(uint64_t) != 0) {
+            throw std::runtime_error("Corrupt offset index: " + basePath + ".idx");
+        }
+        count = offsets.size() / sizeof(uint64_t);
+
+        // A sorted index left over from before later appends is ignored
+        if (fileExists(basePath + ".ord")) {
+            ordering = MappedFile(basePath + ".ord");
+            sortedAvailable = ordering.size() == count * sizeof(uint32_t);
+        }
+    }
+
+    size_t size() const { return count; }
+    bool hasSortedIndex() const { return sortedAvailable; }
+
+    // Look up a record by insertion id
+    DocumentView get(size_t id) const {
+        if (id >= count) {
+            throw std::out_of_range("Document id out of range");
+        }
+        size_t offset = static_cast<size_t>(offsetAt(id));
+        DocumentView view;
+        if (offset > records.size() || !decodeDocument(records.view(), offset, view)) {
+            throw std::runtime_error("Corrupt document record " + std::to_string(id));
+        }
+        return view;
+    }
+
+    // Look up the record at position `rank` in (pageCount, title) order
+    DocumentView getSorted(size_t rank) const {
+        if (!sortedAvailable) {
+            throw std::logic_error("Sorted index is missing or stale");
+        }
+        if (rank >= count) {
+            throw std::out_of_range("Sorted rank out of range");
+        }
+        uint32_t id;
+        std::memcpy(&id, ordering.data() + rank * sizeof(uint32_t), sizeof(id));
+        return get(id);
+    }
+
+    template<typename Visitor>
+    void forEachSorted(Visitor visit) const {
+        for (size_t rank = 0; rank < count; ++rank) {
+            visit(getSorted(rank));
+        }
+    }
+};
+
+/**
+ * Write side: appends records and maintains the offset index
+ */
+class DocumentStoreWriter {
+private:
+    std::string basePath;
+    std::ofstream records;
+    std::ofstream offsets;
+    uint64_t nextOffset;
+    size_t appended;
+    std::string scratch;
+
+public:
+    explicit DocumentStoreWriter(const std::string& base)
+        : basePath(base), appended(0) {
+        records.open(basePath + ".dat", std::ios::binary | std::ios::app);
+        offsets.open(basePath + ".idx", std::ios::binary | std::ios::app);
+        if (!records || !offsets) {
+            throw std::runtime_error("Cannot open document store " + basePath);
+        }
+        records.seekp(0, std::ios::end);
+        nextOffset = static_cast<uint64_t>(records.tellp());
+
+        // Appending makes any existing sorted index stale
+        std::remove((basePath + ".ord").c_str());
+    }
+
+    ~DocumentStoreWriter() {
+        records.flush();
+        offsets.flush();
+    }
+
+    DocumentStoreWriter(const DocumentStoreWriter&) = delete;
+    DocumentStoreWriter& operator=(const DocumentStoreWriter&) = delete;
+
+    void append(const Document& doc) {
+        scratch.clear();
+        encodeDocument(doc, scratch);
+        records.write(scratch.data(), static_cast<std::streamsize>(scratch.size()));
+        offsets.write(reinterpret_cast<const char*>(&nextOffset), sizeof(nextOffset));
+        if (!records || !offsets) {
+            throw std::runtime_error("Write failed for document store " + basePath);
+        }
+        nextOffset += scratch.size();
+        ++appended;
+    }
+
+    size_t appendedCount() const { return appended; }
+
+    /**
+     * Flush the data and rebuild <base>.ord so sorted iteration follows
+     * Document::compareTo order. Sorting reads titles through the mapping.
+     */
+    void finish() {
+        records.flush();
+        offsets.flush();
+
+        DocumentStore store(basePath);
+        if (store.size() > UINT32_MAX) {
+            throw std::length_error("Sorted index supports at most 2^32 documents");
+        }
+
+        struct SortKey {
+            int pageCount;
+            uint32_t id;
+            std::string_view title;
+        };
+        std::vector<SortKey> keys;
+        keys.reserve(store.size());
+        for (size_t id = 0; id < store.size(); ++id) {
+            DocumentView view = store.get(id);
+            keys.push_back(SortKey{view.pageCount, static_cast<uint32_t>(id), view.title});
+        }
+        std::stable_sort(keys.begin(), keys.end(), [](const SortKey& a, const SortKey& b) {
+            if (a.pageCount != b.pageCount) return a.pageCount < b.pageCount;
+            return a.title < b.title;
+        });
+
+        std::string tmpPath = basePath + ".ord.tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            for (const auto& key : keys) {
+                out.write(reinterpret_cast<const char*>(&key.id), sizeof(key.id));
+            }
+            if (!out) {
+                throw std::runtime_error("Cannot write sorted index " + tmpPath);
+            }
+        }
+        // Rename is atomic, so readers never see a half-written index
+        if (std::rename(tmpPath.c_str(), (basePath + ".ord").c_str()) != 0) {
+            throw std::runtime_error("Cannot install sorted index for " + basePath);
+        }
+    }
+};
+
+} // namespace AdvancedConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: What does mmap give you over read()?
+ * A1: The file is paged in lazily by the OS and shared with the page cache,
+ *     so there is no copy into a user buffer and "opening" a huge file is
+ *     O(1). The cost moves to page faults on first touch.
+ *
+ * Q2: Why keep a separate offset index for variable-length records?
+ * A2: Records have different sizes, so record N cannot be located by
+ *     arithmetic. A fixed-width array of offsets gives O(1) random access.
+ *
+ * Q3: How does a persisted secondary index work?
+ * A3: It stores record ids in a different order (here pageCount, then title)
+ *     so sorted scans need no sort at startup. It must be invalidated or
+ *     rebuilt whenever the primary data changes.
+ */
+
+#endif // DOCUMENT_STORE_HPP
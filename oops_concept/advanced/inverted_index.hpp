@@ -0,0 +1,440 @@
+#ifndef INVERTED_INDEX_HPP
+#define INVERTED_INDEX_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "document_codec.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * ===============================================
+ * FULL-TEXT INVERTED INDEX
+ * ===============================================
+ *
+ * Maps every term to the sorted list of document ids containing it, so an
+ * AND query is an intersection of a few lists instead of a scan over every
+ * Document. Pieces:
+ *
+ *   - tokenize():      lower-cased ASCII alphanumeric runs
+ *   - PostingList:     delta-encoded ids; full blocks of 128 are bit-packed
+ *                      at the block's max width, the open tail is varint coded
+ *   - intersectSorted: SSE2 4x4 block compare, galloping for skewed sizes
+ *   - InvertedIndex:   incremental addDocument() plus AND queries
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. What is an inverted index?
+ * 2. Why delta-encode posting lists?
+ * 3. How do you intersect sorted lists quickly?
+ */
+
+namespace AdvancedConcepts {
+
+// ======================= TOKENIZER =======================
+
+/**
+ * Calls emit(std::string_view) for each token. Tokens are written lower-cased
+ * into `buffer`, so the view is only valid during the callback.
+ */
+template<typename Emit>
+void tokenize(std::string_view text, std::string& buffer, Emit emit) {
+    size_t i = 0;
+    while (i < text.size()) {
+        while (i < text.size() && !std::isalnum(static_cast<unsigned char>(text[i]))) ++i;
+        if (i == text.size()) break;
+
+        buffer.clear();
+        while (i < text.size() && std::isalnum(static_cast<unsigned char>(text[i]))) {
+            buffer += static_cast<char>(std::tolower(static_cast<unsigned char>(text[i])));
+            ++i;
+        }
+        emit(std::string_view(buffer));
+    }
+}
+
+// ======================= SORTED-LIST INTERSECTION =======================
+
+inline size_t intersectScalar(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                              uint32_t* out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            ++i;
+        } else if (b[j] < a[i]) {
+            ++j;
+        } else {
+            out[k++] = a[i];
+            ++i;
+            ++j;
+        }
+    }
+    return k;
+}
+
+// For |small| << |large|: binary-search each small element in the remaining large range
+inline size_t intersectGalloping(const uint32_t* small, size_t ns, const uint32_t* large, size_t nl,
+                                 uint32_t* out) {
+    size_t k = 0;
+    const uint32_t* cursor = large;
+    const uint32_t* end = large + nl;
+    for (size_t i = 0; i < ns && cursor != end; ++i) {
+        cursor = std::lower_bound(cursor, end, small[i]);
+        if (cursor != end && *cursor == small[i]) {
+            out[k++] = small[i];
+        }
+    }
+    return k;
+}
+
+/**
+ * Intersection of two strictly increasing arrays into `out`, which must have
+ * room for min(na, nb) values. Returns the number written.
+ */
+inline size_t intersectSorted(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                              uint32_t* out) {
+    if (na > nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (na * 32 < nb) {
+        return intersectGalloping(a, na, b, nb, out);
+    }
+
+#if defined(__SSE2__)
+    size_t i = 0, j = 0, k = 0;
+    while (i + 4 <= na && j + 4 <= nb) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+
+        // Compare every lane of va against every lane of vb via three rotations
+        __m128i match = _mm_cmpeq_epi32(va, vb);
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(match));
+        for (int lane = 0; lane < 4; ++lane) {
+            if (mask & (1 << lane)) {
+                out[k++] = a[i + lane];
+            }
+        }
+
+        uint32_t maxA = a[i + 3];
+        uint32_t maxB = b[j + 3];
+        if (maxA <= maxB) i += 4;
+        if (maxB <= maxA) j += 4;
+    }
+    return k + intersectScalar(a + i, na - i, b + j, nb - j, out + k);
+#else
+    return intersectScalar(a, na, b, nb, out);
+#endif
+}
+
+// ======================= POSTING LIST =======================
+
+/**
+ * Compressed, append-only list of increasing document ids
+ */
+class PostingList {
+public:
+    static constexpr size_t BlockSize = 128;
+
+private:
+    std::vector<uint8_t> packed;        // [width byte][BlockSize * width bits] per block
+    std::vector<uint32_t> blockLast;    // Last id of each block - a one-level skip list
+    std::vector<uint32_t> blockOffset;  // Byte offset of each block in `packed`
+    std::string tail;                   // Varint deltas of the open block
+    uint32_t tailCount = 0;
+    uint32_t lastId = 0;
+    size_t count = 0;
+
+    static uint32_t bitWidth(uint32_t value) {
+        uint32_t width = 0;
+        while (value) {
+            ++width;
+            value >>= 1;
+        }
+        return width;
+    }
+
+    void sealBlock() {
+        uint32_t deltas[BlockSize];
+        uint32_t maxDelta = 0;
+        size_t offset = 0;
+        for (size_t i = 0; i < BlockSize; ++i) {
+            uint64_t value = 0;
+            readVarint(tail, offset, value);
+            deltas[i] = static_cast<uint32_t>(value);
+            maxDelta = std::max(maxDelta, deltas[i]);
+        }
+
+        uint32_t width = bitWidth(maxDelta);
+        blockOffset.push_back(static_cast<uint32_t>(packed.size()));
+        blockLast.push_back(lastId);
+        packed.push_back(static_cast<uint8_t>(width));
+
+        uint64_t buffer = 0;
+        uint32_t bits = 0;
+        for (uint32_t delta : deltas) {
+            buffer |= static_cast<uint64_t>(delta) << bits;
+            bits += width;
+            while (bits >= 8) {
+                packed.push_back(static_cast<uint8_t>(buffer));
+                buffer >>= 8;
+                bits -= 8;
+            }
+        }
+        if (bits > 0) {
+            packed.push_back(static_cast<uint8_t>(buffer));
+        }
+
+        tail.clear();
+        tailCount = 0;
+    }
+
+    // Decode block `block` into out[0..BlockSize), given the id preceding it
+    void decodeBlock(size_t block, uint32_t previous, uint32_t* out) const {
+        const uint8_t* data = packed.data() + blockOffset[block];
+        uint32_t width = *data++;
+        uint64_t mask = (width == 32) ? 0xFFFFFFFFull : ((1ull << width) - 1);
+
+        uint64_t buffer = 0;
+        uint32_t bits = 0;
+        for (size_t i = 0; i < BlockSize; ++i) {
+            while (bits < width) {
+                buffer |= static_cast<uint64_t>(*data++) << bits;
+                bits += 8;
+            }
+            previous += static_cast<uint32_t>(buffer & mask);
+            buffer >>= width;
+            bits -= width;
+            out[i] = previous;
+        }
+    }
+
+    void decodeTail(uint32_t previous, uint32_t* out) const {
+        size_t offset = 0;
+        for (uint32_t i = 0; i < tailCount; ++i) {
+            uint64_t delta = 0;
+            readVarint(tail, offset, delta);
+            previous += static_cast<uint32_t>(delta);
+            out[i] = previous;
+        }
+    }
+
+public:
+    void add(uint32_t docId) {
+        if (count > 0 && docId <= lastId) {
+            throw std::invalid_argument("Posting ids must be strictly increasing");
+        }
+        appendVarint(tail, count == 0 ? docId : docId - lastId);
+        lastId = docId;
+        ++tailCount;
+        ++count;
+        if (tailCount == BlockSize) {
+            sealBlock();
+        }
+    }
+
+    size_t size() const { return count; }
+    uint32_t last() const { return lastId; }
+
+    size_t bytes() const {
+        return packed.size() + tail.size() +
+               (blockLast.size() + blockOffset.size()) * sizeof(uint32_t);
+    }
+
+    void decode(std::vector<uint32_t>& out) const {
+        out.resize(count);
+        uint32_t previous = 0;
+        size_t written = 0;
+        for (size_t block = 0; block < blockLast.size(); ++block) {
+            decodeBlock(block, previous, out.data() + written);
+            written += BlockSize;
+            previous = blockLast[block];
+        }
+        decodeTail(previous, out.data() + written);
+    }
+
+    /**
+     * Keep the candidates that also appear in this list. When candidates are
+     * few, only the blocks that could contain them are decoded.
+     */
+    void intersectInto(const std::vector<uint32_t>& candidates, std::vector<uint32_t>& result,
+                       std::vector<uint32_t>& scratch) const {
+        result.resize(std::min(candidates.size(), count));
+
+        if (candidates.size() * 16 >= count) {
+            decode(scratch);
+            result.resize(intersectSorted(candidates.data(), candidates.size(),
+                                          scratch.data(), scratch.size(), result.data()));
+            return;
+        }
+
+        scratch.resize(BlockSize);
+        size_t decodedBlock = SIZE_MAX;
+        std::vector<uint32_t> tailIds;
+        size_t k = 0;
+        for (uint32_t candidate : candidates) {
+            size_t block = std::lower_bound(blockLast.begin(), blockLast.end(), candidate) - blockLast.begin();
+            const uint32_t* begin;
+            const uint32_t* end;
+            if (block < blockLast.size()) {
+                if (block != decodedBlock) {
+                    decodeBlock(block, block == 0 ? 0 : blockLast[block - 1], scratch.data());
+                    decodedBlock = block;
+                }
+                begin = scratch.data();
+                end = begin + BlockSize;
+            } else {
+                if (tailIds.empty() && tailCount > 0) {
+                    tailIds.resize(tailCount);
+                    decodeTail(blockLast.empty() ? 0 : blockLast.back(), tailIds.data());
+                }
+                begin = tailIds.data();
+                end = begin + tailIds.size();
+            }
+            const uint32_t* found = std::lower_bound(begin, end, candidate);
+            if (found != end && *found == candidate) {
+                result[k++] = candidate;
+            }
+        }
+        result.resize(k);
+    }
+};
+
+// ======================= INDEX =======================
+
+class InvertedIndex {
+private:
+    std::unordered_map<std::string, uint32_t> dictionary;
+    std::vector<PostingList> postings;
+    uint32_t documentCount = 0;
+    std::string tokenBuffer;
+    std::string lookupKey;
+    std::vector<uint32_t> documentTerms;
+
+    void collectTerms(std::string_view text) {
+        tokenize(text, tokenBuffer, [this](std::string_view token) {
+            lookupKey.assign(token.data(), token.size());
+            auto found = dictionary.find(lookupKey);
+            if (found == dictionary.end()) {
+                found = dictionary.emplace(lookupKey, static_cast<uint32_t>(postings.size())).first;
+                postings.emplace_back();
+            }
+            documentTerms.push_back(found->second);
+        });
+    }
+
+public:
+    // Index title, author and content; returns the new document id
+    uint32_t addDocument(const Document& doc) {
+        return addDocument(doc.getTitle(), doc.getAuthor(), doc.getContent());
+    }
+
+    uint32_t addDocument(std::string_view title, std::string_view author, std::string_view content) {
+        uint32_t docId = documentCount++;
+        documentTerms.clear();
+        collectTerms(title);
+        collectTerms(author);
+        collectTerms(content);
+
+        // A term occurring twice in one document is posted once
+        std::sort(documentTerms.begin(), documentTerms.end());
+        documentTerms.erase(std::unique(documentTerms.begin(), documentTerms.end()), documentTerms.end());
+        for (uint32_t term : documentTerms) {
+            postings[term].add(docId);
+        }
+        return docId;
+    }
+
+    // Ids of documents containing every term of `query`, ascending
+    std::vector<uint32_t> search(std::string_view query) const {
+        std::vector<const PostingList*> lists;
+        std::string buffer;
+        bool missing = false;
+        tokenize(query, buffer, [&](std::string_view token) {
+            auto found = dictionary.find(std::string(token));
+            if (found == dictionary.end()) {
+                missing = true;
+            } else {
+                lists.push_back(&postings[found->second]);
+            }
+        });
+
+        std::vector<uint32_t> result;
+        if (missing || lists.empty()) {
+            return result;
+        }
+
+        // Rarest term first keeps every intermediate result small
+        std::sort(lists.begin(), lists.end(),
+                  [](const PostingList* a, const PostingList* b) { return a->size() < b->size(); });
+        lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+        lists.front()->decode(result);
+        std::vector<uint32_t> next;
+        std::vector<uint32_t> scratch;
+        for (size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+            lists[i]->intersectInto(result, next, scratch);
+            result.swap(next);
+        }
+        return result;
+    }
+
+    size_t documentFrequency(const std::string& term) const {
+        auto found = dictionary.find(term);
+        return found == dictionary.end() ? 0 : postings[found->second].size();
+    }
+
+    uint32_t size() const { return documentCount; }
+    size_t termCount() const { return dictionary.size(); }
+
+    size_t postingCount() const {
+        size_t total = 0;
+        for (const auto& list : postings) total += list.size();
+        return total;
+    }
+
+    // Compressed posting bytes plus term text
+    size_t indexBytes() const {
+        size_t total = 0;
+        for (const auto& list : postings) total += list.bytes();
+        for (const auto& entry : dictionary) total += entry.first.size() + sizeof(uint32_t);
+        return total;
+    }
+};
+
+} // namespace AdvancedConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: What is an inverted index?
+ * A1: A map from each term to the documents containing it - the "inverse" of
+ *     a document holding its terms. Queries touch only the lists of the
+ *     query terms instead of every document.
+ *
+ * Q2: Why delta-encode posting lists?
+ * A2: Ids are sorted, so gaps between neighbours are small numbers that fit
+ *     in a few bits. Varint or bit-packing the gaps shrinks lists several
+ *     times over, and smaller lists mean fewer cache misses while scanning.
+ *
+ * Q3: How do you intersect sorted lists quickly?
+ * A3: Start from the rarest term. For similar sizes, a linear merge - here
+ *     comparing 4x4 blocks with SIMD. For very different sizes, gallop or
+ *     binary-search the long list, using block skip pointers so most of it
+ *     is never decompressed.
+ */
+
+#endif // INVERTED_INDEX_HPP
@@ -0,0 +1,367 @@
+#ifndef QUERY_CACHE_HPP
+#define QUERY_CACHE_HPP
+
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * ===============================================
+ * QUERY CACHING - PREPARED STATEMENTS AND RESULTS
+ * ===============================================
+ *
+ * Every DatabaseConnection owns a StatementCache: SQL text is normalized
+ * once (whitespace collapsed, keywords upper-cased, literals replaced by '?')
+ * and the resulting fingerprint maps to a PreparedStatement that remembers
+ * how the query was classified. An optional ResultCache serves repeated
+ * identical reads without re-executing them.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. What is a prepared statement and why is it faster?
+ * 2. How does an LRU cache work?
+ * 3. When must a read-through cache be invalidated?
+ */
+
+namespace AdvancedConcepts {
+
+/**
+ * Normalized, classified form of a SQL statement
+ */
+struct PreparedStatement {
+    uint64_t fingerprint = 0;
+    std::string normalizedSql;
+    size_t parameterCount = 0;
+    bool isWrite = false;       // Anything not known to be a read - invalidates results
+    bool isCacheable = false;   // Plain SELECT/WITH/SHOW/DESCRIBE/EXPLAIN
+    size_t executions = 0;
+};
+
+/**
+ * Collapse whitespace, upper-case everything outside literals and replace
+ * string/numeric literals with '?'. Two queries that differ only in
+ * formatting or literal values share one normalized form.
+ */
+inline std::string normalizeQuery(const std::string& sql, size_t* parameterCount = nullptr) {
+    std::string normalized;
+    normalized.reserve(sql.size());
+    size_t params = 0;
+    bool pendingSpace = false;
+
+    for (size_t i = 0; i < sql.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(sql[i]);
+
+        if (std::isspace(c)) {
+            pendingSpace = !normalized.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            normalized += ' ';
+            pendingSpace = false;
+        }
+
+        if (c == '\'') {
+            // String literal, '' is an escaped quote
+            ++i;
+            while (i < sql.size()) {
+                if (sql[i] == '\'') {
+                    if (i + 1 < sql.size() && sql[i + 1] == '\'') {
+                        i += 2;
+                        continue;
+                    }
+                    break;
+                }
+                ++i;
+            }
+            normalized += '?';
+            ++params;
+        } else if (std::isdigit(c) &&
+                   (normalized.empty() ||
+                    !(std::isalnum(static_cast<unsigned char>(normalized.back())) ||
+                      normalized.back() == '_'))) {
+            // Numeric literal (not part of an identifier such as t1)
+            while (i + 1 < sql.size() &&
+                   (std::isdigit(static_cast<unsigned char>(sql[i + 1])) || sql[i + 1] == '.')) {
+                ++i;
+            }
+            normalized += '?';
+            ++params;
+        } else {
+            normalized += static_cast<char>(std::toupper(c));
+        }
+    }
+
+    while (!normalized.empty() && (normalized.back() == ';' || normalized.back() == ' ')) {
+        normalized.pop_back();
+    }
+
+    if (parameterCount) {
+        *parameterCount = params;
+    }
+    return normalized;
+}
+
+// 64-bit FNV-1a hash of the normalized text
+inline uint64_t fingerprintQuery(const std::string& normalizedSql) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : normalizedSql) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Per-connection cache of prepared statements, bounded with LRU eviction.
+ * Indexed by fingerprint; a hit also requires the normalized SQL to match.
+ */
+class StatementCache {
+private:
+    std::list<PreparedStatement> entries;   // Most recently used at the front
+    std::unordered_map<uint64_t, std::list<PreparedStatement>::iterator> index;
+    size_t capacity;
+    size_t hits;
+    size_t misses;
+
+    static bool startsWithKeyword(const std::string& sql, const char* keyword) {
+        size_t i = 0;
+        for (; keyword[i] != '\0'; ++i) {
+            if (i >= sql.size() || sql[i] != keyword[i]) return false;
+        }
+        return i == sql.size() || sql[i] == ' ' || sql[i] == '(';
+    }
+
+    // True if any word of the normalized SQL is one of the keywords
+    template<size_t N>
+    static bool containsKeyword(const std::string& sql, const char* const (&keywords)[N]) {
+        for (size_t i = 0; i < sql.size();) {
+            if (!std::isalpha(static_cast<unsigned char>(sql[i]))) {
+                ++i;
+                continue;
+            }
+            size_t end = i;
+            while (end < sql.size() &&
+                   (std::isalnum(static_cast<unsigned char>(sql[end])) || sql[end] == '_')) {
+                ++end;
+            }
+            for (const char* keyword : keywords) {
+                if (sql.compare(i, end - i, keyword) == 0) return true;
+            }
+            i = end;
+        }
+        return false;
+    }
+
+    // Only positively identified reads are cacheable. Everything else is a
+    // write, including CALL, SET, GRANT, LOCK, unknown statements and reads
+    // that modify (WITH ... DELETE, SELECT ... INTO, SELECT ... FOR UPDATE).
+    static void classify(PreparedStatement& statement) {
+        static const char* const readKeywords[] = {
+            "SELECT", "WITH", "SHOW", "DESCRIBE", "EXPLAIN"
+        };
+        static const char* const modifyingKeywords[] = {
+            "INSERT", "UPDATE", "DELETE", "REPLACE", "MERGE", "INTO",
+            "CREATE", "DROP", "ALTER", "TRUNCATE", "CALL", "ANALYZE"
+        };
+
+        bool read = false;
+        for (const char* keyword : readKeywords) {
+            if (startsWithKeyword(statement.normalizedSql, keyword)) {
+                read = !containsKeyword(statement.normalizedSql, modifyingKeywords);
+                break;
+            }
+        }
+        statement.isCacheable = read;
+        statement.isWrite = !read;
+    }
+
+public:
+    explicit StatementCache(size_t maxStatements = 256)
+        : capacity(maxStatements == 0 ? 1 : maxStatements), hits(0), misses(0) {}
+
+    // The returned reference stays valid until the next call to prepare()
+    const PreparedStatement& prepare(const std::string& sql) {
+        PreparedStatement candidate;
+        candidate.normalizedSql = normalizeQuery(sql, &candidate.parameterCount);
+        candidate.fingerprint = fingerprintQuery(candidate.normalizedSql);
+
+        auto found = index.find(candidate.fingerprint);
+        if (found != index.end()) {
+            if (found->second->normalizedSql == candidate.normalizedSql) {
+                ++hits;
+                entries.splice(entries.begin(), entries, found->second);
+                ++found->second->executions;
+                return *found->second;
+            }
+            // Fingerprint collision: the newer statement takes the slot
+            entries.erase(found->second);
+            index.erase(found);
+        }
+
+        ++misses;
+        classify(candidate);
+        candidate.executions = 1;
+
+        if (entries.size() >= capacity) {
+            index.erase(entries.back().fingerprint);
+            entries.pop_back();
+        }
+        entries.push_front(std::move(candidate));
+        index[entries.front().fingerprint] = entries.begin();
+        return entries.front();
+    }
+
+    size_t size() const { return entries.size(); }
+    size_t getHits() const { return hits; }
+    size_t getMisses() const { return misses; }
+
+    double hitRate() const {
+        size_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / total;
+    }
+
+    void clear() {
+        entries.clear();
+        index.clear();
+    }
+};
+
+/**
+ * Read-through result cache keyed by exact query text.
+ * Bounded by total bytes of cached rows, least recently used entry evicted first.
+ */
+class ResultCache {
+private:
+    struct Entry {
+        std::string query;
+        std::vector<std::string> rows;
+        size_t bytes;
+        uint64_t executionNanos;   // Cost of the execution this entry replaces
+    };
+
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    size_t maxBytes;
+    size_t currentBytes;
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+    size_t invalidations;
+    uint64_t nanosSaved;   // Execution time of the queries served from the cache
+    uint64_t nanosSpent;   // Time spent in lookups, copies, stores and invalidations
+
+    static size_t footprint(const std::string& query, const std::vector<std::string>& rows) {
+        size_t bytes = query.size();
+        for (const auto& row : rows) {
+            bytes += row.size();
+        }
+        return bytes;
+    }
+
+    void evictUntilFits(size_t incoming) {
+        while (!entries.empty() && currentBytes + incoming > maxBytes) {
+            currentBytes -= entries.back().bytes;
+            index.erase(entries.back().query);
+            entries.pop_back();
+            ++evictions;
+        }
+    }
+
+public:
+    explicit ResultCache(size_t maxCachedBytes = 1 << 20)
+        : maxBytes(maxCachedBytes), currentBytes(0), hits(0), misses(0),
+          evictions(0), invalidations(0), nanosSaved(0), nanosSpent(0) {}
+
+    bool lookup(const std::string& query, std::vector<std::string>& rows) {
+        auto found = index.find(query);
+        if (found == index.end()) {
+            ++misses;
+            return false;
+        }
+
+        ++hits;
+        nanosSaved += found->second->executionNanos;
+        entries.splice(entries.begin(), entries, found->second);
+        rows = found->second->rows;
+        return true;
+    }
+
+    void store(const std::string& query, const std::vector<std::string>& rows,
+               uint64_t executionNanos) {
+        size_t bytes = footprint(query, rows);
+        if (bytes > maxBytes) {
+            return; // Larger than the whole cache, never worth keeping
+        }
+
+        auto found = index.find(query);
+        if (found != index.end()) {
+            currentBytes -= found->second->bytes;
+            entries.erase(found->second);
+            index.erase(found);
+        }
+
+        evictUntilFits(bytes);
+        entries.push_front(Entry{query, rows, bytes, executionNanos});
+        index[entries.front().query] = entries.begin();
+        currentBytes += bytes;
+    }
+
+    void invalidateAll() {
+        if (!entries.empty()) {
+            ++invalidations;
+        }
+        entries.clear();
+        index.clear();
+        currentBytes = 0;
+    }
+
+    size_t size() const { return entries.size(); }
+    size_t bytesUsed() const { return currentBytes; }
+    size_t getHits() const { return hits; }
+    size_t getMisses() const { return misses; }
+    size_t getEvictions() const { return evictions; }
+    size_t getInvalidations() const { return invalidations; }
+    uint64_t getGrossNanosSaved() const { return nanosSaved; }
+    uint64_t getNanosSpent() const { return nanosSpent; }
+
+    // Negative when the cache costs more than the executions it replaces
+    int64_t getNetNanosSaved() const {
+        return static_cast<int64_t>(nanosSaved) - static_cast<int64_t>(nanosSpent);
+    }
+
+    // Callers time their cache operations and charge them here
+    void chargeOverhead(uint64_t nanos) { nanosSpent += nanos; }
+
+    double hitRate() const {
+        size_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / total;
+    }
+};
+
+} // namespace AdvancedConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: What is a prepared statement and why is it faster?
+ * A1: The statement is parsed and planned once, then re-executed with new
+ *     parameter values. Normalizing literals to '?' lets queries that differ
+ *     only in values share the same prepared statement.
+ *
+ * Q2: How does an LRU cache work?
+ * A2: A hash map gives O(1) lookup into a doubly linked list ordered by
+ *     recency. A hit splices the node to the front; eviction pops the back.
+ *
+ * Q3: When must a read-through cache be invalidated?
+ * A3: Whenever the underlying data may have changed: after any write, and
+ *     at commit/rollback. Reads inside a transaction that already wrote must
+ *     bypass the cache, since they may observe uncommitted data. A statement
+ *     that cannot be proven read-only (CALL, WITH ... DELETE) counts as a write.
+ */
+
+#endif // QUERY_CACHE_HPP
@@ -0,0 +1,320 @@
+#ifndef RETAINED_UI_HPP
+#define RETAINED_UI_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#include "abstraction.hpp"
+
+/**
+ * ===============================================
+ * RETAINED-MODE UI RENDERING
+ * ===============================================
+ *
+ * Application::renderUI() is immediate mode: every frame calls render() on
+ * every visible component, and a click is broadcast to all of them.
+ * RetainedScene keeps the component tree between frames instead:
+ *
+ *   - only components flagged dirty (UIComponent::isDirty) are re-rendered
+ *   - dirty components are batched into one command list per concrete type
+ *   - component bounds live in an R-tree, so a click is routed to the single
+ *     topmost component under the cursor in O(log n)
+ *
+ * Output goes through a RenderBackend: ConsoleBackend calls render() as
+ * before, HeadlessBackend only counts work (for tests and benchmarks).
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Immediate mode vs retained mode rendering?
+ * 2. Why batch draw calls by type?
+ * 3. How does an R-tree answer point queries?
+ */
+
+namespace AdvancedConcepts {
+
+struct Rect {
+    float x = 0, y = 0, width = 0, height = 0;
+
+    bool contains(float px, float py) const {
+        return px >= x && py >= y && px < x + width && py < y + height;
+    }
+
+    Rect unite(const Rect& other) const {
+        float left = std::min(x, other.x);
+        float top = std::min(y, other.y);
+        float right = std::max(x + width, other.x + other.width);
+        float bottom = std::max(y + height, other.y + other.height);
+        return Rect{left, top, right - left, bottom - top};
+    }
+};
+
+/**
+ * Static R-tree over rectangles, bulk loaded with Sort-Tile-Recursive packing
+ */
+class SpatialIndex {
+public:
+    static constexpr size_t Fanout = 16;
+
+private:
+    struct Node {
+        Rect bounds;
+        uint32_t first;  // First child in the level below (or first entry for leaves)
+        uint32_t count;
+    };
+
+    std::vector<std::vector<Node>> levels;  // levels[0] are leaves, back() holds the root
+    std::vector<uint32_t> entries;          // Item ids in leaf order
+    std::vector<Rect> entryBounds;
+
+    template<typename Visit>
+    void descend(size_t level, uint32_t nodeIndex, float px, float py, Visit& visit) const {
+        const Node& node = levels[level][nodeIndex];
+        if (!node.bounds.contains(px, py)) return;
+
+        if (level == 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                if (entryBounds[i].contains(px, py)) visit(entries[i]);
+            }
+            return;
+        }
+        for (uint32_t child = node.first; child < node.first + node.count; ++child) {
+            descend(level - 1, child, px, py, visit);
+        }
+    }
+
+public:
+    void build(const std::vector<Rect>& bounds) {
+        levels.clear();
+        entries.resize(bounds.size());
+        for (uint32_t i = 0; i < bounds.size(); ++i) entries[i] = i;
+        if (bounds.empty()) {
+            entryBounds.clear();
+            return;
+        }
+
+        // STR: sort by x centre into vertical slices, then by y centre within each slice
+        auto centreX = [&](uint32_t id) { return bounds[id].x + bounds[id].width / 2; };
+        auto centreY = [&](uint32_t id) { return bounds[id].y + bounds[id].height / 2; };
+        size_t leafCount = (bounds.size() + Fanout - 1) / Fanout;
+        size_t sliceCount = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(leafCount))));
+        size_t sliceSize = sliceCount * Fanout;
+
+        std::sort(entries.begin(), entries.end(),
+                  [&](uint32_t a, uint32_t b) { return centreX(a) < centreX(b); });
+        for (size_t start = 0; start < entries.size(); start += sliceSize) {
+            auto end = entries.begin() + std::min(entries.size(), start + sliceSize);
+            std::sort(entries.begin() + start, end,
+                      [&](uint32_t a, uint32_t b) { return centreY(a) < centreY(b); });
+        }
+
+        entryBounds.resize(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i) entryBounds[i] = bounds[entries[i]];
+
+        std::vector<Node> level;
+        for (size_t start = 0; start < entries.size(); start += Fanout) {
+            uint32_t count = static_cast<uint32_t>(std::min(Fanout, entries.size() - start));
+            Rect box = entryBounds[start];
+            for (size_t i = start + 1; i < start + count; ++i) box = box.unite(entryBounds[i]);
+            level.push_back(Node{box, static_cast<uint32_t>(start), count});
+        }
+        levels.push_back(std::move(level));
+
+        while (levels.back().size() > 1) {
+            const std::vector<Node>& below = levels.back();
+            std::vector<Node> above;
+            for (size_t start = 0; start < below.size(); start += Fanout) {
+                uint32_t count = static_cast<uint32_t>(std::min(Fanout, below.size() - start));
+                Rect box = below[start].bounds;
+                for (size_t i = start + 1; i < start + count; ++i) box = box.unite(below[i].bounds);
+                above.push_back(Node{box, static_cast<uint32_t>(start), count});
+            }
+            levels.push_back(std::move(above));
+        }
+    }
+
+    // Calls visit(id) for every rectangle containing the point
+    template<typename Visit>
+    void query(float px, float py, Visit visit) const {
+        if (levels.empty()) return;
+        descend(levels.size() - 1, 0, px, py, visit);
+    }
+};
+
+/**
+ * One draw (or erase, when !visible) of a component in a batch
+ */
+struct RenderCommand {
+    UIComponent* component;
+    Rect bounds;
+    bool visible;
+};
+
+struct RenderBatch {
+    std::string typeName;
+    std::vector<RenderCommand> commands;
+};
+
+class RenderBackend {
+public:
+    virtual ~RenderBackend() = default;
+    virtual void drawBatch(const RenderBatch& batch) = 0;
+};
+
+/**
+ * Delegates to each component's own render() - same output as immediate mode
+ */
+class ConsoleBackend : public RenderBackend {
+public:
+    void drawBatch(const RenderBatch& batch) override {
+        for (const auto& command : batch.commands) {
+            if (command.visible) {
+                command.component->render();
+            }
+        }
+    }
+};
+
+/**
+ * Counts work without producing output
+ */
+class HeadlessBackend : public RenderBackend {
+private:
+    size_t batches = 0;
+    size_t draws = 0;
+    size_t erases = 0;
+
+public:
+    void drawBatch(const RenderBatch& batch) override {
+        ++batches;
+        for (const auto& command : batch.commands) {
+            if (command.visible) ++draws;
+            else ++erases;
+        }
+    }
+
+    size_t getBatches() const { return batches; }
+    size_t getDraws() const { return draws; }
+    size_t getErases() const { return erases; }
+    void reset() { batches = draws = erases = 0; }
+};
+
+/**
+ * Retained component tree with dirty tracking, type batching and hit-testing
+ */
+class RetainedScene {
+private:
+    std::vector<std::unique_ptr<UIComponent>> components;  // Index = node id = z-order
+    std::vector<Rect> bounds;
+    std::vector<uint32_t> batchOf;                          // Node id -> batch slot
+    std::unordered_map<std::type_index, uint32_t> batchSlots;
+    std::vector<RenderBatch> batches;
+    SpatialIndex spatialIndex;
+    bool geometryChanged = false;
+
+public:
+    uint32_t add(std::unique_ptr<UIComponent> component, const Rect& area) {
+        const UIComponent& ref = *component;
+        auto slot = batchSlots.find(std::type_index(typeid(ref)));
+        if (slot == batchSlots.end()) {
+            slot = batchSlots.emplace(std::type_index(typeid(ref)),
+                                      static_cast<uint32_t>(batches.size())).first;
+            batches.push_back(RenderBatch{typeid(ref).name(), {}});
+        }
+
+        component->markDirty();
+        components.push_back(std::move(component));
+        bounds.push_back(area);
+        batchOf.push_back(slot->second);
+        geometryChanged = true;
+        return static_cast<uint32_t>(components.size() - 1);
+    }
+
+    UIComponent& get(uint32_t id) { return *components.at(id); }
+    size_t size() const { return components.size(); }
+
+    void setBounds(uint32_t id, const Rect& area) {
+        bounds.at(id) = area;
+        components[id]->markDirty();
+        geometryChanged = true;
+    }
+
+    void invalidateAll() {
+        for (auto& component : components) component->markDirty();
+    }
+
+    /**
+     * Re-render only dirty components, one batch per concrete type.
+     * Returns the number of components re-rendered (or erased).
+     */
+    size_t renderFrame(RenderBackend& backend) {
+        for (auto& batch : batches) batch.commands.clear();
+
+        size_t changed = 0;
+        for (uint32_t id = 0; id < components.size(); ++id) {
+            UIComponent* component = components[id].get();
+            if (!component->isDirty()) continue;
+            batches[batchOf[id]].commands.push_back(RenderCommand{component, bounds[id], component->isVisible()});
+            component->clearDirty();
+            ++changed;
+        }
+
+        for (const auto& batch : batches) {
+            if (!batch.commands.empty()) backend.drawBatch(batch);
+        }
+        return changed;
+    }
+
+    // Topmost visible component under the point, or nullptr
+    UIComponent* hitTest(float x, float y) {
+        if (geometryChanged) {
+            spatialIndex.build(bounds);
+            geometryChanged = false;
+        }
+
+        int64_t best = -1;
+        spatialIndex.query(x, y, [&](uint32_t id) {
+            if (static_cast<int64_t>(id) > best && components[id]->isVisible()) {
+                best = id;
+            }
+        });
+        return best < 0 ? nullptr : components[static_cast<size_t>(best)].get();
+    }
+
+    // Route a click to the component under the cursor only
+    bool click(float x, float y) {
+        UIComponent* target = hitTest(x, y);
+        if (!target) return false;
+        target->handleClick();
+        return true;
+    }
+};
+
+} // namespace AdvancedConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Immediate mode vs retained mode rendering?
+ * A1: Immediate mode re-issues every draw each frame from application code.
+ *     Retained mode keeps a scene between frames, so the framework knows what
+ *     changed and can redraw only that.
+ *
+ * Q2: Why batch draw calls by type?
+ * A2: Consecutive draws of the same kind share state (shaders, textures,
+ *     code paths), so grouping them avoids state switches and keeps the
+ *     per-type loop hot in the instruction cache.
+ *
+ * Q3: How does an R-tree answer point queries?
+ * A3: Every node stores the bounding box of its children. A query descends
+ *     only into nodes whose box contains the point, so for non-overlapping
+ *     layouts it visits O(log n) nodes instead of every component.
+ */
+
+#endif // RETAINED_UI_HPP
@@ -0,0 +1,337 @@
+#ifndef ACCOUNT_STORE_HPP
+#define ACCOUNT_STORE_HPP
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * ===============================================
+ * SHARDED CONCURRENT ACCOUNT STORE
+ * ===============================================
+ *
+ * BankAccount is a single unsynchronized object. AccountStore holds many
+ * accounts and is safe to use from many threads:
+ *
+ *   - accounts are spread over shards by hash of the account number; each
+ *     shard's map is guarded by its own shared_mutex, taken exclusively only
+ *     to open accounts and shared for everything else
+ *   - balances are std::atomic<int64_t> cents, so deposits and withdrawals
+ *     on different accounts - or even the same account - never block
+ *   - batch calls sort operations by shard and take each shard lock once
+ *   - operation counters are striped per thread on their own cache lines,
+ *     apart from the shard mutex, and summed when statistics are read
+ *
+ * Validation matches BankAccount: withdrawals and balance reads need the
+ * account's PIN, deposits (anyone may pay in) do not. Nothing is printed on
+ * the hot path.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Why shard a concurrent map?
+ * 2. How do you withdraw with atomics and never go negative?
+ * 3. What is false sharing?
+ */
+
+namespace BasicConcepts {
+
+enum class AccountOpStatus {
+    Ok,
+    InsufficientFunds,
+    NoSuchAccount,
+    AccountInactive,
+    InvalidAmount,
+    InvalidPin
+};
+
+struct AccountOp {
+    std::string accountNumber;
+    double amount;
+    std::string pin;    // Checked by withdrawBatch, ignored by depositBatch
+};
+
+struct ShardStats {
+    size_t accounts;
+    uint64_t deposits;
+    uint64_t withdrawals;
+    uint64_t rejected;      // Insufficient funds, inactive account or wrong PIN
+    uint64_t lookups;
+};
+
+class AccountStore {
+private:
+    struct alignas(64) Account {   // One cache line per hot balance
+        std::atomic<int64_t> cents{0};
+        std::atomic<bool> active{true};
+        std::string holder;
+        std::string pin;
+    };
+
+    // One stripe of a shard's operation counters, a cache line of its own
+    struct alignas(64) Counters {
+        std::atomic<uint64_t> deposits{0};
+        std::atomic<uint64_t> withdrawals{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> lookups{0};
+    };
+
+    static constexpr size_t CounterStripes = 16;
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, std::unique_ptr<Account>> accounts;
+        mutable Counters counters[CounterStripes];   // Indexed by stripeOfThisThread()
+    };
+
+    std::vector<Shard> shards;
+    size_t shardMask;
+
+    static int64_t toCents(double amount) {
+        return static_cast<int64_t>(std::llround(amount * 100.0));
+    }
+
+    size_t shardOf(const std::string& accountNumber) const {
+        return std::hash<std::string>{}(accountNumber) & shardMask;
+    }
+
+    // Threads take stripes round-robin, so up to CounterStripes threads
+    // count on the same shard without sharing a line
+    static size_t stripeOfThisThread() {
+        static std::atomic<size_t> nextStripe{0};
+        thread_local size_t stripe = nextStripe.fetch_add(1, std::memory_order_relaxed) % CounterStripes;
+        return stripe;
+    }
+
+    static Counters& countersOf(const Shard& shard) {
+        return shard.counters[stripeOfThisThread()];
+    }
+
+    // Caller holds the shard lock (shared is enough)
+    static Account* findLocked(const Shard& shard, const std::string& accountNumber) {
+        countersOf(shard).lookups.fetch_add(1, std::memory_order_relaxed);
+        auto it = shard.accounts.find(accountNumber);
+        return it == shard.accounts.end() ? nullptr : it->second.get();
+    }
+
+    static AccountOpStatus depositInto(Shard& shard, Account* account, int64_t cents) {
+        if (!account) return AccountOpStatus::NoSuchAccount;
+        if (cents <= 0) return AccountOpStatus::InvalidAmount;
+        if (!account->active.load(std::memory_order_acquire)) {
+            countersOf(shard).rejected.fetch_add(1, std::memory_order_relaxed);
+            return AccountOpStatus::AccountInactive;
+        }
+        account->cents.fetch_add(cents, std::memory_order_relaxed);
+        countersOf(shard).deposits.fetch_add(1, std::memory_order_relaxed);
+        return AccountOpStatus::Ok;
+    }
+
+    static AccountOpStatus withdrawFrom(Shard& shard, Account* account, int64_t cents,
+                                        const std::string& pin) {
+        if (!account) return AccountOpStatus::NoSuchAccount;
+        if (cents <= 0) return AccountOpStatus::InvalidAmount;
+        if (!account->active.load(std::memory_order_acquire)) {
+            countersOf(shard).rejected.fetch_add(1, std::memory_order_relaxed);
+            return AccountOpStatus::AccountInactive;
+        }
+        if (account->pin != pin) {   // Set once in openAccount, never written again
+            countersOf(shard).rejected.fetch_add(1, std::memory_order_relaxed);
+            return AccountOpStatus::InvalidPin;
+        }
+        // CAS loop: only subtract if the balance we saw still covers the amount
+        int64_t current = account->cents.load(std::memory_order_relaxed);
+        do {
+            if (current < cents) {
+                countersOf(shard).rejected.fetch_add(1, std::memory_order_relaxed);
+                return AccountOpStatus::InsufficientFunds;
+            }
+        } while (!account->cents.compare_exchange_weak(current, current - cents,
+                                                       std::memory_order_relaxed));
+        countersOf(shard).withdrawals.fetch_add(1, std::memory_order_relaxed);
+        return AccountOpStatus::Ok;
+    }
+
+    template<typename Apply>
+    std::vector<AccountOpStatus> applyBatch(const std::vector<AccountOp>& ops, Apply apply) {
+        std::vector<AccountOpStatus> results(ops.size(), AccountOpStatus::NoSuchAccount);
+
+        // Bucket op indices by shard so each shard lock is taken once
+        std::vector<std::vector<uint32_t>> byShard(shards.size());
+        for (uint32_t i = 0; i < ops.size(); ++i) {
+            byShard[shardOf(ops[i].accountNumber)].push_back(i);
+        }
+        for (size_t s = 0; s < shards.size(); ++s) {
+            if (byShard[s].empty()) continue;
+            Shard& shard = shards[s];
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (uint32_t i : byShard[s]) {
+                results[i] = apply(shard, findLocked(shard, ops[i].accountNumber), ops[i]);
+            }
+        }
+        return results;
+    }
+
+public:
+    explicit AccountStore(size_t shardCount = 64) {
+        if (shardCount == 0 || (shardCount & (shardCount - 1)) != 0) {
+            throw std::invalid_argument("Shard count must be a power of two");
+        }
+        shards = std::vector<Shard>(shardCount);
+        shardMask = shardCount - 1;
+    }
+
+    AccountStore(const AccountStore&) = delete;
+    AccountStore& operator=(const AccountStore&) = delete;
+
+    // Same rules as the BankAccount constructor
+    void openAccount(const std::string& holder, const std::string& accountNumber,
+                     const std::string& pin, double initialBalance = 0.0) {
+        if (holder.empty()) {
+            throw std::invalid_argument("Account holder name cannot be empty");
+        }
+        if (accountNumber.length() < 10) {
+            throw std::invalid_argument("Account number must be at least 10 digits");
+        }
+        if (pin.length() != 4) {
+            throw std::invalid_argument("PIN must be exactly 4 digits");
+        }
+        if (initialBalance < 0) {
+            throw std::invalid_argument("Initial balance cannot be negative");
+        }
+
+        auto account = std::make_unique<Account>();
+        account->cents.store(toCents(initialBalance), std::memory_order_relaxed);
+        account->holder = holder;
+        account->pin = pin;
+
+        Shard& shard = shards[shardOf(accountNumber)];
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (!shard.accounts.emplace(accountNumber, std::move(account)).second) {
+            throw std::invalid_argument("Account " + accountNumber + " already exists");
+        }
+    }
+
+    // ======================= SINGLE OPERATIONS =======================
+    AccountOpStatus deposit(const std::string& accountNumber, double amount) {
+        Shard& shard = shards[shardOf(accountNumber)];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return depositInto(shard, findLocked(shard, accountNumber), toCents(amount));
+    }
+
+    AccountOpStatus withdraw(const std::string& accountNumber, double amount, const std::string& pin) {
+        Shard& shard = shards[shardOf(accountNumber)];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return withdrawFrom(shard, findLocked(shard, accountNumber), toCents(amount), pin);
+    }
+
+    // Throws like BankAccount::getBalance for an inactive account or wrong PIN
+    double getBalance(const std::string& accountNumber, const std::string& pin) const {
+        const Shard& shard = shards[shardOf(accountNumber)];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        Account* account = findLocked(shard, accountNumber);
+        if (!account) {
+            throw std::invalid_argument("No such account: " + accountNumber);
+        }
+        if (!account->active.load(std::memory_order_acquire)) {
+            throw std::runtime_error("Account is not active");
+        }
+        if (account->pin != pin) {
+            throw std::runtime_error("Invalid PIN");
+        }
+        return static_cast<double>(account->cents.load(std::memory_order_relaxed)) / 100.0;
+    }
+
+    std::string getHolder(const std::string& accountNumber) const {
+        const Shard& shard = shards[shardOf(accountNumber)];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        Account* account = findLocked(shard, accountNumber);
+        if (!account) {
+            throw std::invalid_argument("No such account: " + accountNumber);
+        }
+        return account->holder;
+    }
+
+    void setActive(const std::string& accountNumber, bool active) {
+        Shard& shard = shards[shardOf(accountNumber)];
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        Account* account = findLocked(shard, accountNumber);
+        if (!account) {
+            throw std::invalid_argument("No such account: " + accountNumber);
+        }
+        account->active.store(active, std::memory_order_release);
+    }
+
+    // ======================= BATCH OPERATIONS =======================
+    std::vector<AccountOpStatus> depositBatch(const std::vector<AccountOp>& ops) {
+        return applyBatch(ops, [](Shard& shard, Account* account, const AccountOp& op) {
+            return depositInto(shard, account, toCents(op.amount));
+        });
+    }
+
+    std::vector<AccountOpStatus> withdrawBatch(const std::vector<AccountOp>& ops) {
+        return applyBatch(ops, [](Shard& shard, Account* account, const AccountOp& op) {
+            return withdrawFrom(shard, account, toCents(op.amount), op.pin);
+        });
+    }
+
+    // ======================= STATISTICS =======================
+    size_t shardCount() const { return shards.size(); }
+
+    ShardStats shardStats(size_t shardIndex) const {
+        const Shard& shard = shards.at(shardIndex);
+        ShardStats stats{0, 0, 0, 0, 0};
+        for (const Counters& stripe : shard.counters) {
+            stats.deposits += stripe.deposits.load(std::memory_order_relaxed);
+            stats.withdrawals += stripe.withdrawals.load(std::memory_order_relaxed);
+            stats.rejected += stripe.rejected.load(std::memory_order_relaxed);
+            stats.lookups += stripe.lookups.load(std::memory_order_relaxed);
+        }
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        stats.accounts = shard.accounts.size();
+        return stats;
+    }
+
+    ShardStats totalStats() const {
+        ShardStats total{0, 0, 0, 0, 0};
+        for (size_t s = 0; s < shards.size(); ++s) {
+            ShardStats one = shardStats(s);
+            total.accounts += one.accounts;
+            total.deposits += one.deposits;
+            total.withdrawals += one.withdrawals;
+            total.rejected += one.rejected;
+            total.lookups += one.lookups;
+        }
+        return total;
+    }
+};
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Why shard a concurrent map?
+ * A1: One lock around the whole map serializes every thread. With N shards
+ *     chosen by hash, threads touching different shards never contend, and
+ *     a reader-writer lock lets lookups in the same shard run in parallel.
+ *
+ * Q2: How do you withdraw with atomics and never go negative?
+ * A2: Load the balance, check it covers the amount, and compare_exchange the
+ *     new value in. If another thread changed the balance meanwhile the CAS
+ *     fails, reloads the current value, and the check runs again.
+ *
+ * Q3: What is false sharing?
+ * A3: Two independent variables on the same cache line make cores bounce
+ *     that line between them on every write. Aligning each hot account, each
+ *     shard and each counter stripe to 64 bytes keeps them on separate lines.
+ */
+
+#endif // ACCOUNT_STORE_HPP
@@ -1,9 +1,12 @@
 #ifndef CLASS_OBJECT_HPP
 #define CLASS_OBJECT_HPP
 
+#include <cmath>
 #include <iostream>
 #include <string>
 #include <vector>
+#include "instance_counter.hpp"
+#include "../other_concepts/trace.hpp"
 
 /**
  * ===============================================
@@ -160,33 +163,35 @@ public:
  */
 class Counter {
 private:
-    static int totalObjects; // Static member variable
+    // C++17 inline static member: defined here, so every TU can include this header
+    static inline InstanceCounter totalObjects{"Counter"}; // Static member variable (thread-safe)
     int objectId;
 
 public:
-    Counter() : objectId(++totalObjects) {
-        std::cout << "Counter object " << objectId << " created\n";
+    Counter() : objectId(static_cast<int>(totalObjects.onConstruct())) {
+        OOPS_TRACE(Debug, Lifecycle, "Counter object ", objectId, " created");
     }
     
+    // A copy is a new object with its own id
+    Counter(const Counter&) : Counter() {}
+    
     ~Counter() {
-        std::cout << "Counter object " << objectId << " destroyed\n";
+        totalObjects.onDestroy();
+        OOPS_TRACE(Debug, Lifecycle, "Counter object ", objectId, " destroyed");
     }
     
     int getId() const { return objectId; }
     
     // Static member function
     static int getTotalObjects() {
-        return totalObjects; // Can only access static members
+        return static_cast<int>(totalObjects.createdCount()); // Can only access static members
     }
     
     static void resetCounter() {
-        totalObjects = 0;
+        totalObjects.reset();
     }
 };
 
-// Static member definition (required outside class)
-int Counter::totalObjects = 0;
-
 /**
  * Constructor Types Demonstration
  */
@@ -321,6 +326,8 @@ public:
  * A5: Static members belong to the class, not to any specific object.
  *     - Static variables: Shared among all objects
  *     - Static functions: Can be called without creating objects
+ *     - Before C++17 a static variable needed one out-of-class definition in a
+ *       .cpp file; "static inline" lets a header define it for every TU
  * 
  * Q6: What is a friend function?
  * A6: A friend function can access private and protected members of a class.
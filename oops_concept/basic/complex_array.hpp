@@ -0,0 +1,395 @@
+#ifndef COMPLEX_ARRAY_HPP
+#define COMPLEX_ARRAY_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "polymorphism.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * ===============================================
+ * COMPLEX ARRAYS AND FFT
+ * ===============================================
+ *
+ * Complex is a fine value type, but a std::vector<Complex> interleaves real
+ * and imaginary parts, so vector code has to shuffle every element apart
+ * before it can multiply. ComplexArray stores the two parts in separate
+ * arrays ("split" layout): an SSE2 register then holds two real parts or two
+ * imaginary parts and a complex multiply is four multiplies and two adds.
+ *
+ * On top of that:
+ *   - addArrays / multiplyArrays / conjMultiplyArrays element-wise kernels
+ *   - FFTPlan: iterative radix-4 FFT (plus one radix-2 stage for odd
+ *     powers of two) with bit-reversal and twiddle tables built once
+ *   - FFTPlanCache: plans shared by size, used by fft / ifft / fftBatch
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Why is struct-of-arrays better for SIMD than array-of-structs?
+ * 2. Why precompute twiddle factors?
+ * 3. What does radix-4 buy over radix-2?
+ */
+
+namespace BasicConcepts {
+
+// ======================= COMPLEX ARRAY =======================
+
+class ComplexArray {
+private:
+    std::vector<double> re;
+    std::vector<double> im;
+
+public:
+    ComplexArray() = default;
+    explicit ComplexArray(size_t n) : re(n, 0.0), im(n, 0.0) {}
+
+    explicit ComplexArray(const std::vector<Complex>& values) : re(values.size()), im(values.size()) {
+        for (size_t i = 0; i < values.size(); ++i) {
+            re[i] = values[i].getReal();
+            im[i] = values[i].getImaginary();
+        }
+    }
+
+    size_t size() const { return re.size(); }
+
+    void resize(size_t n) {
+        re.resize(n, 0.0);
+        im.resize(n, 0.0);
+    }
+
+    Complex operator[](size_t i) const { return Complex(re[i], im[i]); }
+
+    void set(size_t i, const Complex& value) {
+        re[i] = value.getReal();
+        im[i] = value.getImaginary();
+    }
+
+    double* real() { return re.data(); }
+    double* imag() { return im.data(); }
+    const double* real() const { return re.data(); }
+    const double* imag() const { return im.data(); }
+
+    std::vector<Complex> toComplexVector() const {
+        std::vector<Complex> values;
+        values.reserve(size());
+        for (size_t i = 0; i < size(); ++i) values.emplace_back(re[i], im[i]);
+        return values;
+    }
+};
+
+// ======================= ELEMENT-WISE KERNELS =======================
+
+inline void checkSameSize(const ComplexArray& a, const ComplexArray& b, ComplexArray& out) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("Complex arrays must have the same size");
+    }
+    out.resize(a.size());
+}
+
+// out = a + b (out may alias a or b)
+inline void addArrays(const ComplexArray& a, const ComplexArray& b, ComplexArray& out) {
+    checkSameSize(a, b, out);
+    const double *ar = a.real(), *ai = a.imag(), *br = b.real(), *bi = b.imag();
+    double *outr = out.real(), *outi = out.imag();
+    size_t n = a.size(), i = 0;
+#if defined(__SSE2__)
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(outr + i, _mm_add_pd(_mm_loadu_pd(ar + i), _mm_loadu_pd(br + i)));
+        _mm_storeu_pd(outi + i, _mm_add_pd(_mm_loadu_pd(ai + i), _mm_loadu_pd(bi + i)));
+    }
+#endif
+    for (; i < n; ++i) {
+        outr[i] = ar[i] + br[i];
+        outi[i] = ai[i] + bi[i];
+    }
+}
+
+// out = a * b (out may alias a or b)
+inline void multiplyArrays(const ComplexArray& a, const ComplexArray& b, ComplexArray& out) {
+    checkSameSize(a, b, out);
+    const double *ar = a.real(), *ai = a.imag(), *br = b.real(), *bi = b.imag();
+    double *outr = out.real(), *outi = out.imag();
+    size_t n = a.size(), i = 0;
+#if defined(__SSE2__)
+    for (; i + 2 <= n; i += 2) {
+        __m128d xr = _mm_loadu_pd(ar + i), xi = _mm_loadu_pd(ai + i);
+        __m128d yr = _mm_loadu_pd(br + i), yi = _mm_loadu_pd(bi + i);
+        _mm_storeu_pd(outr + i, _mm_sub_pd(_mm_mul_pd(xr, yr), _mm_mul_pd(xi, yi)));
+        _mm_storeu_pd(outi + i, _mm_add_pd(_mm_mul_pd(xr, yi), _mm_mul_pd(xi, yr)));
+    }
+#endif
+    for (; i < n; ++i) {
+        double xr = ar[i], xi = ai[i];
+        outr[i] = xr * br[i] - xi * bi[i];
+        outi[i] = xr * bi[i] + xi * br[i];
+    }
+}
+
+// out = a * conj(b), the core of correlation (out may alias a or b)
+inline void conjMultiplyArrays(const ComplexArray& a, const ComplexArray& b, ComplexArray& out) {
+    checkSameSize(a, b, out);
+    const double *ar = a.real(), *ai = a.imag(), *br = b.real(), *bi = b.imag();
+    double *outr = out.real(), *outi = out.imag();
+    size_t n = a.size(), i = 0;
+#if defined(__SSE2__)
+    for (; i + 2 <= n; i += 2) {
+        __m128d xr = _mm_loadu_pd(ar + i), xi = _mm_loadu_pd(ai + i);
+        __m128d yr = _mm_loadu_pd(br + i), yi = _mm_loadu_pd(bi + i);
+        _mm_storeu_pd(outr + i, _mm_add_pd(_mm_mul_pd(xr, yr), _mm_mul_pd(xi, yi)));
+        _mm_storeu_pd(outi + i, _mm_sub_pd(_mm_mul_pd(xi, yr), _mm_mul_pd(xr, yi)));
+    }
+#endif
+    for (; i < n; ++i) {
+        double xr = ar[i], xi = ai[i];
+        outr[i] = xr * br[i] + xi * bi[i];
+        outi[i] = xi * br[i] - xr * bi[i];
+    }
+}
+
+// ======================= FFT PLAN =======================
+
+/**
+ * Forward transform: X[k] = sum x[n] e^(-2 pi i k n / N); the inverse is
+ * scaled by 1/N so inverse(forward(x)) == x. N must be a power of two.
+ */
+class FFTPlan {
+private:
+    // Twiddles for one radix-4 stage: w^j, w^2j, w^3j for j < quarter
+    struct Stage {
+        size_t quarter;
+        std::vector<double> w1r, w1i, w2r, w2i, w3r, w3i;
+    };
+
+    size_t n;
+    bool leadingRadix2;
+    std::vector<uint32_t> bitReverse;
+    std::vector<Stage> stages;
+
+    void permute(double* re, double* im) const {
+        for (size_t i = 0; i < n; ++i) {
+            size_t j = bitReverse[i];
+            if (i < j) {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+    }
+
+    static void radix2(double* re, double* im, size_t n) {
+        for (size_t i = 0; i < n; i += 2) {
+            double r = re[i + 1], m = im[i + 1];
+            re[i + 1] = re[i] - r;
+            im[i + 1] = im[i] - m;
+            re[i] += r;
+            im[i] += m;
+        }
+    }
+
+    /**
+     * Combines four quarter-length DFTs A0..A3 (of x[4n], x[4n+2], x[4n+1],
+     * x[4n+3]) into one: with a = A0, b = w^2j A1, c = w^j A2, d = w^3j A3
+     *   X[j]    = (a + b) + (c + d)      X[j+2q] = (a + b) - (c + d)
+     *   X[j+q]  = (a - b) - i(c - d)     X[j+3q] = (a - b) + i(c - d)
+     */
+    static void radix4Scalar(double* re, double* im, size_t q, const Stage& s, size_t j) {
+        size_t i0 = j, i1 = j + q, i2 = j + 2 * q, i3 = j + 3 * q;
+        double ar = re[i0], ai = im[i0];
+        double br = re[i1] * s.w2r[j] - im[i1] * s.w2i[j], bi = re[i1] * s.w2i[j] + im[i1] * s.w2r[j];
+        double cr = re[i2] * s.w1r[j] - im[i2] * s.w1i[j], ci = re[i2] * s.w1i[j] + im[i2] * s.w1r[j];
+        double dr = re[i3] * s.w3r[j] - im[i3] * s.w3i[j], di = re[i3] * s.w3i[j] + im[i3] * s.w3r[j];
+        double t0r = ar + br, t0i = ai + bi, t1r = ar - br, t1i = ai - bi;
+        double t2r = cr + dr, t2i = ci + di, t3r = cr - dr, t3i = ci - di;
+        re[i0] = t0r + t2r; im[i0] = t0i + t2i;
+        re[i2] = t0r - t2r; im[i2] = t0i - t2i;
+        re[i1] = t1r + t3i; im[i1] = t1i - t3r;
+        re[i3] = t1r - t3i; im[i3] = t1i + t3r;
+    }
+
+#if defined(__SSE2__)
+    static void mulTwiddle(__m128d xr, __m128d xi, const double* wr, const double* wi, __m128d& outr, __m128d& outi) {
+        __m128d cr = _mm_loadu_pd(wr), ci = _mm_loadu_pd(wi);
+        outr = _mm_sub_pd(_mm_mul_pd(xr, cr), _mm_mul_pd(xi, ci));
+        outi = _mm_add_pd(_mm_mul_pd(xr, ci), _mm_mul_pd(xi, cr));
+    }
+
+    // Same butterfly for j and j + 1
+    static void radix4Sse2(double* re, double* im, size_t q, const Stage& s, size_t j) {
+        double *r0 = re + j, *r1 = r0 + q, *r2 = r1 + q, *r3 = r2 + q;
+        double *m0 = im + j, *m1 = m0 + q, *m2 = m1 + q, *m3 = m2 + q;
+        __m128d ar = _mm_loadu_pd(r0), ai = _mm_loadu_pd(m0), br, bi, cr, ci, dr, di;
+        mulTwiddle(_mm_loadu_pd(r1), _mm_loadu_pd(m1), &s.w2r[j], &s.w2i[j], br, bi);
+        mulTwiddle(_mm_loadu_pd(r2), _mm_loadu_pd(m2), &s.w1r[j], &s.w1i[j], cr, ci);
+        mulTwiddle(_mm_loadu_pd(r3), _mm_loadu_pd(m3), &s.w3r[j], &s.w3i[j], dr, di);
+        __m128d t0r = _mm_add_pd(ar, br), t0i = _mm_add_pd(ai, bi);
+        __m128d t1r = _mm_sub_pd(ar, br), t1i = _mm_sub_pd(ai, bi);
+        __m128d t2r = _mm_add_pd(cr, dr), t2i = _mm_add_pd(ci, di);
+        __m128d t3r = _mm_sub_pd(cr, dr), t3i = _mm_sub_pd(ci, di);
+        _mm_storeu_pd(r0, _mm_add_pd(t0r, t2r)); _mm_storeu_pd(m0, _mm_add_pd(t0i, t2i));
+        _mm_storeu_pd(r2, _mm_sub_pd(t0r, t2r)); _mm_storeu_pd(m2, _mm_sub_pd(t0i, t2i));
+        _mm_storeu_pd(r1, _mm_add_pd(t1r, t3i)); _mm_storeu_pd(m1, _mm_sub_pd(t1i, t3r));
+        _mm_storeu_pd(r3, _mm_sub_pd(t1r, t3i)); _mm_storeu_pd(m3, _mm_add_pd(t1i, t3r));
+    }
+#endif
+
+public:
+    explicit FFTPlan(size_t size) : n(size), leadingRadix2(false) {
+        if (n == 0 || (n & (n - 1)) != 0 || n > (size_t(1) << 31)) {
+            throw std::invalid_argument("FFT size must be a power of two");
+        }
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < n) ++bits;
+
+        bitReverse.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t r = 0;
+            for (unsigned b = 0; b < bits; ++b) r |= ((i >> b) & 1u) << (bits - 1 - b);
+            bitReverse[i] = r;
+        }
+
+        leadingRadix2 = bits % 2 == 1;
+        const double pi = std::acos(-1.0);
+        for (size_t length = leadingRadix2 ? 8 : 4; length <= n; length *= 4) {
+            Stage stage;
+            stage.quarter = length / 4;
+            for (size_t j = 0; j < stage.quarter; ++j) {
+                double angle = -2.0 * pi * static_cast<double>(j) / static_cast<double>(length);
+                stage.w1r.push_back(std::cos(angle));
+                stage.w1i.push_back(std::sin(angle));
+                stage.w2r.push_back(std::cos(2 * angle));
+                stage.w2i.push_back(std::sin(2 * angle));
+                stage.w3r.push_back(std::cos(3 * angle));
+                stage.w3i.push_back(std::sin(3 * angle));
+            }
+            stages.push_back(std::move(stage));
+        }
+    }
+
+    size_t size() const { return n; }
+
+    // In place on n contiguous values
+    void forward(double* re, double* im) const {
+        permute(re, im);
+        if (leadingRadix2) radix2(re, im, n);
+        for (const Stage& stage : stages) {
+            size_t q = stage.quarter;
+            for (size_t block = 0; block < n; block += 4 * q) {
+                double* r = re + block;
+                double* m = im + block;
+                size_t j = 0;
+#if defined(__SSE2__)
+                for (; j + 2 <= q; j += 2) radix4Sse2(r, m, q, stage, j);
+#endif
+                for (; j < q; ++j) radix4Scalar(r, m, q, stage, j);
+            }
+        }
+    }
+
+    // inverse(x) = conj(forward(conj(x))) / n
+    void inverse(double* re, double* im) const {
+        for (size_t i = 0; i < n; ++i) im[i] = -im[i];
+        forward(re, im);
+        double scale = 1.0 / static_cast<double>(n);
+        for (size_t i = 0; i < n; ++i) {
+            re[i] *= scale;
+            im[i] *= -scale;
+        }
+    }
+
+    void forward(ComplexArray& data) const {
+        checkSize(data);
+        forward(data.real(), data.imag());
+    }
+
+    void inverse(ComplexArray& data) const {
+        checkSize(data);
+        inverse(data.real(), data.imag());
+    }
+
+private:
+    void checkSize(const ComplexArray& data) const {
+        if (data.size() != n) {
+            throw std::invalid_argument("Array size does not match FFT plan");
+        }
+    }
+};
+
+// ======================= PLAN CACHE =======================
+
+class FFTPlanCache {
+private:
+    std::mutex mutex;
+    std::unordered_map<size_t, std::shared_ptr<const FFTPlan>> plans;
+
+    FFTPlanCache() = default;
+
+public:
+    static FFTPlanCache& instance() {
+        static FFTPlanCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const FFTPlan> get(size_t n) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = plans.find(n);
+        if (it != plans.end()) return it->second;
+        auto plan = std::make_shared<const FFTPlan>(n);
+        plans.emplace(n, plan);
+        return plan;
+    }
+
+    size_t planCount() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return plans.size();
+    }
+};
+
+inline void fft(ComplexArray& data) {
+    FFTPlanCache::instance().get(data.size())->forward(data);
+}
+
+inline void ifft(ComplexArray& data) {
+    FFTPlanCache::instance().get(data.size())->inverse(data);
+}
+
+// Transforms data.size() / frameSize consecutive frames with one plan lookup
+inline void fftBatch(ComplexArray& frames, size_t frameSize, bool inverse = false) {
+    if (frameSize == 0 || frames.size() % frameSize != 0) {
+        throw std::invalid_argument("Batch size must be a multiple of the frame size");
+    }
+    std::shared_ptr<const FFTPlan> plan = FFTPlanCache::instance().get(frameSize);
+    for (size_t offset = 0; offset < frames.size(); offset += frameSize) {
+        if (inverse) plan->inverse(frames.real() + offset, frames.imag() + offset);
+        else plan->forward(frames.real() + offset, frames.imag() + offset);
+    }
+}
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Why is struct-of-arrays better for SIMD than array-of-structs?
+ * A1: A vector register wants the same field of neighbouring elements.
+ *     With {re, im} pairs every multiply needs shuffles to separate the
+ *     parts; with split arrays the loads feed the arithmetic directly.
+ *
+ * Q2: Why precompute twiddle factors?
+ * A2: cos/sin cost tens of cycles each. A plan computes them once per size,
+ *     laid out per stage so the butterfly loop reads them sequentially.
+ *
+ * Q3: What does radix-4 buy over radix-2?
+ * A3: Half as many passes over the data, and the factors +-i are free
+ *     (a swap and a sign change), so fewer multiplies and less memory
+ *     traffic for the same transform.
+ */
+
+#endif // COMPLEX_ARRAY_HPP
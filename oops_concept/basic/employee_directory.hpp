@@ -0,0 +1,351 @@
+#ifndef EMPLOYEE_DIRECTORY_HPP
+#define EMPLOYEE_DIRECTORY_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "encapsulation.hpp"
+
+/**
+ * ===============================================
+ * EMPLOYEE DIRECTORY - COLUMNAR STORAGE WITH INDEXES
+ * ===============================================
+ *
+ * A std::vector<Employee> answers "who is in Engineering?" or "who earns
+ * between 50k and 60k?" only by scanning every object. EmployeeDirectory
+ * stores the same fields column by column (struct of arrays) and keeps
+ * secondary indexes next to the columns:
+ *
+ *   id          -> row       hash index
+ *   department  -> rows      hash index (departments are dictionary encoded)
+ *   salary      -> rows      sorted index, rebuilt lazily after changes
+ *   skill       -> rows      one bitmap per SkillRegistry id
+ *
+ * Rows are dense uint32 positions; every query returns rows, and the column
+ * getters turn a row back into values.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Array of structs vs struct of arrays?
+ * 2. Hash index vs ordered index - which queries does each serve?
+ * 3. Why bitmap indexes for low-cardinality attributes?
+ */
+
+namespace BasicConcepts {
+
+/**
+ * Fixed-universe bitset over directory rows
+ */
+class RowBitmap {
+private:
+    std::vector<uint64_t> words;
+
+public:
+    void set(uint32_t row) {
+        size_t word = row / 64;
+        if (word >= words.size()) words.resize(word + 1, 0);
+        words[word] |= uint64_t(1) << (row % 64);
+    }
+
+    void reset(uint32_t row) {
+        size_t word = row / 64;
+        if (word < words.size()) words[word] &= ~(uint64_t(1) << (row % 64));
+    }
+
+    bool test(uint32_t row) const {
+        size_t word = row / 64;
+        return word < words.size() && (words[word] >> (row % 64)) & 1;
+    }
+
+    size_t count() const {
+        size_t total = 0;
+        for (uint64_t w : words) total += static_cast<size_t>(__builtin_popcountll(w));
+        return total;
+    }
+
+    void intersectWith(const RowBitmap& other) {
+        if (words.size() > other.words.size()) words.resize(other.words.size());
+        for (size_t i = 0; i < words.size(); ++i) words[i] &= other.words[i];
+    }
+
+    void uniteWith(const RowBitmap& other) {
+        if (words.size() < other.words.size()) words.resize(other.words.size(), 0);
+        for (size_t i = 0; i < other.words.size(); ++i) words[i] |= other.words[i];
+    }
+
+    template<typename Visit>
+    void forEach(Visit visit) const {
+        for (size_t i = 0; i < words.size(); ++i) {
+            uint64_t w = words[i];
+            while (w) {
+                visit(static_cast<uint32_t>(i * 64 + __builtin_ctzll(w)));
+                w &= w - 1;
+            }
+        }
+    }
+
+    std::vector<uint32_t> toRows() const {
+        std::vector<uint32_t> rows;
+        forEach([&](uint32_t row) { rows.push_back(row); });
+        return rows;
+    }
+};
+
+class PayrollBatch;
+
+class EmployeeDirectory {
+    friend class PayrollBatch;  // Bulk payroll works on the columns directly
+
+public:
+    static constexpr double MaxSalary = Employee::MaxSalary;
+    static constexpr int MaxExperience = Employee::MaxExperience;
+
+private:
+    // Columns - one entry per row
+    std::vector<int> ids;
+    std::vector<std::string> names;
+    std::vector<uint32_t> departmentCodes;
+    std::vector<double> salaries;
+    std::vector<int> experience;
+    std::vector<uint8_t> active;
+
+    // Dictionaries
+    std::vector<std::string> departmentNames;
+    std::unordered_map<std::string, uint32_t> departmentCodeOf;
+
+    // Indexes
+    std::unordered_map<int, uint32_t> rowOfId;
+    std::vector<std::vector<uint32_t>> departmentRows;      // By department code
+    std::vector<RowBitmap> skillRows;                        // By SkillRegistry id
+    mutable std::vector<std::pair<double, uint32_t>> salaryIndex;
+    mutable bool salaryIndexStale = false;
+
+    // Bumped by every change to the salary, experience or active columns, so
+    // an open PayrollBatch can tell its staged copies are out of date
+    uint64_t version = 0;
+
+    static uint32_t intern(const std::string& value, std::vector<std::string>& values,
+                           std::unordered_map<std::string, uint32_t>& codes) {
+        auto it = codes.find(value);
+        if (it != codes.end()) return it->second;
+        uint32_t code = static_cast<uint32_t>(values.size());
+        values.push_back(value);
+        codes.emplace(value, code);
+        return code;
+    }
+
+    void checkRow(uint32_t row) const {
+        if (row >= ids.size()) {
+            throw std::out_of_range("Employee row out of range");
+        }
+    }
+
+    const RowBitmap* rowsWithSkill(const std::string& skill) const {
+        int64_t code = SkillRegistry::instance().find(skill);
+        if (code < 0 || static_cast<size_t>(code) >= skillRows.size()) return nullptr;
+        return &skillRows[static_cast<size_t>(code)];
+    }
+
+    void rebuildSalaryIndex() const {
+        salaryIndex.resize(salaries.size());
+        for (uint32_t row = 0; row < salaries.size(); ++row) {
+            salaryIndex[row] = {salaries[row], row};
+        }
+        std::sort(salaryIndex.begin(), salaryIndex.end());
+        salaryIndexStale = false;
+    }
+
+public:
+    void reserve(size_t count) {
+        ids.reserve(count);
+        names.reserve(count);
+        departmentCodes.reserve(count);
+        salaries.reserve(count);
+        experience.reserve(count);
+        active.reserve(count);
+        rowOfId.reserve(count);
+    }
+
+    /**
+     * Bulk-load path: validates like the Employee constructor, no console output
+     */
+    uint32_t add(int id, const std::string& fullName, const std::string& department,
+                 double salary, int years, bool isActive = true,
+                 const std::vector<std::string>& skills = {}) {
+        if (fullName.empty()) {
+            throw std::invalid_argument("Invalid name");
+        }
+        if (!(salary >= 0 && salary <= MaxSalary)) {   // Rejects NaN, which would break the salary index sort
+            throw std::invalid_argument("Invalid salary");
+        }
+        if (years < 0 || years > MaxExperience) {
+            throw std::invalid_argument("Invalid experience");
+        }
+        if (ids.size() >= UINT32_MAX) {
+            throw std::length_error("EmployeeDirectory supports at most 2^32 - 1 rows");
+        }
+
+        uint32_t row = static_cast<uint32_t>(ids.size());
+        if (!rowOfId.emplace(id, row).second) {
+            throw std::invalid_argument("Duplicate employee id " + std::to_string(id));
+        }
+
+        uint32_t dept = intern(department, departmentNames, departmentCodeOf);
+        if (dept == departmentRows.size()) departmentRows.emplace_back();
+        departmentRows[dept].push_back(row);
+
+        ids.push_back(id);
+        names.push_back(fullName);
+        departmentCodes.push_back(dept);
+        salaries.push_back(salary);
+        experience.push_back(years);
+        active.push_back(isActive ? 1 : 0);
+        salaryIndexStale = true;
+        ++version;
+
+        for (const auto& skill : skills) {
+            addSkill(row, skill);
+        }
+        return row;
+    }
+
+    uint32_t add(const Employee& employee) {
+        uint32_t row = add(employee.getEmployeeId(), employee.getFullName(), employee.getDepartment(),
+                           employee.getSalary(), employee.getExperience(), employee.getActiveStatus());
+        for (const auto& skill : employee.getSkills()) {
+            addSkill(row, skill);
+        }
+        return row;
+    }
+
+    void addSkill(uint32_t row, const std::string& skill) {
+        checkRow(row);
+        if (skill.empty()) {
+            throw std::invalid_argument("Skill cannot be empty");
+        }
+        uint32_t code = SkillRegistry::instance().intern(skill);
+        if (code >= skillRows.size()) skillRows.resize(code + 1);
+        skillRows[code].set(row);   // Setting an existing bit is a no-op
+    }
+
+    void setSalary(uint32_t row, double salary) {
+        checkRow(row);
+        if (!(salary >= 0 && salary <= MaxSalary)) {
+            throw std::invalid_argument("Invalid salary");
+        }
+        salaries[row] = salary;
+        salaryIndexStale = true;
+        ++version;
+    }
+
+    void setActive(uint32_t row, bool isActive) {
+        checkRow(row);
+        active[row] = isActive ? 1 : 0;
+        ++version;
+    }
+
+    // ======================= COLUMN ACCESS =======================
+    size_t size() const { return ids.size(); }
+    int id(uint32_t row) const { checkRow(row); return ids[row]; }
+    const std::string& name(uint32_t row) const { checkRow(row); return names[row]; }
+    const std::string& department(uint32_t row) const { checkRow(row); return departmentNames[departmentCodes[row]]; }
+    double salary(uint32_t row) const { checkRow(row); return salaries[row]; }
+    int yearsOfExperience(uint32_t row) const { checkRow(row); return experience[row]; }
+    bool isActive(uint32_t row) const { checkRow(row); return active[row] != 0; }
+
+    bool hasSkill(uint32_t row, const std::string& skill) const {
+        int64_t code = SkillRegistry::instance().find(skill);
+        return code >= 0 && static_cast<size_t>(code) < skillRows.size() && skillRows[static_cast<size_t>(code)].test(row);
+    }
+
+    size_t departmentCount() const { return departmentNames.size(); }
+
+    // ======================= QUERIES =======================
+    // Row of an employee id, or -1
+    int64_t findById(int employeeId) const {
+        auto it = rowOfId.find(employeeId);
+        return it == rowOfId.end() ? -1 : static_cast<int64_t>(it->second);
+    }
+
+    // Rows in a department, in insertion order
+    const std::vector<uint32_t>& inDepartment(const std::string& dept) const {
+        static const std::vector<uint32_t> none;
+        auto it = departmentCodeOf.find(dept);
+        return it == departmentCodeOf.end() ? none : departmentRows[it->second];
+    }
+
+    // Rows with minSalary <= salary <= maxSalary, lowest salary first
+    std::vector<uint32_t> salaryBetween(double minSalary, double maxSalary) const {
+        if (salaryIndexStale) rebuildSalaryIndex();
+        auto first = std::lower_bound(salaryIndex.begin(), salaryIndex.end(),
+                                      std::make_pair(minSalary, uint32_t(0)));
+        auto last = std::upper_bound(first, salaryIndex.end(),
+                                     std::make_pair(maxSalary, UINT32_MAX));
+        std::vector<uint32_t> rows;
+        rows.reserve(static_cast<size_t>(last - first));
+        for (auto it = first; it != last; ++it) rows.push_back(it->second);
+        return rows;
+    }
+
+    size_t countSalaryBetween(double minSalary, double maxSalary) const {
+        if (salaryIndexStale) rebuildSalaryIndex();
+        auto first = std::lower_bound(salaryIndex.begin(), salaryIndex.end(),
+                                      std::make_pair(minSalary, uint32_t(0)));
+        auto last = std::upper_bound(first, salaryIndex.end(),
+                                     std::make_pair(maxSalary, UINT32_MAX));
+        return static_cast<size_t>(last - first);
+    }
+
+    // Rows having every listed skill
+    RowBitmap withAllSkills(const std::vector<std::string>& skills) const {
+        RowBitmap result;
+        bool first = true;
+        for (const auto& skill : skills) {
+            const RowBitmap* rows = rowsWithSkill(skill);
+            if (!rows) return RowBitmap();
+            if (first) {
+                result = *rows;
+                first = false;
+            } else {
+                result.intersectWith(*rows);
+            }
+        }
+        return result;
+    }
+
+    // Rows having at least one listed skill
+    RowBitmap withAnySkill(const std::vector<std::string>& skills) const {
+        RowBitmap result;
+        for (const auto& skill : skills) {
+            if (const RowBitmap* rows = rowsWithSkill(skill)) result.uniteWith(*rows);
+        }
+        return result;
+    }
+};
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Array of structs vs struct of arrays?
+ * A1: AoS keeps one object's fields together - good when you use the whole
+ *     object. SoA keeps one field of all objects together, so a query over
+ *     salaries reads only salaries and every cache line is fully used.
+ *
+ * Q2: Hash index vs ordered index - which queries does each serve?
+ * A2: A hash index answers equality (id == 42, dept == "Sales") in O(1) but
+ *     has no order. A sorted index answers ranges and ordering in
+ *     O(log n + k) via binary search.
+ *
+ * Q3: Why bitmap indexes for low-cardinality attributes?
+ * A3: One bit per row per value is compact when values are few, and
+ *     AND/OR of conditions become word-wide bit operations over the maps.
+ */
+
+#endif // EMPLOYEE_DIRECTORY_HPP
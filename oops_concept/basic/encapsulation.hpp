@@ -5,6 +5,11 @@
 #include <string>
 #include <vector>
 #include <stdexcept>
+#include <cstdint>
+#include <atomic>
+#include <utility>
+#include "skill_set.hpp"
+#include "../other_concepts/trace.hpp"
 
 /**
  * ===============================================
@@ -22,6 +27,9 @@ namespace BasicConcepts {
  * Demonstrates: Private data members, public interface, data validation
  */
 class BankAccount {
+public:
+    class Session;  // Authenticated handle, see login()
+
 private:
     // Private data members - hidden from outside world
     std::string accountHolder;
@@ -29,6 +37,14 @@ private:
     double balance;
     std::string pin;
     bool isActive;
+    uint64_t authGeneration = nextGeneration();   // Replaced whenever existing sessions must stop working
+    
+    // Drawn from one process-wide counter, so an account assigned over or
+    // built at a reused address never matches a session it did not issue
+    static uint64_t nextGeneration() {
+        static std::atomic<uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
     
     // Private helper methods
     bool validatePin(const std::string& inputPin) const {
@@ -40,11 +56,66 @@ private:
     }
     
     void logTransaction(const std::string& operation, double amount) {
-        std::cout << "[LOG] " << operation << " of $" << amount 
-                  << " on account " << accountNumber << std::endl;
+        OOPS_TRACE(Debug, Account, "[LOG] ", operation, " of $", amount, " on account ", accountNumber);
+    }
+    
+    void checkPinAccess(const std::string& inputPin) const {
+        if (!isAccountActive()) {
+            throw std::runtime_error("Account is not active");
+        }
+        if (!validatePin(inputPin)) {
+            throw std::runtime_error("Invalid PIN");
+        }
+    }
+    
+    void checkSession(const Session& session) const {
+        if (!isSessionValid(session)) {
+            throw std::runtime_error("Session expired");
+        }
+    }
+    
+    void applyDeposit(double amount) {
+        if (amount <= 0) {
+            throw std::invalid_argument("Deposit amount must be positive");
+        }
+        
+        balance += amount;
+        logTransaction("Deposit", amount);
+        OOPS_TRACE(Info, Account, "Deposited $", amount, ". New balance: $", balance);
+    }
+    
+    bool applyWithdrawal(double amount) {
+        if (amount <= 0) {
+            throw std::invalid_argument("Withdrawal amount must be positive");
+        }
+        if (amount > balance) {
+            OOPS_TRACE(Error, Account, "Insufficient funds. Available balance: $", balance);
+            return false;
+        }
+        
+        balance -= amount;
+        logTransaction("Withdrawal", amount);
+        OOPS_TRACE(Info, Account, "Withdrawn $", amount, ". New balance: $", balance);
+        return true;
     }
 
 public:
+    /**
+     * Capability handed out by login(). Holding one proves the PIN was
+     * checked; it stays valid until the PIN changes, the account is
+     * deactivated, or the account is assigned to or moved from. Only
+     * BankAccount can create one.
+     */
+    class Session {
+    private:
+        friend class BankAccount;
+        const BankAccount* account;
+        uint64_t generation;
+        
+        Session(const BankAccount* acc, uint64_t gen) : account(acc), generation(gen) {}
+    };
+    
+
     // Constructor with validation
     BankAccount(const std::string& holder, const std::string& accNum, 
                 const std::string& userPin, double initialBalance = 0.0) {
@@ -67,7 +138,43 @@ public:
         balance = initialBalance;
         isActive = true;
         
-        std::cout << "Bank account created for " << accountHolder << std::endl;
+        OOPS_TRACE(Info, Account, "Bank account created for ", accountHolder);
+    }
+    
+    // Copies and moves never carry sessions over: both sides get a fresh generation
+    BankAccount(const BankAccount& other)
+        : accountHolder(other.accountHolder), accountNumber(other.accountNumber), balance(other.balance),
+          pin(other.pin), isActive(other.isActive) {}
+    
+    BankAccount(BankAccount&& other) noexcept
+        : accountHolder(std::move(other.accountHolder)), accountNumber(std::move(other.accountNumber)),
+          balance(other.balance), pin(std::move(other.pin)), isActive(other.isActive) {
+        other.authGeneration = nextGeneration();
+    }
+    
+    BankAccount& operator=(const BankAccount& other) {
+        if (this != &other) {
+            accountHolder = other.accountHolder;
+            accountNumber = other.accountNumber;
+            balance = other.balance;
+            pin = other.pin;
+            isActive = other.isActive;
+        }
+        authGeneration = nextGeneration();
+        return *this;
+    }
+    
+    BankAccount& operator=(BankAccount&& other) noexcept {
+        if (this != &other) {
+            accountHolder = std::move(other.accountHolder);
+            accountNumber = std::move(other.accountNumber);
+            balance = other.balance;
+            pin = std::move(other.pin);
+            isActive = other.isActive;
+            other.authGeneration = nextGeneration();
+        }
+        authGeneration = nextGeneration();
+        return *this;
     }
     
     // Controlled access through public methods
@@ -87,67 +194,62 @@ public:
     
     // Controlled access to balance (requires authentication)
     double getBalance(const std::string& inputPin) const {
-        if (!isAccountActive()) {
-            throw std::runtime_error("Account is not active");
-        }
-        if (!validatePin(inputPin)) {
-            throw std::runtime_error("Invalid PIN");
-        }
+        checkPinAccess(inputPin);
+        return balance;
+    }
+    
+    // Authenticate once; the returned session authorizes later calls
+    Session login(const std::string& inputPin) const {
+        checkPinAccess(inputPin);
+        return Session(this, authGeneration);
+    }
+    
+    // One integer compare instead of a PIN compare - no string handling
+    bool isSessionValid(const Session& session) const {
+        return session.account == this && session.generation == authGeneration;
+    }
+    
+    double getBalance(const Session& session) const {
+        checkSession(session);
         return balance;
     }
     
     // Controlled deposit operation
     void deposit(double amount, const std::string& inputPin) {
-        if (!isAccountActive()) {
-            throw std::runtime_error("Account is not active");
-        }
-        if (!validatePin(inputPin)) {
-            throw std::runtime_error("Invalid PIN");
-        }
-        if (amount <= 0) {
-            throw std::invalid_argument("Deposit amount must be positive");
-        }
-        
-        balance += amount;
-        logTransaction("Deposit", amount);
-        std::cout << "Deposited $" << amount << ". New balance: $" << balance << std::endl;
+        checkPinAccess(inputPin);
+        applyDeposit(amount);
+    }
+    
+    void deposit(double amount, const Session& session) {
+        checkSession(session);
+        applyDeposit(amount);
     }
     
     // Controlled withdrawal operation
     bool withdraw(double amount, const std::string& inputPin) {
-        if (!isAccountActive()) {
-            throw std::runtime_error("Account is not active");
-        }
-        if (!validatePin(inputPin)) {
-            throw std::runtime_error("Invalid PIN");
-        }
-        if (amount <= 0) {
-            throw std::invalid_argument("Withdrawal amount must be positive");
-        }
-        if (amount > balance) {
-            std::cout << "Insufficient funds. Available balance: $" << balance << std::endl;
-            return false;
-        }
-        
-        balance -= amount;
-        logTransaction("Withdrawal", amount);
-        std::cout << "Withdrawn $" << amount << ". New balance: $" << balance << std::endl;
-        return true;
+        checkPinAccess(inputPin);
+        return applyWithdrawal(amount);
     }
     
+    bool withdraw(double amount, const Session& session) {
+        checkSession(session);
+        return applyWithdrawal(amount);
+    }
+
     // Controlled PIN change
     bool changePin(const std::string& oldPin, const std::string& newPin) {
         if (!validatePin(oldPin)) {
-            std::cout << "Invalid current PIN" << std::endl;
+            OOPS_TRACE(Error, Account, "Invalid current PIN");
             return false;
         }
         if (newPin.length() != 4) {
-            std::cout << "New PIN must be exactly 4 digits" << std::endl;
+            OOPS_TRACE(Error, Account, "New PIN must be exactly 4 digits");
             return false;
         }
         
         pin = newPin;
-        std::cout << "PIN changed successfully" << std::endl;
+        authGeneration = nextGeneration();  // Sessions opened with the old PIN end here
+        OOPS_TRACE(Info, Account, "PIN changed successfully");
         return true;
     }
     
@@ -157,7 +259,8 @@ public:
             throw std::runtime_error("Invalid PIN");
         }
         isActive = false;
-        std::cout << "Account deactivated" << std::endl;
+        authGeneration = nextGeneration();
+        OOPS_TRACE(Info, Account, "Account deactivated");
     }
     
     void activateAccount(const std::string& inputPin) {
@@ -165,7 +268,7 @@ public:
             throw std::runtime_error("Invalid PIN");
         }
         isActive = true;
-        std::cout << "Account activated" << std::endl;
+        OOPS_TRACE(Info, Account, "Account activated");
     }
 };
 
@@ -173,8 +276,12 @@ public:
  * Employee Class - Real-world Encapsulation Example
  */
 class Employee {
+public:
+    static constexpr double MaxSalary = 1000000;  // Salary cap
+    static constexpr int MaxExperience = 50;      // Years
+
 private:
-    static int nextEmployeeId;  // Static counter for unique IDs
+    static inline int nextEmployeeId = 1000;  // Static counter for unique IDs
     
     int employeeId;
     std::string firstName;
@@ -183,7 +290,7 @@ private:
     double salary;
     int yearsOfExperience;
     bool isActive;
-    std::vector<std::string> skills;
+    SkillSet skills;            // Interned ids, see skill_set.hpp
     
     // Private validation methods
     bool isValidName(const std::string& name) const {
@@ -191,11 +298,11 @@ private:
     }
     
     bool isValidSalary(double sal) const {
-        return sal >= 0 && sal <= 1000000; // Max salary cap
+        return sal >= 0 && sal <= MaxSalary; // Also false for NaN
     }
     
     bool isValidExperience(int years) const {
-        return years >= 0 && years <= 50;
+        return years >= 0 && years <= MaxExperience;
     }
 
 public:
@@ -219,8 +326,7 @@ public:
         salary = sal;
         yearsOfExperience = exp;
         
-        std::cout << "Employee " << getFullName() << " created with ID: " 
-                  << employeeId << std::endl;
+        OOPS_TRACE(Info, Employee, "Employee ", getFullName(), " created with ID: ", employeeId);
     }
     
     // Read-only access methods
@@ -237,7 +343,7 @@ public:
             throw std::runtime_error("Cannot update inactive employee");
         }
         department = newDept;
-        std::cout << "Department updated to: " << newDept << std::endl;
+        OOPS_TRACE(Info, Employee, "Department updated to: ", newDept);
     }
     
     void increaseSalary(double percentage) {
@@ -256,7 +362,7 @@ public:
         }
         
         salary = newSalary;
-        std::cout << "Salary increased by " << percentage << "% to $" << salary << std::endl;
+        OOPS_TRACE(Info, Employee, "Salary increased by ", percentage, "% to $", salary);
     }
     
     void addExperience(int additionalYears) {
@@ -273,7 +379,7 @@ public:
         }
         
         yearsOfExperience = newExperience;
-        std::cout << "Experience updated to " << yearsOfExperience << " years" << std::endl;
+        OOPS_TRACE(Info, Employee, "Experience updated to ", yearsOfExperience, " years");
     }
     
     void addSkill(const std::string& skill) {
@@ -284,30 +390,33 @@ public:
             throw std::invalid_argument("Skill cannot be empty");
         }
         
-        // Check if skill already exists
-        for (const auto& existingSkill : skills) {
-            if (existingSkill == skill) {
-                std::cout << "Skill '" << skill << "' already exists" << std::endl;
-                return;
-            }
+        if (!skills.insert(skill)) {
+            OOPS_TRACE(Info, Employee, "Skill '", skill, "' already exists");
+            return;
         }
-        
-        skills.push_back(skill);
-        std::cout << "Skill '" << skill << "' added" << std::endl;
+        OOPS_TRACE(Info, Employee, "Skill '", skill, "' added");
+    }
+    
+    bool hasSkill(const std::string& skill) const {
+        return skills.contains(skill);
     }
     
-    std::vector<std::string> getSkills() const {
-        return skills; // Return copy, not reference
+    SkillView getSkills() const {
+        return skills.view(); // Read-only view, no copies
+    }
+    
+    const SkillSet& getSkillSet() const {
+        return skills;
     }
     
     void deactivate() {
         isActive = false;
-        std::cout << "Employee " << getFullName() << " deactivated" << std::endl;
+        OOPS_TRACE(Info, Employee, "Employee ", getFullName(), " deactivated");
     }
     
     void activate() {
         isActive = true;
-        std::cout << "Employee " << getFullName() << " activated" << std::endl;
+        OOPS_TRACE(Info, Employee, "Employee ", getFullName(), " activated");
     }
     
     void displayInfo() const {
@@ -319,17 +428,16 @@ public:
         std::cout << "Experience: " << yearsOfExperience << " years" << std::endl;
         std::cout << "Status: " << (isActive ? "Active" : "Inactive") << std::endl;
         std::cout << "Skills: ";
-        for (size_t i = 0; i < skills.size(); ++i) {
-            std::cout << skills[i];
-            if (i < skills.size() - 1) std::cout << ", ";
+        bool first = true;
+        for (const auto& skill : skills.view()) {
+            if (!first) std::cout << ", ";
+            std::cout << skill;
+            first = false;
         }
         std::cout << std::endl;
     }
 };
 
-// Static member initialization
-int Employee::nextEmployeeId = 1000;
-
 // ======================= DEMONSTRATION FUNCTION =======================
 inline void demonstrateEncapsulation() {
     std::cout << "\n===== ENCAPSULATION DEMO =====\n" << std::endl;
@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include "instance_counter.hpp"
+#include "../other_concepts/trace.hpp"
 
 /**
  * ===============================================
@@ -35,20 +37,26 @@ protected:
     std::string model;
     int year;
     double price;
-    static int totalVehicles; // Static member shared by all vehicles
+    static inline InstanceCounter totalVehicles{"Vehicle"}; // Static member shared by all vehicles (thread-safe)
 
 public:
     // Constructor
     Vehicle(const std::string& b, const std::string& m, int y, double p)
         : brand(b), model(m), year(y), price(p) {
-        totalVehicles++;
-        std::cout << "Vehicle constructor called: " << brand << " " << model << std::endl;
+        totalVehicles.onConstruct();
+        OOPS_TRACE(Debug, Lifecycle, "Vehicle constructor called: ", brand, " ", model);
+    }
+    
+    // Copies are new vehicles too, so they must be counted
+    Vehicle(const Vehicle& other)
+        : brand(other.brand), model(other.model), year(other.year), price(other.price) {
+        totalVehicles.onConstruct();
     }
     
     // Virtual destructor (important for proper cleanup in inheritance)
     virtual ~Vehicle() {
-        totalVehicles--;
-        std::cout << "Vehicle destructor called: " << brand << " " << model << std::endl;
+        totalVehicles.onDestroy();
+        OOPS_TRACE(Debug, Lifecycle, "Vehicle destructor called: ", brand, " ", model);
     }
     
     // Public interface
@@ -77,13 +85,10 @@ public:
     
     // Static function
     static int getTotalVehicles() {
-        return totalVehicles;
+        return static_cast<int>(totalVehicles.liveCount());
     }
 };
 
-// Static member definition
-int Vehicle::totalVehicles = 0;
-
 /**
  * Single Inheritance - Car inherits from Vehicle
  * Demonstrates: Basic inheritance, method overriding, constructor chaining
@@ -99,12 +104,12 @@ public:
     Car(const std::string& b, const std::string& m, int y, double p,
         int doors, const std::string& fuel, double engine)
         : Vehicle(b, m, y, p), numberOfDoors(doors), fuelType(fuel), engineCapacity(engine) {
-        std::cout << "Car constructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Car constructor called");
     }
     
     // Destructor
     ~Car() override {
-        std::cout << "Car destructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Car destructor called");
     }
     
     // Getters for car-specific attributes
@@ -149,11 +154,11 @@ public:
     Motorcycle(const std::string& b, const std::string& m, int y, double p,
                bool sidecar, const std::string& type)
         : Vehicle(b, m, y, p), hasSidecar(sidecar), motorcycleType(type) {
-        std::cout << "Motorcycle constructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Motorcycle constructor called");
     }
     
     ~Motorcycle() override {
-        std::cout << "Motorcycle destructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Motorcycle destructor called");
     }
     
     bool getHasSidecar() const { return hasSidecar; }
@@ -195,11 +200,11 @@ public:
               int speed, double accel, bool turbo)
         : Car(b, m, y, p, doors, fuel, engine), 
           maxSpeed(speed), acceleration(accel), hasTurbo(turbo) {
-        std::cout << "SportsCar constructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "SportsCar constructor called");
     }
     
     ~SportsCar() override {
-        std::cout << "SportsCar destructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "SportsCar destructor called");
     }
     
     int getMaxSpeed() const { return maxSpeed; }
@@ -244,11 +249,11 @@ protected:
 public:
     Engine(double hp, const std::string& type) 
         : horsepower(hp), engineType(type) {
-        std::cout << "Engine constructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Engine constructor called");
     }
     
     virtual ~Engine() {
-        std::cout << "Engine destructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Engine destructor called");
     }
     
     double getHorsepower() const { return horsepower; }
@@ -268,11 +273,11 @@ protected:
 
 public:
     GPS() : currentLocation("Unknown"), isActive(false) {
-        std::cout << "GPS constructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "GPS constructor called");
     }
     
     virtual ~GPS() {
-        std::cout << "GPS destructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "GPS destructor called");
     }
     
     void activate() {
@@ -313,11 +318,11 @@ public:
           GPS(),
           autonomousMode(false),
           aiAssistant(ai) {
-        std::cout << "SmartCar constructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "SmartCar constructor called");
     }
     
     ~SmartCar() override {
-        std::cout << "SmartCar destructor called" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "SmartCar destructor called");
     }
     
     // Resolve ambiguity - which start() method to use?
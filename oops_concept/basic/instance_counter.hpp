@@ -0,0 +1,202 @@
+#ifndef INSTANCE_COUNTER_HPP
+#define INSTANCE_COUNTER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * ===============================================
+ * SHARDED INSTANCE COUNTERS
+ * ===============================================
+ *
+ * A "static int count" bumped in constructors is a data race once objects
+ * are created on several threads. A single std::atomic<int> fixes the race
+ * but every thread then writes the same cache line. ShardedCounter gives
+ * each thread its own cache-line-sized slot and sums the slots on read:
+ * writes stay core-local, reads are rare and pay O(slots).
+ *
+ * InstanceCounter tracks one type (live and ever-created objects), hands out
+ * unique ids in per-thread blocks, and registers itself with
+ * InstanceRegistry so all tracked types can be listed for diagnostics.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Why is a static counter in a constructor not thread-safe?
+ * 2. Why can a single atomic counter still scale badly?
+ * 3. What is the trade-off of a sharded counter?
+ */
+
+namespace BasicConcepts {
+
+class ShardedCounter {
+public:
+    static constexpr size_t Slots = 64;
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<int64_t> value{0};
+    };
+    std::array<Slot, Slots> slots;
+
+public:
+    // Threads are assigned slots round-robin on first use
+    static size_t threadSlot() {
+        static std::atomic<size_t> nextThread{0};
+        thread_local size_t slot = nextThread.fetch_add(1, std::memory_order_relaxed) % Slots;
+        return slot;
+    }
+
+    void add(int64_t delta) {
+        slots[threadSlot()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    // Exact once writers are quiescent; otherwise a recent snapshot
+    int64_t read() const {
+        int64_t total = 0;
+        for (const auto& slot : slots) total += slot.value.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    void reset() {
+        for (auto& slot : slots) slot.value.store(0, std::memory_order_relaxed);
+    }
+};
+
+struct InstanceStats {
+    std::string typeName;
+    int64_t live;
+    int64_t created;
+};
+
+class InstanceCounter;
+
+/**
+ * Process-wide list of tracked types
+ */
+class InstanceRegistry {
+private:
+    std::mutex mutex;
+    std::vector<const InstanceCounter*> counters;
+
+    InstanceRegistry() = default;
+
+public:
+    static constexpr size_t MaxTypes = 64;
+
+    static InstanceRegistry& instance() {
+        static InstanceRegistry registry;
+        return registry;
+    }
+
+    // Returns the new counter's index
+    size_t add(const InstanceCounter* counter) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (counters.size() >= MaxTypes) {
+            throw std::length_error("Too many tracked types");
+        }
+        counters.push_back(counter);
+        return counters.size() - 1;
+    }
+
+    std::vector<InstanceStats> snapshot();
+};
+
+/**
+ * Live / created counts and unique ids for one type
+ */
+class InstanceCounter {
+private:
+    static constexpr int64_t IdBlock = 256;
+
+    struct IdRange {
+        uint64_t generation = 0;
+        int64_t next = 0;
+        int64_t end = 0;
+    };
+
+    std::string name;
+    ShardedCounter live;
+    ShardedCounter created;
+    std::atomic<int64_t> nextIdBlock{1};
+    std::atomic<uint64_t> generation{1};
+    size_t index;
+
+    IdRange& localRange() {
+        thread_local std::array<IdRange, InstanceRegistry::MaxTypes> ranges;
+        return ranges[index];
+    }
+
+public:
+    explicit InstanceCounter(const std::string& typeName)
+        : name(typeName), index(InstanceRegistry::instance().add(this)) {}
+
+    InstanceCounter(const InstanceCounter&) = delete;
+    InstanceCounter& operator=(const InstanceCounter&) = delete;
+
+    /**
+     * Count a construction and return a unique id. Ids come from a
+     * per-thread block of 256, so a single thread still sees 1, 2, 3, ...
+     */
+    int64_t onConstruct() {
+        live.add(1);
+        created.add(1);
+
+        IdRange& range = localRange();
+        uint64_t current = generation.load(std::memory_order_acquire);
+        if (range.generation != current || range.next == range.end) {
+            range.generation = current;
+            range.next = nextIdBlock.fetch_add(IdBlock, std::memory_order_relaxed);
+            range.end = range.next + IdBlock;
+        }
+        return range.next++;
+    }
+
+    void onDestroy() { live.add(-1); }
+
+    int64_t liveCount() const { return live.read(); }
+    int64_t createdCount() const { return created.read(); }
+    const std::string& typeName() const { return name; }
+
+    // Restart ids and the created count; call while no thread is constructing
+    void reset() {
+        created.reset();
+        nextIdBlock.store(1, std::memory_order_relaxed);
+        generation.fetch_add(1, std::memory_order_release);
+    }
+};
+
+inline std::vector<InstanceStats> InstanceRegistry::snapshot() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<InstanceStats> stats;
+    for (const InstanceCounter* counter : counters) {
+        stats.push_back(InstanceStats{counter->typeName(), counter->liveCount(), counter->createdCount()});
+    }
+    return stats;
+}
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Why is a static counter in a constructor not thread-safe?
+ * A1: ++count is a load, add and store. Two threads can load the same value
+ *     and both store value + 1, losing an increment (and it is UB).
+ *
+ * Q2: Why can a single atomic counter still scale badly?
+ * A2: Every increment needs exclusive ownership of the counter's cache line,
+ *     so with many cores the line ping-pongs between them and increments
+ *     serialize on the interconnect.
+ *
+ * Q3: What is the trade-off of a sharded counter?
+ * A3: Writes are cheap and local, but a read must sum every shard, costs
+ *     more memory, and is only a snapshot while writers are active.
+ */
+
+#endif // INSTANCE_COUNTER_HPP
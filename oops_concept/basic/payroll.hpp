@@ -0,0 +1,251 @@
+#ifndef PAYROLL_HPP
+#define PAYROLL_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "employee_directory.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * ===============================================
+ * BULK PAYROLL OPERATIONS
+ * ===============================================
+ *
+ * Employee::increaseSalary validates, throws and prints for one object at a
+ * time. PayrollBatch applies the same rules to a whole EmployeeDirectory:
+ *
+ *   - changes are staged in copies of the salary / experience columns
+ *   - the kernels run two salaries (or four experience values) per SSE2
+ *     instruction; only lanes that break a rule drop to the scalar path
+ *   - a row that breaks a rule (inactive, over the salary cap, too much
+ *     experience) is recorded in getFailures() instead of throwing
+ *   - commit() writes the staged columns back, either only when nothing
+ *     failed (AllOrNothing) or for every row that did not fail (BestEffort);
+ *     it throws if the directory was changed after the batch was opened
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Why do exceptions hurt bulk operations?
+ * 2. How do you vectorize a loop with rare exceptional cases?
+ * 3. How do you make a batch update all-or-nothing?
+ */
+
+namespace BasicConcepts {
+
+struct PayrollFailure {
+    uint32_t row;
+    int employeeId;
+    std::string reason;
+};
+
+enum class CommitMode {
+    AllOrNothing,   // Apply nothing if any row failed
+    BestEffort      // Apply every row that did not fail
+};
+
+class PayrollBatch {
+private:
+    EmployeeDirectory& directory;
+    std::vector<double> salaries;     // Staged columns
+    std::vector<int> experience;
+    std::vector<uint8_t> rejected;    // 1 once a row has failed any operation
+    std::vector<PayrollFailure> failures;
+    uint64_t baseVersion;             // Directory version the staged columns were copied from
+    bool committed = false;
+
+    void reject(uint32_t row, const std::string& reason) {
+        if (!rejected[row]) {
+            rejected[row] = 1;
+            failures.push_back(PayrollFailure{row, directory.ids[row], reason});
+        }
+    }
+
+    // Same checks as Employee::increaseSalary, reported instead of thrown
+    void raiseOne(uint32_t row, double factor) {
+        if (rejected[row]) return;
+        if (!directory.active[row]) {
+            reject(row, "Cannot update inactive employee");
+            return;
+        }
+        double newSalary = salaries[row] * factor;
+        if (newSalary > EmployeeDirectory::MaxSalary) {
+            reject(row, "Salary increase would exceed maximum limit");
+            return;
+        }
+        salaries[row] = newSalary;
+    }
+
+    void addExperienceOne(uint32_t row, int years) {
+        if (rejected[row]) return;
+        if (!directory.active[row]) {
+            reject(row, "Cannot update inactive employee");
+            return;
+        }
+        // years <= MaxExperience, so the subtraction cannot overflow
+        if (experience[row] > EmployeeDirectory::MaxExperience - years) {
+            reject(row, "Total experience would exceed maximum limit");
+            return;
+        }
+        experience[row] += years;
+    }
+
+    void checkOpen() const {
+        if (committed) {
+            throw std::logic_error("Payroll batch already committed");
+        }
+    }
+
+public:
+    explicit PayrollBatch(EmployeeDirectory& dir)
+        : directory(dir), salaries(dir.salaries), experience(dir.experience),
+          rejected(dir.size(), 0), baseVersion(dir.version) {}
+
+    /**
+     * Raise every salary by `percentage`. An invalid percentage is a caller
+     * error and throws, exactly like Employee::increaseSalary.
+     */
+    void applyRaise(double percentage) {
+        checkOpen();
+        if (!(percentage >= 0 && percentage <= 100)) {
+            throw std::invalid_argument("Invalid percentage");
+        }
+        const double factor = 1.0 + percentage / 100.0;
+        const uint32_t count = static_cast<uint32_t>(salaries.size());
+        uint32_t row = 0;
+
+#if defined(__SSE2__)
+        const __m128d vFactor = _mm_set1_pd(factor);
+        const __m128d vCap = _mm_set1_pd(EmployeeDirectory::MaxSalary);
+        for (; row + 2 <= count; row += 2) {
+            uint16_t active, rejectedPair;
+            std::memcpy(&active, &directory.active[row], sizeof(active));
+            std::memcpy(&rejectedPair, &rejected[row], sizeof(rejectedPair));
+            __m128d raised = _mm_mul_pd(_mm_loadu_pd(&salaries[row]), vFactor);
+            int overCap = _mm_movemask_pd(_mm_cmpgt_pd(raised, vCap));
+            if (overCap == 0 && active == 0x0101 && rejectedPair == 0) {
+                _mm_storeu_pd(&salaries[row], raised);
+            } else {
+                raiseOne(row, factor);
+                raiseOne(row + 1, factor);
+            }
+        }
+#endif
+        for (; row < count; ++row) {
+            raiseOne(row, factor);
+        }
+    }
+
+    // Raise only the given rows, e.g. EmployeeDirectory::inDepartment(...)
+    void applyRaise(double percentage, const std::vector<uint32_t>& rows) {
+        checkOpen();
+        if (!(percentage >= 0 && percentage <= 100)) {
+            throw std::invalid_argument("Invalid percentage");
+        }
+        const double factor = 1.0 + percentage / 100.0;
+        for (uint32_t row : rows) {
+            if (row >= salaries.size()) {
+                throw std::out_of_range("Employee row out of range");
+            }
+            raiseOne(row, factor);
+        }
+    }
+
+    // Add `years` of experience to every employee
+    void addExperience(int years) {
+        checkOpen();
+        if (years < 0) {
+            throw std::invalid_argument("Additional years cannot be negative");
+        }
+        if (years > EmployeeDirectory::MaxExperience) {
+            throw std::invalid_argument("Additional years exceed maximum experience");
+        }
+        const uint32_t count = static_cast<uint32_t>(experience.size());
+        uint32_t row = 0;
+
+#if defined(__SSE2__)
+        const __m128i vYears = _mm_set1_epi32(years);
+        const __m128i vLimit = _mm_set1_epi32(EmployeeDirectory::MaxExperience - years);
+        for (; row + 4 <= count; row += 4) {
+            uint32_t active, rejectedQuad;
+            std::memcpy(&active, &directory.active[row], sizeof(active));
+            std::memcpy(&rejectedQuad, &rejected[row], sizeof(rejectedQuad));
+            __m128i* lane = reinterpret_cast<__m128i*>(&experience[row]);
+            __m128i current = _mm_loadu_si128(lane);
+            int overMax = _mm_movemask_epi8(_mm_cmpgt_epi32(current, vLimit));
+            if (overMax == 0 && active == 0x01010101u && rejectedQuad == 0) {
+                _mm_storeu_si128(lane, _mm_add_epi32(current, vYears));
+            } else {
+                for (uint32_t k = 0; k < 4; ++k) addExperienceOne(row + k, years);
+            }
+        }
+#endif
+        for (; row < count; ++row) {
+            addExperienceOne(row, years);
+        }
+    }
+
+    const std::vector<PayrollFailure>& getFailures() const { return failures; }
+    double stagedSalary(uint32_t row) const { return salaries.at(row); }
+    int stagedExperience(uint32_t row) const { return experience.at(row); }
+
+    /**
+     * Write the staged columns back to the directory. Returns false (and
+     * changes nothing) in AllOrNothing mode when any row failed. Throws
+     * std::logic_error, also changing nothing, if the directory was modified
+     * (setSalary, setActive, add, another batch's commit) since the batch
+     * was opened - publishing the stale copies would lose that update.
+     */
+    bool commit(CommitMode mode = CommitMode::AllOrNothing) {
+        checkOpen();
+        if (directory.version != baseVersion) {
+            throw std::logic_error("Directory changed while a payroll batch was open");
+        }
+        if (mode == CommitMode::AllOrNothing && !failures.empty()) {
+            return false;
+        }
+        for (const auto& failure : failures) {
+            // Failed rows keep their committed values
+            salaries[failure.row] = directory.salaries[failure.row];
+            experience[failure.row] = directory.experience[failure.row];
+        }
+        directory.salaries.swap(salaries);
+        directory.experience.swap(experience);
+        directory.salaryIndexStale = true;
+        ++directory.version;
+        committed = true;
+        return true;
+    }
+};
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Why do exceptions hurt bulk operations?
+ * A1: Throwing is expensive and aborts the loop on the first bad record, so
+ *     a million-row job either stops early or needs a try/catch per row.
+ *     Collecting failures in a side list keeps the loop going.
+ *
+ * Q2: How do you vectorize a loop with rare exceptional cases?
+ * A2: Compute the common case for a whole vector of lanes, test all the
+ *     exceptional conditions with one compare + movemask, and only fall back
+ *     to scalar code for the (rare) vectors where a lane is special.
+ *
+ * Q3: How do you make a batch update all-or-nothing?
+ * A3: Stage the changes in shadow copies, validate everything, and publish
+ *     with a single swap only if validation passed - otherwise throw the
+ *     copies away. Readers never see a half-applied batch. The copies are
+ *     only valid against the version they were taken from: a commit must fail
+ *     if the source changed meanwhile, or the swap silently loses that write.
+ */
+
+#endif // PAYROLL_HPP
@@ -1,11 +1,15 @@
 #ifndef POLYMORPHISM_HPP
 #define POLYMORPHISM_HPP
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <memory>
 #include <typeinfo>
+#include "../other_concepts/trace.hpp"
 
 /**
  * ===============================================
@@ -95,6 +99,7 @@ private:
 
 public:
     Complex(double r = 0, double i = 0) : real(r), imaginary(i) {}
+    Complex(const Complex& other) = default;
     
     // Operator overloading
     Complex operator+(const Complex& other) const {
@@ -157,12 +162,12 @@ protected:
 
 public:
     Shape(const std::string& n, const std::string& c) : name(n), color(c) {
-        std::cout << "Shape constructor: " << name << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Shape constructor: ", name);
     }
     
     // Virtual destructor - essential for proper cleanup
     virtual ~Shape() {
-        std::cout << "Shape destructor: " << name << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Shape destructor: ", name);
     }
     
     // Pure virtual functions - makes Shape abstract
@@ -197,20 +202,24 @@ private:
 public:
     Circle(const std::string& c, double r) 
         : Shape("Circle", c), radius(r) {
-        std::cout << "Circle constructor" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Circle constructor");
     }
     
     ~Circle() override {
-        std::cout << "Circle destructor" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Circle destructor");
     }
     
+    // Formulas shared with type-bucketed storage (shape_buckets.hpp)
+    static double area(double r) { return 3.14159 * r * r; }
+    static double perimeter(double r) { return 2 * 3.14159 * r; }
+    
     // Override pure virtual functions
     double calculateArea() const override {
-        return 3.14159 * radius * radius;
+        return area(radius);
     }
     
     double calculatePerimeter() const override {
-        return 2 * 3.14159 * radius;
+        return perimeter(radius);
     }
     
     void draw() const override {
@@ -242,19 +251,22 @@ private:
 public:
     Rectangle(const std::string& c, double w, double h)
         : Shape("Rectangle", c), width(w), height(h) {
-        std::cout << "Rectangle constructor" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Rectangle constructor");
     }
     
     ~Rectangle() override {
-        std::cout << "Rectangle destructor" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Rectangle destructor");
     }
     
+    static double area(double w, double h) { return w * h; }
+    static double perimeter(double w, double h) { return 2 * (w + h); }
+    
     double calculateArea() const override {
-        return width * height;
+        return area(width, height);
     }
     
     double calculatePerimeter() const override {
-        return 2 * (width + height);
+        return perimeter(width, height);
     }
     
     void draw() const override {
@@ -287,21 +299,37 @@ private:
 public:
     Triangle(const std::string& c, double s1, double s2, double s3)
         : Shape("Triangle", c), side1(s1), side2(s2), side3(s3) {
-        std::cout << "Triangle constructor" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Triangle constructor");
     }
     
     ~Triangle() override {
-        std::cout << "Triangle destructor" << std::endl;
+        OOPS_TRACE(Debug, Lifecycle, "Triangle destructor");
     }
     
-    double calculateArea() const override {
+    static double area(double s1, double s2, double s3) {
         // Using Heron's formula
-        double s = (side1 + side2 + side3) / 2;
-        return sqrt(s * (s - side1) * (s - side2) * (s - side3));
+        double s = (s1 + s2 + s3) / 2;
+        return sqrt(s * (s - s1) * (s - s2) * (s - s3));
+    }
+    
+    static double perimeter(double s1, double s2, double s3) { return s1 + s2 + s3; }
+    
+    static std::string triangleType(double s1, double s2, double s3) {
+        if (s1 == s2 && s2 == s3) {
+            return "Equilateral";
+        } else if (s1 == s2 || s2 == s3 || s1 == s3) {
+            return "Isosceles";
+        } else {
+            return "Scalene";
+        }
+    }
+    
+    double calculateArea() const override {
+        return area(side1, side2, side3);
     }
     
     double calculatePerimeter() const override {
-        return side1 + side2 + side3;
+        return perimeter(side1, side2, side3);
     }
     
     void draw() const override {
@@ -321,27 +349,25 @@ public:
     
     // Triangle-specific methods
     std::string getTriangleType() const {
-        if (side1 == side2 && side2 == side3) {
-            return "Equilateral";
-        } else if (side1 == side2 || side2 == side3 || side1 == side3) {
-            return "Isosceles";
-        } else {
-            return "Scalene";
-        }
+        return triangleType(side1, side2, side3);
     }
+    
+    double getSide1() const { return side1; }
+    double getSide2() const { return side2; }
+    double getSide3() const { return side3; }
 };
 
 /**
  * Function demonstrating runtime polymorphism
  */
-void processShape(const Shape& shape) {
+inline void processShape(const Shape& shape) {
     std::cout << "\n--- Processing Shape ---" << std::endl;
     shape.displayInfo();
     shape.draw();
     std::cout << "Shape type: " << shape.getType() << std::endl;
 }
 
-void processShapePointer(const Shape* shape) {
+inline void processShapePointer(const Shape* shape) {
     if (shape) {
         std::cout << "\n--- Processing Shape Pointer ---" << std::endl;
         shape->displayInfo();
@@ -383,6 +409,30 @@ public:
     }
 };
 
+/**
+ * Execution policies for Container's bulk operations
+ *   Sequential  - plain loop, element order guaranteed
+ *   Unsequenced - one thread, iterations may be reordered / vectorized
+ *   Parallel    - chunks on worker threads, each chunk unsequenced
+ * Unsequenced and Parallel reductions regroup the operation, so it must be
+ * associative and commutative (like std::reduce).
+ */
+enum class ExecutionPolicy { Sequential, Unsequenced, Parallel };
+
+/**
+ * Unchecked view over contiguous elements for hot loops
+ */
+template<typename T>
+struct Span {
+    T* first;
+    size_t count;
+
+    T& operator[](size_t index) const { return first[index]; }
+    T* begin() const { return first; }
+    T* end() const { return first + count; }
+    size_t size() const { return count; }
+};
+
 /**
  * Template-based polymorphism
  */
@@ -391,11 +441,71 @@ class Container {
 private:
     std::vector<T> data;
 
+    static constexpr size_t MinChunk = 1 << 16;
+
+    static size_t chunkCount(size_t n) {
+        size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        return std::min(threads, std::max<size_t>(1, n / MinChunk));
+    }
+
+    // Runs body(chunkIndex, begin, end) over [0, n), one chunk per thread
+    template<typename Body>
+    static void forChunks(size_t n, Body body) {
+        size_t chunks = chunkCount(n);
+        size_t chunk = (n + chunks - 1) / chunks;
+        std::vector<std::thread> workers;
+        for (size_t c = 1; c < chunks; ++c) {
+            workers.emplace_back(body, c, std::min(n, c * chunk), std::min(n, (c + 1) * chunk));
+        }
+        body(size_t(0), size_t(0), std::min(n, chunk));
+        for (auto& worker : workers) worker.join();
+    }
+
+    // Unrolled by four so -O2 can turn the body into vector instructions
+    template<typename Func>
+    static void applyUnsequenced(T* items, size_t n, Func& f) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            T a = f(items[i]), b = f(items[i + 1]), c = f(items[i + 2]), d = f(items[i + 3]);
+            items[i] = a;
+            items[i + 1] = b;
+            items[i + 2] = c;
+            items[i + 3] = d;
+        }
+        for (; i < n; ++i) {
+            items[i] = f(items[i]);
+        }
+    }
+
+    // Four independent accumulators so the loop is not one long dependency chain
+    template<typename R, typename Reduce, typename Transform>
+    static R reduceUnsequenced(const T* items, size_t n, R init, Reduce& op, Transform& transform) {
+        if (n < 8) {
+            for (size_t i = 0; i < n; ++i) init = op(init, transform(items[i]));
+            return init;
+        }
+        R acc0 = transform(items[0]), acc1 = transform(items[1]);
+        R acc2 = transform(items[2]), acc3 = transform(items[3]);
+        size_t i = 4;
+        for (; i + 4 <= n; i += 4) {
+            acc0 = op(acc0, transform(items[i]));
+            acc1 = op(acc1, transform(items[i + 1]));
+            acc2 = op(acc2, transform(items[i + 2]));
+            acc3 = op(acc3, transform(items[i + 3]));
+        }
+        for (; i < n; ++i) acc0 = op(acc0, transform(items[i]));
+        return op(init, op(op(acc0, acc1), op(acc2, acc3)));
+    }
+
 public:
     void add(const T& item) {
         data.push_back(item);
     }
     
+    void reserve(size_t count) {
+        data.reserve(count);
+    }
+    
     T get(size_t index) const {
         if (index < data.size()) {
             return data[index];
@@ -407,18 +517,74 @@ public:
         return data.size();
     }
     
+    // Unchecked access: no bounds check, no copy
+    Span<T> span() { return Span<T>{data.data(), data.size()}; }
+    Span<const T> span() const { return Span<const T>{data.data(), data.size()}; }
+    
     // Template method
     template<typename U>
     void addConverted(const U& item) {
         data.push_back(static_cast<T>(item));
     }
     
-    // Function template for operations
+    // Function template for operations; f must be safe to call concurrently for Parallel
     template<typename Func>
-    void applyFunction(Func f) {
-        for (auto& item : data) {
-            item = f(item);
+    void applyFunction(Func f, ExecutionPolicy policy = ExecutionPolicy::Sequential) {
+        switch (policy) {
+        case ExecutionPolicy::Sequential:
+            for (auto& item : data) {
+                item = f(item);
+            }
+            break;
+        case ExecutionPolicy::Unsequenced:
+            applyUnsequenced(data.data(), data.size(), f);
+            break;
+        case ExecutionPolicy::Parallel:
+            T* items = data.data();
+            forChunks(data.size(), [items, f](size_t, size_t begin, size_t end) mutable {
+                applyUnsequenced(items + begin, end - begin, f);
+            });
+            break;
+        }
+    }
+    
+    // init combined with every element through op
+    template<typename Reduce>
+    T reduce(T init, Reduce op, ExecutionPolicy policy = ExecutionPolicy::Sequential) const {
+        return transformReduce(init, op, [](const T& item) { return item; }, policy);
+    }
+    
+    // init combined with transform(element) for every element through op
+    template<typename R, typename Reduce, typename Transform>
+    R transformReduce(R init, Reduce op, Transform transform,
+                      ExecutionPolicy policy = ExecutionPolicy::Sequential) const {
+        const T* items = data.data();
+        size_t n = data.size();
+        switch (policy) {
+        case ExecutionPolicy::Sequential:
+            for (size_t i = 0; i < n; ++i) init = op(init, transform(items[i]));
+            return init;
+        case ExecutionPolicy::Unsequenced:
+            return reduceUnsequenced(items, n, init, op, transform);
+        case ExecutionPolicy::Parallel:
+            break;
+        }
+        // Each chunk reduces into its own slot; slots are combined in order
+        size_t chunks = chunkCount(n);
+        std::vector<R> partials(chunks, init);
+        std::vector<char> used(chunks, 0);
+        forChunks(n, [&](size_t index, size_t begin, size_t end) {
+            if (begin == end) return;
+            Reduce localOp = op;
+            Transform localTransform = transform;
+            partials[index] = reduceUnsequenced(items + begin + 1, end - begin - 1, R(localTransform(items[begin])),
+                                                localOp, localTransform);
+            used[index] = 1;
+        });
+        for (size_t index = 0; index < chunks; ++index) {
+            if (used[index]) init = op(init, partials[index]);
         }
+        return init;
     }
 };
 
@@ -547,7 +713,7 @@ public:
     void move(double dx, double dy) override {
         x += dx;
         y += dy;
-        std::cout << name << " moved to (" << x << ", " << y << ")" << std::endl;
+        OOPS_TRACE(Info, Sprite, name, " moved to (", x, ", ", y, ")");
     }
     
     std::pair<double, double> getPosition() const override {
@@ -555,6 +721,7 @@ public:
     }
     
     const std::string& getName() const { return name; }
+    const std::string& getTexture() const { return texture; }
 };
 
 } // namespace BasicConcepts
@@ -613,6 +780,10 @@ public:
  * Q10: What is object slicing?
  * A10: When derived object is assigned to base object, derived-specific
  *      data is "sliced off". Avoid by using pointers/references.
+ * 
+ * Q11: Why do templates (functors) beat virtual calls in hot loops?
+ * A11: The call target is known at compile time, so it is inlined and the
+ *      loop can be vectorized; a virtual call per element blocks both.
  */
 
 // ======================= DEMONSTRATION FUNCTION =======================
@@ -0,0 +1,506 @@
+#ifndef SHAPE_BUCKETS_HPP
+#define SHAPE_BUCKETS_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "polymorphism.hpp"
+
+/**
+ * ===============================================
+ * TYPE-BUCKETED SHAPE STORAGE
+ * ===============================================
+ *
+ * ShapeManager keeps one std::vector<std::unique_ptr<Shape>>: every loop
+ * chases a pointer and makes a virtual call per shape, and
+ * getShapesByType() compares a type string per shape. BucketedShapeManager
+ * offers the same operations with a different storage mode: one bucket per
+ * concrete type, each bucket a set of contiguous columns.
+ *
+ *   circles      radius, color
+ *   rectangles   width, height, color
+ *   triangles    side1, side2, side3, color
+ *
+ * Loops over one bucket call Circle::area() and friends directly, so the
+ * compiler inlines them; type queries are an O(1) bucket lookup. Colors are
+ * interned into uint32 ids. Output order is by type (all circles, then all
+ * rectangles, then all triangles), not insertion order.
+ *
+ * Each bucket also keeps a live-row bitmap and one sparse row bitmap per
+ * color. removeShapesByColor() only clears bits (tombstones); a bucket is compacted
+ * once its share of dead rows passes the compaction threshold. Color
+ * filters walk the color bitmap instead of comparing strings.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. How do you avoid virtual calls in a hot loop over mixed types?
+ * 2. What do you give up by sorting objects by type?
+ * 3. Why delete with tombstones and compact later?
+ */
+
+namespace BasicConcepts {
+
+enum class ShapeKind : uint8_t { Circle, Rectangle, Triangle };
+
+/**
+ * Live rows and per-color rows of one bucket, as bitmaps. A color's bitmap
+ * is sparse: only the 64-row words holding at least one row of that color
+ * are stored, so the index stays O(rows) however many colors there are.
+ */
+class BucketIndex {
+private:
+    // One 64-row word of a color bitmap; words are appended in row order
+    struct ColorWord {
+        size_t word;
+        uint64_t bits;
+    };
+
+    std::vector<uint64_t> live;
+    std::unordered_map<uint32_t, std::vector<ColorWord>> colorRows;
+    size_t rowCount = 0;
+    size_t deadCount = 0;
+
+    static void setBit(std::vector<uint64_t>& bits, size_t row) {
+        if (bits.size() <= row / 64) bits.resize(row / 64 + 1, 0);
+        bits[row / 64] |= uint64_t(1) << (row % 64);
+    }
+
+    template<typename Visit>
+    static void forEachBitInWord(size_t word, uint64_t w, Visit& visit) {
+        size_t base = word * 64;
+        if (w == ~uint64_t(0)) {
+            // Dense fast path: no tombstones in this word
+            for (size_t b = 0; b < 64; ++b) visit(base + b);
+            return;
+        }
+        while (w) {
+            visit(base + static_cast<size_t>(__builtin_ctzll(w)));
+            w &= w - 1;
+        }
+    }
+
+public:
+    void push(uint32_t color) {
+        size_t row = rowCount++;
+        setBit(live, row);
+        std::vector<ColorWord>& words = colorRows[color];
+        if (words.empty() || words.back().word != row / 64) words.push_back({row / 64, 0});
+        words.back().bits |= uint64_t(1) << (row % 64);
+    }
+
+    // Tombstones every live row with this color; returns how many
+    size_t removeColor(uint32_t color) {
+        auto it = colorRows.find(color);
+        if (it == colorRows.end()) return 0;
+        size_t removed = 0;
+        for (const ColorWord& w : it->second) {
+            removed += static_cast<size_t>(__builtin_popcountll(w.bits));
+            live[w.word] &= ~w.bits;
+        }
+        colorRows.erase(it);
+        deadCount += removed;
+        return removed;
+    }
+
+    bool isLive(size_t row) const {
+        return row < rowCount && (live[row / 64] >> (row % 64)) & 1;
+    }
+
+    size_t countColor(uint32_t color) const {
+        auto it = colorRows.find(color);
+        if (it == colorRows.end()) return 0;
+        size_t total = 0;
+        for (const ColorWord& w : it->second) total += static_cast<size_t>(__builtin_popcountll(w.bits));
+        return total;
+    }
+
+    template<typename Visit>
+    void forEachLive(Visit visit) const {
+        for (size_t i = 0; i < live.size(); ++i) forEachBitInWord(i, live[i], visit);
+    }
+
+    template<typename Visit>
+    void forEachWithColor(uint32_t color, Visit visit) const {
+        auto it = colorRows.find(color);
+        if (it == colorRows.end()) return;
+        for (const ColorWord& w : it->second) forEachBitInWord(w.word, w.bits, visit);
+    }
+
+    // Approximate heap use of the bitmaps, for tests and reports
+    size_t memoryBytes() const {
+        size_t bytes = live.capacity() * sizeof(uint64_t) + colorRows.bucket_count() * sizeof(void*);
+        for (const auto& entry : colorRows) {
+            bytes += sizeof(entry) + sizeof(void*) + entry.second.capacity() * sizeof(ColorWord);
+        }
+        return bytes;
+    }
+
+    size_t rows() const { return rowCount; }
+    size_t dead() const { return deadCount; }
+
+    // Moves live values to the front of a column, keeping their order
+    template<typename T>
+    void keepLive(std::vector<T>& column) const {
+        size_t kept = 0;
+        forEachLive([&](size_t row) { column[kept++] = column[row]; });
+        column.resize(kept);
+    }
+
+    // Rebuilds the bitmaps from an already compacted color column
+    void rebuild(const std::vector<uint32_t>& colors) {
+        live.clear();
+        colorRows.clear();
+        rowCount = 0;
+        deadCount = 0;
+        for (uint32_t color : colors) push(color);
+    }
+};
+
+struct CircleBucket {
+    std::vector<double> radius;
+    std::vector<uint32_t> color;
+    BucketIndex index;
+
+    size_t rows() const { return radius.size(); }    // Including tombstones
+    size_t size() const { return rows() - index.dead(); }
+
+    void compact() {
+        index.keepLive(radius);
+        index.keepLive(color);
+        index.rebuild(color);
+    }
+};
+
+struct RectangleBucket {
+    std::vector<double> width, height;
+    std::vector<uint32_t> color;
+    BucketIndex index;
+
+    size_t rows() const { return width.size(); }
+    size_t size() const { return rows() - index.dead(); }
+
+    void compact() {
+        index.keepLive(width);
+        index.keepLive(height);
+        index.keepLive(color);
+        index.rebuild(color);
+    }
+};
+
+struct TriangleBucket {
+    std::vector<double> side1, side2, side3;
+    std::vector<uint32_t> color;
+    BucketIndex index;
+
+    size_t rows() const { return side1.size(); }
+    size_t size() const { return rows() - index.dead(); }
+
+    void compact() {
+        index.keepLive(side1);
+        index.keepLive(side2);
+        index.keepLive(side3);
+        index.keepLive(color);
+        index.rebuild(color);
+    }
+};
+
+class BucketedShapeManager {
+private:
+    CircleBucket circleBucket;
+    RectangleBucket rectangleBucket;
+    TriangleBucket triangleBucket;
+
+    std::vector<std::string> colorNames;
+    std::unordered_map<std::string, uint32_t> colorIds;
+
+    double compactionThreshold = 0.25;
+    size_t compactionCount = 0;
+
+    uint32_t internColor(const std::string& color) {
+        auto it = colorIds.find(color);
+        if (it != colorIds.end()) return it->second;
+        uint32_t id = static_cast<uint32_t>(colorNames.size());
+        colorNames.push_back(color);
+        colorIds.emplace(color, id);
+        return id;
+    }
+
+    // Color id of a known color, or -1
+    int64_t findColor(const std::string& color) const {
+        auto it = colorIds.find(color);
+        return it == colorIds.end() ? -1 : static_cast<int64_t>(it->second);
+    }
+
+    template<typename Bucket>
+    void compactIfFragmented(Bucket& bucket) {
+        if (bucket.index.dead() > 0 &&
+            static_cast<double>(bucket.index.dead()) > compactionThreshold * static_cast<double>(bucket.rows())) {
+            bucket.compact();
+            ++compactionCount;
+        }
+    }
+
+    // Same text as Shape::displayInfo
+    void displayCommon(const char* name, uint32_t color, double area, double perimeter) const {
+        std::cout << "Shape: " << name << ", Color: " << colorNames[color] << std::endl;
+        std::cout << "Area: " << area << std::endl;
+        std::cout << "Perimeter: " << perimeter << std::endl;
+    }
+
+public:
+    void addCircle(const std::string& color, double radius) {
+        uint32_t id = internColor(color);
+        circleBucket.radius.push_back(radius);
+        circleBucket.color.push_back(id);
+        circleBucket.index.push(id);
+    }
+
+    void addRectangle(const std::string& color, double width, double height) {
+        uint32_t id = internColor(color);
+        rectangleBucket.width.push_back(width);
+        rectangleBucket.height.push_back(height);
+        rectangleBucket.color.push_back(id);
+        rectangleBucket.index.push(id);
+    }
+
+    void addTriangle(const std::string& color, double side1, double side2, double side3) {
+        uint32_t id = internColor(color);
+        triangleBucket.side1.push_back(side1);
+        triangleBucket.side2.push_back(side2);
+        triangleBucket.side3.push_back(side3);
+        triangleBucket.color.push_back(id);
+        triangleBucket.index.push(id);
+    }
+
+    // Same signature as ShapeManager::addShape; the type is resolved once here
+    void addShape(std::unique_ptr<Shape> shape) {
+        if (!shape) {
+            throw std::invalid_argument("Shape must not be null");
+        }
+        if (auto* circle = dynamic_cast<const Circle*>(shape.get())) {
+            addCircle(circle->getColor(), circle->getRadius());
+        } else if (auto* rect = dynamic_cast<const Rectangle*>(shape.get())) {
+            addRectangle(rect->getColor(), rect->getWidth(), rect->getHeight());
+        } else if (auto* triangle = dynamic_cast<const Triangle*>(shape.get())) {
+            addTriangle(triangle->getColor(), triangle->getSide1(), triangle->getSide2(), triangle->getSide3());
+        } else {
+            throw std::invalid_argument("Unsupported shape type: " + shape->getType());
+        }
+    }
+
+    void reserve(ShapeKind kind, size_t count) {
+        switch (kind) {
+        case ShapeKind::Circle:
+            circleBucket.radius.reserve(count);
+            circleBucket.color.reserve(count);
+            break;
+        case ShapeKind::Rectangle:
+            rectangleBucket.width.reserve(count);
+            rectangleBucket.height.reserve(count);
+            rectangleBucket.color.reserve(count);
+            break;
+        case ShapeKind::Triangle:
+            for (auto* column : {&triangleBucket.side1, &triangleBucket.side2, &triangleBucket.side3}) {
+                column->reserve(count);
+            }
+            triangleBucket.color.reserve(count);
+            break;
+        }
+    }
+
+    void drawAllShapes() const {
+        std::cout << "\n--- Drawing All Shapes ---" << std::endl;
+        const CircleBucket& c = circleBucket;
+        c.index.forEachLive([&](size_t i) {
+            std::cout << "Drawing a " << colorNames[c.color[i]] << " circle with radius " << c.radius[i] << std::endl;
+        });
+        const RectangleBucket& r = rectangleBucket;
+        r.index.forEachLive([&](size_t i) {
+            std::cout << "Drawing a " << colorNames[r.color[i]] << " rectangle "
+                      << r.width[i] << "x" << r.height[i] << std::endl;
+        });
+        const TriangleBucket& t = triangleBucket;
+        t.index.forEachLive([&](size_t i) {
+            std::cout << "Drawing a " << colorNames[t.color[i]] << " triangle with sides "
+                      << t.side1[i] << ", " << t.side2[i] << ", " << t.side3[i] << std::endl;
+        });
+    }
+
+    void displayAllInfo() const {
+        std::cout << "\n--- All Shapes Information ---" << std::endl;
+        const CircleBucket& c = circleBucket;
+        c.index.forEachLive([&](size_t i) {
+            displayCommon("Circle", c.color[i], Circle::area(c.radius[i]), Circle::perimeter(c.radius[i]));
+            std::cout << "Radius: " << c.radius[i] << std::endl;
+            std::cout << "---" << std::endl;
+        });
+        const RectangleBucket& r = rectangleBucket;
+        r.index.forEachLive([&](size_t i) {
+            displayCommon("Rectangle", r.color[i], Rectangle::area(r.width[i], r.height[i]),
+                          Rectangle::perimeter(r.width[i], r.height[i]));
+            std::cout << "Width: " << r.width[i] << ", Height: " << r.height[i] << std::endl;
+            std::cout << "---" << std::endl;
+        });
+        const TriangleBucket& t = triangleBucket;
+        t.index.forEachLive([&](size_t i) {
+            displayCommon("Triangle", t.color[i], Triangle::area(t.side1[i], t.side2[i], t.side3[i]),
+                          Triangle::perimeter(t.side1[i], t.side2[i], t.side3[i]));
+            std::cout << "Sides: " << t.side1[i] << ", " << t.side2[i] << ", " << t.side3[i] << std::endl;
+            std::cout << "Type: " << Triangle::triangleType(t.side1[i], t.side2[i], t.side3[i]) << std::endl;
+            std::cout << "---" << std::endl;
+        });
+    }
+
+    // One monomorphic loop per bucket; no virtual calls
+    double getTotalArea() const {
+        double total = 0.0;
+        const CircleBucket& c = circleBucket;
+        c.index.forEachLive([&](size_t i) { total += Circle::area(c.radius[i]); });
+        const RectangleBucket& r = rectangleBucket;
+        r.index.forEachLive([&](size_t i) { total += Rectangle::area(r.width[i], r.height[i]); });
+        const TriangleBucket& t = triangleBucket;
+        t.index.forEachLive([&](size_t i) { total += Triangle::area(t.side1[i], t.side2[i], t.side3[i]); });
+        return total;
+    }
+
+    // Visits only the rows in the color's bitmaps
+    double getTotalAreaByColor(const std::string& color) const {
+        int64_t id = findColor(color);
+        if (id < 0) return 0.0;
+        uint32_t colorId = static_cast<uint32_t>(id);
+        double total = 0.0;
+        const CircleBucket& c = circleBucket;
+        c.index.forEachWithColor(colorId, [&](size_t i) { total += Circle::area(c.radius[i]); });
+        const RectangleBucket& r = rectangleBucket;
+        r.index.forEachWithColor(colorId, [&](size_t i) { total += Rectangle::area(r.width[i], r.height[i]); });
+        const TriangleBucket& t = triangleBucket;
+        t.index.forEachWithColor(colorId, [&](size_t i) {
+            total += Triangle::area(t.side1[i], t.side2[i], t.side3[i]);
+        });
+        return total;
+    }
+
+    size_t getShapeCountByColor(const std::string& color) const {
+        int64_t id = findColor(color);
+        if (id < 0) return 0;
+        uint32_t colorId = static_cast<uint32_t>(id);
+        return circleBucket.index.countColor(colorId) + rectangleBucket.index.countColor(colorId) +
+               triangleBucket.index.countColor(colorId);
+    }
+
+    /**
+     * Tombstones every shape of this color; returns how many. Buckets whose
+     * dead rows now exceed the compaction threshold are compacted, which
+     * renumbers their rows.
+     */
+    size_t removeShapesByColor(const std::string& color) {
+        int64_t id = findColor(color);
+        if (id < 0) return 0;
+        uint32_t colorId = static_cast<uint32_t>(id);
+        size_t removed = circleBucket.index.removeColor(colorId) + rectangleBucket.index.removeColor(colorId) +
+                         triangleBucket.index.removeColor(colorId);
+        compactIfFragmented(circleBucket);
+        compactIfFragmented(rectangleBucket);
+        compactIfFragmented(triangleBucket);
+        return removed;
+    }
+
+    // Fraction of dead rows (0..1] above which a bucket is compacted
+    void setCompactionThreshold(double fraction) {
+        if (!(fraction > 0.0 && fraction <= 1.0)) {
+            throw std::invalid_argument("Compaction threshold must be in (0, 1]");
+        }
+        compactionThreshold = fraction;
+    }
+
+    void compact() {
+        circleBucket.compact();
+        rectangleBucket.compact();
+        triangleBucket.compact();
+        ++compactionCount;
+    }
+
+    size_t getTombstoneCount() const {
+        return circleBucket.index.dead() + rectangleBucket.index.dead() + triangleBucket.index.dead();
+    }
+
+    size_t getCompactionCount() const { return compactionCount; }
+
+    // O(1) bucket access replaces ShapeManager::getShapesByType; skip rows
+    // for which bucket.index.isLive(row) is false
+    const CircleBucket& circles() const { return circleBucket; }
+    const RectangleBucket& rectangles() const { return rectangleBucket; }
+    const TriangleBucket& triangles() const { return triangleBucket; }
+
+    // Accepts the names returned by Shape::getType()
+    static ShapeKind kindOf(const std::string& type) {
+        if (type == "Circle") return ShapeKind::Circle;
+        if (type == "Rectangle") return ShapeKind::Rectangle;
+        if (type == "Triangle") return ShapeKind::Triangle;
+        throw std::invalid_argument("Unknown shape type: " + type);
+    }
+
+    size_t getShapeCountByType(ShapeKind kind) const {
+        switch (kind) {
+        case ShapeKind::Circle: return circleBucket.size();
+        case ShapeKind::Rectangle: return rectangleBucket.size();
+        case ShapeKind::Triangle: return triangleBucket.size();
+        }
+        return 0;
+    }
+
+    size_t getShapeCountByType(const std::string& type) const {
+        return getShapeCountByType(kindOf(type));
+    }
+
+    size_t getShapeCount() const {
+        return circleBucket.size() + rectangleBucket.size() + triangleBucket.size();
+    }
+
+    const std::string& colorName(uint32_t id) const { return colorNames.at(id); }
+
+    // Rebuilds a real object from a live row, e.g. to hand to code expecting Shape
+    std::unique_ptr<Shape> toShape(ShapeKind kind, size_t row) const {
+        switch (kind) {
+        case ShapeKind::Circle:
+            if (!circleBucket.index.isLive(row)) break;
+            return std::make_unique<Circle>(colorNames[circleBucket.color[row]], circleBucket.radius[row]);
+        case ShapeKind::Rectangle:
+            if (!rectangleBucket.index.isLive(row)) break;
+            return std::make_unique<Rectangle>(colorNames[rectangleBucket.color[row]],
+                                               rectangleBucket.width[row], rectangleBucket.height[row]);
+        case ShapeKind::Triangle:
+            if (!triangleBucket.index.isLive(row)) break;
+            return std::make_unique<Triangle>(colorNames[triangleBucket.color[row]], triangleBucket.side1[row],
+                                              triangleBucket.side2[row], triangleBucket.side3[row]);
+        }
+        throw std::out_of_range("No live shape at this row");
+    }
+};
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: How do you avoid virtual calls in a hot loop over mixed types?
+ * A1: Sort the objects by concrete type once (at insertion) and run one loop
+ *     per type. Inside each loop the type is known statically, so the call
+ *     is direct and can be inlined and vectorized.
+ *
+ * Q2: What do you give up by sorting objects by type?
+ * A2: A single global order across types, and open extension: a new shape
+ *     type needs a new bucket instead of just a new subclass.
+ *
+ * Q3: Why delete with tombstones and compact later?
+ * A3: Erasing from the middle of an array moves everything behind it on
+ *     every call. Clearing a bit is O(1) per word; compacting once the dead
+ *     fraction is large amortizes the move over many deletions.
+ */
+
+#endif // SHAPE_BUCKETS_HPP
@@ -0,0 +1,281 @@
+#ifndef SKILL_SET_HPP
+#define SKILL_SET_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * ===============================================
+ * INTERNED SKILL SETS
+ * ===============================================
+ *
+ * Employees share a small vocabulary of skills ("C++", "SQL", ...), so each
+ * name is stored once in SkillRegistry and given a small integer id. An
+ * employee's skills become a bitset over those ids, plus the ids in the
+ * order they were added:
+ *
+ *   insert / contains      one bit operation instead of string compares
+ *   hasAll / hasAny        word-wide AND over the two bitsets
+ *   jaccard                popcount(a & b) / popcount(a | b)
+ *
+ * SkillView walks the ids in insertion order and yields const std::string&
+ * from the registry, so reading an employee's skills never copies strings.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. What is string interning?
+ * 2. Why represent a set as a bitset?
+ * 3. What is Jaccard similarity?
+ */
+
+namespace BasicConcepts {
+
+/**
+ * Process-wide skill name <-> id table. Ids are dense and never reused.
+ * Thread-safe: intern() and find() lock the id map; name() takes no lock,
+ * because names live in fixed chunks that never move once published.
+ */
+class SkillRegistry {
+private:
+    static constexpr size_t ChunkSize = 256;
+    static constexpr size_t MaxChunks = 4096;   // About a million skills
+
+    std::unique_ptr<std::string[]> chunks[MaxChunks];   // Written under mutex, before publishing
+    std::atomic<uint32_t> published{0};                 // Names [0, published) are readable
+    std::unordered_map<std::string, uint32_t> ids;
+    mutable std::shared_mutex mutex;
+
+    SkillRegistry() = default;
+
+public:
+    SkillRegistry(const SkillRegistry&) = delete;
+    SkillRegistry& operator=(const SkillRegistry&) = delete;
+
+    static SkillRegistry& instance() {
+        static SkillRegistry registry;
+        return registry;
+    }
+
+    uint32_t intern(const std::string& skill) {
+        if (skill.empty()) {
+            throw std::invalid_argument("Skill cannot be empty");
+        }
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto it = ids.find(skill);
+            if (it != ids.end()) return it->second;
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(skill);   // Another thread may have won the race
+        if (it != ids.end()) return it->second;
+        uint32_t id = published.load(std::memory_order_relaxed);
+        if (id / ChunkSize >= MaxChunks) {
+            throw std::length_error("Too many distinct skills");
+        }
+        std::unique_ptr<std::string[]>& chunk = chunks[id / ChunkSize];
+        if (!chunk) chunk = std::make_unique<std::string[]>(ChunkSize);
+        chunk[id % ChunkSize] = skill;
+        ids.emplace(skill, id);
+        published.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    // Id of an already interned skill, or -1
+    int64_t find(const std::string& skill) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(skill);
+        return it == ids.end() ? -1 : static_cast<int64_t>(it->second);
+    }
+
+    const std::string& name(uint32_t id) const {
+        if (id >= published.load(std::memory_order_acquire)) {
+            throw std::out_of_range("Unknown skill id");
+        }
+        return chunks[id / ChunkSize][id % ChunkSize];
+    }
+
+    size_t size() const { return published.load(std::memory_order_acquire); }
+};
+
+/**
+ * Read-only range over skill names, in the order the skills were added
+ */
+class SkillView {
+private:
+    const std::vector<uint32_t>* ids;
+
+public:
+    class iterator {
+    private:
+        std::vector<uint32_t>::const_iterator position;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string*;
+        using reference = const std::string&;
+
+        explicit iterator(std::vector<uint32_t>::const_iterator p) : position(p) {}
+
+        uint32_t id() const { return *position; }
+        reference operator*() const { return SkillRegistry::instance().name(*position); }
+        pointer operator->() const { return &**this; }
+
+        iterator& operator++() {
+            ++position;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const iterator& other) const { return position == other.position; }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+
+    explicit SkillView(const std::vector<uint32_t>& i) : ids(&i) {}
+
+    iterator begin() const { return iterator(ids->begin()); }
+    iterator end() const { return iterator(ids->end()); }
+
+    size_t size() const { return ids->size(); }
+    bool empty() const { return ids->empty(); }
+
+    // Copies the names, for code written against the old vector-returning getters
+    operator std::vector<std::string>() const { return std::vector<std::string>(begin(), end()); }
+};
+
+/**
+ * Set of skill ids stored as a dynamic bitset. The ids are also kept in
+ * insertion order, so listing the skills does not depend on the global
+ * interning order.
+ */
+class SkillSet {
+private:
+    std::vector<uint64_t> words;
+    std::vector<uint32_t> order;   // Same ids as the bits, oldest first
+
+    static size_t commonWords(const SkillSet& a, const SkillSet& b) {
+        return a.words.size() < b.words.size() ? a.words.size() : b.words.size();
+    }
+
+public:
+    SkillSet() = default;
+
+    SkillSet(std::initializer_list<std::string> skills) {
+        for (const auto& skill : skills) insert(skill);
+    }
+
+    // Returns false if the skill was already present
+    bool insert(uint32_t id) {
+        size_t word = id / 64;
+        if (word >= words.size()) words.resize(word + 1, 0);
+        uint64_t bit = uint64_t(1) << (id % 64);
+        if (words[word] & bit) return false;
+        words[word] |= bit;
+        order.push_back(id);
+        return true;
+    }
+
+    bool insert(const std::string& skill) {
+        return insert(SkillRegistry::instance().intern(skill));
+    }
+
+    bool erase(uint32_t id) {
+        size_t word = id / 64;
+        if (word >= words.size()) return false;
+        uint64_t bit = uint64_t(1) << (id % 64);
+        if (!(words[word] & bit)) return false;
+        words[word] &= ~bit;
+        order.erase(std::find(order.begin(), order.end(), id));
+        return true;
+    }
+
+    bool contains(uint32_t id) const {
+        size_t word = id / 64;
+        return word < words.size() && (words[word] >> (id % 64)) & 1;
+    }
+
+    bool contains(const std::string& skill) const {
+        int64_t id = SkillRegistry::instance().find(skill);
+        return id >= 0 && contains(static_cast<uint32_t>(id));
+    }
+
+    size_t size() const { return order.size(); }
+    bool empty() const { return order.empty(); }
+
+    // Every skill in `required` is also in this set
+    bool hasAll(const SkillSet& required) const {
+        size_t common = commonWords(*this, required);
+        for (size_t i = 0; i < common; ++i) {
+            if ((required.words[i] & ~words[i]) != 0) return false;
+        }
+        for (size_t i = common; i < required.words.size(); ++i) {
+            if (required.words[i] != 0) return false;
+        }
+        return true;
+    }
+
+    bool hasAny(const SkillSet& wanted) const {
+        size_t common = commonWords(*this, wanted);
+        for (size_t i = 0; i < common; ++i) {
+            if ((wanted.words[i] & words[i]) != 0) return true;
+        }
+        return false;
+    }
+
+    // |A ∩ B| / |A ∪ B|; two empty sets are identical (1.0)
+    double jaccard(const SkillSet& other) const {
+        size_t common = commonWords(*this, other);
+        size_t intersection = 0, unionCount = 0;
+        for (size_t i = 0; i < common; ++i) {
+            intersection += static_cast<size_t>(__builtin_popcountll(words[i] & other.words[i]));
+            unionCount += static_cast<size_t>(__builtin_popcountll(words[i] | other.words[i]));
+        }
+        const std::vector<uint64_t>& longer = words.size() > common ? words : other.words;
+        for (size_t i = common; i < longer.size(); ++i) {
+            unionCount += static_cast<size_t>(__builtin_popcountll(longer[i]));
+        }
+        return unionCount == 0 ? 1.0 : static_cast<double>(intersection) / unionCount;
+    }
+
+    SkillView view() const { return SkillView(order); }
+};
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: What is string interning?
+ * A1: Keeping one canonical copy of each distinct string and referring to it
+ *     by id or pointer. Equality becomes an integer compare and duplicates
+ *     cost no extra memory.
+ *
+ * Q2: Why represent a set as a bitset?
+ * A2: With a small dense id space, membership is one shift and mask, and
+ *     set algebra (subset, intersection, union) runs 64 elements per
+ *     machine word with no allocation or sorting.
+ *
+ * Q3: What is Jaccard similarity?
+ * A3: |A ∩ B| / |A ∪ B| - 1.0 for identical sets, 0.0 for disjoint ones.
+ *     On bitsets both counts are popcounts of AND and OR.
+ */
+
+#endif // SKILL_SET_HPP
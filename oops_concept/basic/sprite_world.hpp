@@ -0,0 +1,361 @@
+#ifndef SPRITE_WORLD_HPP
+#define SPRITE_WORLD_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "polymorphism.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * ===============================================
+ * SPRITE WORLD - BATCHED MOVEMENT AND SPATIAL HASH
+ * ===============================================
+ *
+ * GameSprite moves through one virtual move() call per sprite, and finding
+ * neighbours means comparing every sprite with every other. SpriteWorld
+ * keeps sprites as columns instead:
+ *
+ *   x, y, vx, vy       doubles, integrated two sprites per SSE2 instruction
+ *   name, texture      cold data, only touched when exporting a GameSprite
+ *
+ * A uniform grid maps each cell to the sprites inside it. After integrate()
+ * only sprites that crossed a cell boundary are moved between cells, so the
+ * grid is maintained incrementally instead of being rebuilt every tick.
+ * Radius and collision queries then only look at nearby cells.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Why is a spatial hash faster than checking every pair?
+ * 2. How do you choose the grid cell size?
+ * 3. Why does one virtual call per object hurt a simulation loop?
+ */
+
+namespace BasicConcepts {
+
+class SpriteWorld {
+private:
+    struct CellHash {
+        size_t operator()(uint64_t key) const {
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 17);
+        }
+    };
+
+    double cellSize;
+    double inverseCellSize;
+
+    // Hot columns
+    std::vector<double> xs, ys, vxs, vys;
+
+    // Grid membership: cell of each sprite, that cell's list and the slot in
+    // it. References into an unordered_map survive rehashing, so the list
+    // pointers stay valid until their cell is erased - which only happens
+    // when its last member leaves, so only occupied cells are stored.
+    std::vector<uint64_t> cellOf;
+    std::vector<std::vector<uint32_t>*> cellMembers;
+    std::vector<uint32_t> slotInCell;
+    std::unordered_map<uint64_t, std::vector<uint32_t>, CellHash> cells;
+
+    // Bounds for the overflow check in integrate(): largest |x| or |y| as of
+    // the last grid update, and largest |vx| or |vy| ever set
+    double positionBound = 0.0;
+    double velocityBound = 0.0;
+
+    // Cold columns
+    std::vector<std::string> names;
+    std::vector<uint32_t> textureIds;
+    std::vector<std::string> textureNames;
+    std::unordered_map<std::string, uint32_t> textureCodes;
+
+    // Cell coordinates are clamped one short of the int32 limits, so far-away
+    // sprites share the edge cells and neighbour offsets (+-1) cannot overflow
+    static constexpr double MinCell = -2147483647.0;
+    static constexpr double MaxCell = 2147483646.0;
+
+    // floor() without the libm call: clamp, truncate, then fix up negative values
+    int32_t cellCoord(double v) const {
+        double scaled = v * inverseCellSize;
+        if (!(scaled > MinCell)) scaled = MinCell;   // Also catches NaN
+        if (scaled > MaxCell) scaled = MaxCell;
+        int32_t truncated = static_cast<int32_t>(scaled);
+        return truncated - (scaled < truncated);
+    }
+
+    static uint64_t cellKey(int32_t cx, int32_t cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+    }
+
+    uint64_t keyOf(uint32_t id) const { return cellKey(cellCoord(xs[id]), cellCoord(ys[id])); }
+
+    void insertIntoCell(uint32_t id, uint64_t key) {
+        std::vector<uint32_t>& members = cells[key];
+        cellOf[id] = key;
+        cellMembers[id] = &members;
+        slotInCell[id] = static_cast<uint32_t>(members.size());
+        members.push_back(id);
+    }
+
+    // Swap-remove from the sprite's current cell, dropping the cell once empty
+    void eraseFromCell(uint32_t id) {
+        std::vector<uint32_t>& members = *cellMembers[id];
+        uint32_t last = members.back();
+        members[slotInCell[id]] = last;
+        slotInCell[last] = slotInCell[id];
+        members.pop_back();
+        if (members.empty()) {
+            cells.erase(cellOf[id]);
+            cellMembers[id] = nullptr;
+        }
+    }
+
+    // Returns true when the sprite changed cell
+    bool relocate(uint32_t id) {
+        uint64_t key = keyOf(id);
+        if (key == cellOf[id]) return false;
+        eraseFromCell(id);
+        insertIntoCell(id, key);
+        return true;
+    }
+
+    void checkId(uint32_t id) const {
+        if (id >= xs.size()) {
+            throw std::out_of_range("Sprite id out of range");
+        }
+    }
+
+    static void checkFinite(double a, double b, const char* what) {
+        if (!std::isfinite(a) || !std::isfinite(b)) {
+            throw std::invalid_argument(std::string(what) + " must be finite");
+        }
+    }
+
+    void widenBounds(double x, double y, double vx, double vy) {
+        positionBound = std::max({positionBound, std::fabs(x), std::fabs(y)});
+        velocityBound = std::max({velocityBound, std::fabs(vx), std::fabs(vy)});
+    }
+
+    template<typename Visit>
+    void forEachInBox(double minX, double minY, double maxX, double maxY, Visit visit) const {
+        int64_t x0 = cellCoord(minX), x1 = cellCoord(maxX);
+        int64_t y0 = cellCoord(minY), y1 = cellCoord(maxY);
+        if (x1 < x0 || y1 < y0) return;
+        if (static_cast<double>(x1 - x0 + 1) * static_cast<double>(y1 - y0 + 1) > static_cast<double>(cells.size())) {
+            // Box spans more cells than exist: walk the occupied ones instead
+            for (const auto& cell : cells) {
+                int64_t cx = static_cast<int32_t>(cell.first >> 32), cy = static_cast<int32_t>(cell.first & 0xFFFFFFFFu);
+                if (cx < x0 || cx > x1 || cy < y0 || cy > y1) continue;
+                for (uint32_t id : cell.second) visit(id);
+            }
+            return;
+        }
+        for (int64_t cx = x0; cx <= x1; ++cx) {
+            for (int64_t cy = y0; cy <= y1; ++cy) {
+                auto it = cells.find(cellKey(static_cast<int32_t>(cx), static_cast<int32_t>(cy)));
+                if (it == cells.end()) continue;
+                for (uint32_t id : it->second) visit(id);
+            }
+        }
+    }
+
+public:
+    explicit SpriteWorld(double gridCellSize = 32.0)
+        : cellSize(gridCellSize), inverseCellSize(1.0 / gridCellSize) {
+        if (!(gridCellSize > 0)) {
+            throw std::invalid_argument("Cell size must be positive");
+        }
+    }
+
+    void reserve(size_t count) {
+        for (auto* column : {&xs, &ys, &vxs, &vys}) column->reserve(count);
+        cellOf.reserve(count);
+        cellMembers.reserve(count);
+        slotInCell.reserve(count);
+        names.reserve(count);
+        textureIds.reserve(count);
+    }
+
+    // Returns the sprite's id (its row)
+    uint32_t add(const std::string& name, double x, double y, const std::string& texture,
+                 double vx = 0.0, double vy = 0.0) {
+        checkFinite(x, y, "Sprite position");
+        checkFinite(vx, vy, "Sprite velocity");
+        uint32_t id = static_cast<uint32_t>(xs.size());
+        xs.push_back(x);
+        ys.push_back(y);
+        vxs.push_back(vx);
+        vys.push_back(vy);
+        names.push_back(name);
+
+        auto code = textureCodes.find(texture);
+        if (code == textureCodes.end()) {
+            code = textureCodes.emplace(texture, static_cast<uint32_t>(textureNames.size())).first;
+            textureNames.push_back(texture);
+        }
+        textureIds.push_back(code->second);
+
+        cellOf.push_back(0);
+        cellMembers.push_back(nullptr);
+        slotInCell.push_back(0);
+        insertIntoCell(id, keyOf(id));
+        widenBounds(x, y, vx, vy);
+        return id;
+    }
+
+    uint32_t add(const GameSprite& sprite, double vx = 0.0, double vy = 0.0) {
+        std::pair<double, double> position = sprite.getPosition();
+        return add(sprite.getName(), position.first, position.second, sprite.getTexture(), vx, vy);
+    }
+
+    GameSprite toSprite(uint32_t id) const {
+        checkId(id);
+        return GameSprite(names[id], xs[id], ys[id], textureNames[textureIds[id]]);
+    }
+
+    size_t size() const { return xs.size(); }
+    size_t cellCount() const { return cells.size(); }
+    double getCellSize() const { return cellSize; }
+
+    double getX(uint32_t id) const { return xs[id]; }
+    double getY(uint32_t id) const { return ys[id]; }
+    const std::string& getName(uint32_t id) const { return names[id]; }
+
+    void setVelocity(uint32_t id, double vx, double vy) {
+        checkId(id);
+        checkFinite(vx, vy, "Sprite velocity");
+        widenBounds(0.0, 0.0, vx, vy);
+        vxs[id] = vx;
+        vys[id] = vy;
+    }
+
+    // Same as GameSprite::move, without the console output
+    void move(uint32_t id, double dx, double dy) {
+        checkId(id);
+        checkFinite(dx, dy, "Sprite displacement");
+        double x = xs[id] + dx, y = ys[id] + dy;
+        checkFinite(x, y, "Sprite position");
+        xs[id] = x;
+        ys[id] = y;
+        relocate(id);
+        widenBounds(x, y, 0.0, 0.0);
+    }
+
+    /**
+     * One tick: position += velocity * dt for every sprite, then move the
+     * sprites that changed cell. Returns how many changed cell. Throws,
+     * changing nothing, if dt or any new position would not be finite.
+     */
+    size_t integrate(double dt) {
+        if (!std::isfinite(dt)) {
+            throw std::invalid_argument("Time step must be finite");
+        }
+        size_t n = xs.size(), i = 0;
+        if (!std::isfinite(positionBound + velocityBound * std::fabs(dt))) {
+            // Near the range of double: check every sprite before moving any
+            for (size_t j = 0; j < n; ++j) {
+                if (!std::isfinite(xs[j] + vxs[j] * dt) || !std::isfinite(ys[j] + vys[j] * dt)) {
+                    throw std::overflow_error("Sprite position would overflow");
+                }
+            }
+        }
+        double *x = xs.data(), *y = ys.data();
+        const double *vx = vxs.data(), *vy = vys.data();
+#if defined(__SSE2__)
+        __m128d step = _mm_set1_pd(dt);
+        for (; i + 2 <= n; i += 2) {
+            _mm_storeu_pd(x + i, _mm_add_pd(_mm_loadu_pd(x + i), _mm_mul_pd(_mm_loadu_pd(vx + i), step)));
+            _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(_mm_loadu_pd(vy + i), step)));
+        }
+#endif
+        for (; i < n; ++i) {
+            x[i] += vx[i] * dt;
+            y[i] += vy[i] * dt;
+        }
+
+        size_t moved = 0;
+        double bound = 0.0;
+        for (uint32_t id = 0; id < n; ++id) {
+            moved += relocate(id);
+            bound = std::max({bound, std::fabs(x[id]), std::fabs(y[id])});
+        }
+        positionBound = bound;
+        return moved;
+    }
+
+    // Ids of sprites within radius of (cx, cy)
+    std::vector<uint32_t> queryRadius(double cx, double cy, double radius) const {
+        checkFinite(cx, cy, "Query centre");
+        checkFinite(radius, 0.0, "Query radius");
+        std::vector<uint32_t> found;
+        double r2 = radius * radius;
+        forEachInBox(cx - radius, cy - radius, cx + radius, cy + radius, [&](uint32_t id) {
+            double dx = xs[id] - cx, dy = ys[id] - cy;
+            if (dx * dx + dy * dy <= r2) found.push_back(id);
+        });
+        return found;
+    }
+
+    /**
+     * Pairs (a < b) closer than distance, in no particular order. Each cell
+     * is compared with itself and four of its neighbours (right, and the
+     * three above), so every neighbouring pair of cells is visited once.
+     * That only finds everything if distance does not exceed the cell size.
+     */
+    std::vector<std::pair<uint32_t, uint32_t>> findCollisions(double distance) const {
+        if (!(distance >= 0 && distance <= cellSize)) {   // Also rejects NaN
+            throw std::invalid_argument("Collision distance must be between 0 and the cell size");
+        }
+        std::vector<std::pair<uint32_t, uint32_t>> pairs;
+        double d2 = distance * distance;
+        auto check = [&](uint32_t a, uint32_t b) {
+            double dx = xs[b] - xs[a], dy = ys[b] - ys[a];
+            if (dx * dx + dy * dy < d2) pairs.emplace_back(std::min(a, b), std::max(a, b));
+        };
+        const int32_t neighbours[4][2] = {{1, -1}, {1, 0}, {1, 1}, {0, 1}};
+        for (const auto& cell : cells) {
+            const std::vector<uint32_t>& members = cell.second;
+            for (size_t i = 0; i < members.size(); ++i) {
+                for (size_t j = i + 1; j < members.size(); ++j) check(members[i], members[j]);
+            }
+            int32_t cx = static_cast<int32_t>(cell.first >> 32), cy = static_cast<int32_t>(cell.first & 0xFFFFFFFFu);
+            for (const auto& offset : neighbours) {
+                auto other = cells.find(cellKey(cx + offset[0], cy + offset[1]));
+                if (other == cells.end()) continue;
+                for (uint32_t a : members) {
+                    for (uint32_t b : other->second) check(a, b);
+                }
+            }
+        }
+        return pairs;
+    }
+};
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Why is a spatial hash faster than checking every pair?
+ * A1: Objects only interact with nearby objects. Bucketing by grid cell
+ *     turns an O(n^2) pair check into O(n * k), where k is the number of
+ *     objects in the neighbouring cells.
+ *
+ * Q2: How do you choose the grid cell size?
+ * A2: Around the largest query radius: smaller cells mean more cells per
+ *     query, larger cells mean more false candidates per cell.
+ *
+ * Q3: Why does one virtual call per object hurt a simulation loop?
+ * A3: The call cannot be inlined or vectorized and each object is a
+ *     separate heap allocation, so the loop is bound by indirect calls and
+ *     cache misses instead of arithmetic.
+ */
+
+#endif // SPRITE_WORLD_HPP
@@ -0,0 +1,391 @@
+#ifndef VEHICLE_INVENTORY_HPP
+#define VEHICLE_INVENTORY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "inheritance.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * ===============================================
+ * COLUMNAR VEHICLE INVENTORY
+ * ===============================================
+ *
+ * A std::vector<std::unique_ptr<Vehicle>> keeps every vehicle in its own heap
+ * object, so filtering by brand, year and price chases a pointer and
+ * compares a brand string for each one. VehicleInventory keeps the
+ * filterable fields in columns instead:
+ *
+ *   brand, model   uint32 codes into per-column dictionaries
+ *   year           int16
+ *   price          int64 cents
+ *
+ * Predicates are evaluated 16 rows at a time with SSE2 into a bitmask;
+ * aggregations then visit only the matching rows. Type-specific fields
+ * (doors, fuel, sidecar, ...) sit in side tables so vehicles can be exported
+ * back into the class hierarchy unchanged.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. What is dictionary encoding?
+ * 2. How do you evaluate a filter with SIMD?
+ * 3. When is a class hierarchy the wrong data layout?
+ */
+
+namespace BasicConcepts {
+
+/**
+ * Maps each distinct string to a dense uint32 code
+ */
+class StringDictionary {
+private:
+    std::vector<std::string> values;
+    std::unordered_map<std::string, uint32_t> codes;
+
+public:
+    uint32_t encode(const std::string& value) {
+        auto it = codes.find(value);
+        if (it != codes.end()) return it->second;
+        uint32_t code = static_cast<uint32_t>(values.size());
+        values.push_back(value);
+        codes.emplace(value, code);
+        return code;
+    }
+
+    // Code of a known value, or -1
+    int64_t find(const std::string& value) const {
+        auto it = codes.find(value);
+        return it == codes.end() ? -1 : static_cast<int64_t>(it->second);
+    }
+
+    const std::string& decode(uint32_t code) const { return values.at(code); }
+    size_t size() const { return values.size(); }
+};
+
+enum class VehicleKind : uint8_t { Car, Motorcycle, SportsCar };
+
+/**
+ * Row filter; unset bounds match everything
+ */
+struct VehicleFilter {
+    std::string brand;                                   // Empty = any brand
+    int minYear = std::numeric_limits<int16_t>::min();
+    int maxYear = std::numeric_limits<int16_t>::max();
+    double minPrice = 0;
+    double maxPrice = std::numeric_limits<double>::infinity();
+};
+
+class VehicleInventory {
+public:
+    static constexpr double MaxPrice = 1.0e15;   // Keeps cents far from int64 overflow
+
+private:
+    struct CarFields {
+        int doors;
+        std::string fuel;
+        double engine;
+    };
+    struct MotorcycleFields {
+        bool sidecar;
+        std::string type;
+    };
+    struct SportsFields {
+        int maxSpeed;
+        double acceleration;
+        bool turbo;
+    };
+
+    // Hot columns
+    std::vector<uint32_t> brands;
+    std::vector<uint32_t> models;
+    std::vector<int16_t> years;
+    std::vector<int64_t> prices;       // Cents
+    std::vector<VehicleKind> kinds;
+    std::vector<uint32_t> detailRow;   // Row in the side table(s) of its kind
+
+    StringDictionary brandDictionary;
+    StringDictionary modelDictionary;
+
+    // Cold side tables, only touched on import/export
+    std::vector<CarFields> carFields;              // Cars and sports cars
+    std::vector<MotorcycleFields> motorcycleFields;
+    std::vector<SportsFields> sportsFields;        // Parallel to carFields for sports cars
+    std::vector<uint32_t> sportsOfCar;             // carFields row -> sportsFields row
+
+    static int64_t toCents(double price) {
+        return static_cast<int64_t>(std::llround(price * 100.0));
+    }
+
+    uint32_t addCommon(VehicleKind kind, const std::string& brand, const std::string& model,
+                       int year, double price) {
+        if (year < std::numeric_limits<int16_t>::min() || year > std::numeric_limits<int16_t>::max()) {
+            throw std::invalid_argument("Year does not fit the int16 year column");
+        }
+        if (!(price >= 0) || price > MaxPrice) {
+            throw std::invalid_argument("Price must be non-negative and finite");
+        }
+        brands.push_back(brandDictionary.encode(brand));
+        models.push_back(modelDictionary.encode(model));
+        years.push_back(static_cast<int16_t>(year));
+        prices.push_back(toCents(price));
+        kinds.push_back(kind);
+        return static_cast<uint32_t>(kinds.size() - 1);
+    }
+
+    // Calls visit(row) for every row matching the filter, in row order
+    template<typename Visit>
+    void scan(const VehicleFilter& filter, Visit visit) const {
+        int64_t brandCode = -1;
+        if (!filter.brand.empty()) {
+            brandCode = brandDictionary.find(filter.brand);
+            if (brandCode < 0) return;
+        }
+        const int16_t minYear = static_cast<int16_t>(std::max<int>(filter.minYear, std::numeric_limits<int16_t>::min()));
+        const int16_t maxYear = static_cast<int16_t>(std::min<int>(filter.maxYear, std::numeric_limits<int16_t>::max()));
+        if (std::isnan(filter.minPrice) || std::isnan(filter.maxPrice)) return;
+        // Clamped so (price - min) and (max - price) cannot overflow
+        const int64_t minCents = toCents(std::min(std::max(filter.minPrice, 0.0), MaxPrice));
+        const int64_t maxCents = toCents(std::min(filter.maxPrice, MaxPrice));
+        if (minYear > maxYear || minCents > maxCents) return;
+
+        const uint32_t count = static_cast<uint32_t>(years.size());
+        uint32_t row = 0;
+
+#if defined(__SSE2__)
+        const __m128i yearLow = _mm_set1_epi16(static_cast<int16_t>(minYear - (minYear > INT16_MIN ? 1 : 0)));
+        const __m128i yearHigh = _mm_set1_epi16(static_cast<int16_t>(maxYear + (maxYear < INT16_MAX ? 1 : 0)));
+        const bool yearLowOpen = minYear == INT16_MIN;
+        const bool yearHighOpen = maxYear == INT16_MAX;
+        const __m128i brandValue = _mm_set1_epi32(static_cast<int32_t>(brandCode));
+        const __m128i priceLow = _mm_set1_epi64x(minCents);
+        const __m128i priceHigh = _mm_set1_epi64x(maxCents);
+        const __m128i allOnes = _mm_set1_epi8(-1);
+
+        for (; row + 16 <= count; row += 16) {
+            // year: minYear - 1 < y < maxYear + 1, 8 lanes per compare
+            __m128i y0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&years[row]));
+            __m128i y1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&years[row + 8]));
+            __m128i ok0 = _mm_and_si128(yearLowOpen ? allOnes : _mm_cmpgt_epi16(y0, yearLow),
+                                        yearHighOpen ? allOnes : _mm_cmplt_epi16(y0, yearHigh));
+            __m128i ok1 = _mm_and_si128(yearLowOpen ? allOnes : _mm_cmpgt_epi16(y1, yearLow),
+                                        yearHighOpen ? allOnes : _mm_cmplt_epi16(y1, yearHigh));
+            __m128i mask = _mm_packs_epi16(ok0, ok1);   // 16 bytes, one per row
+
+            // brand: 4 lanes per compare
+            if (brandCode >= 0) {
+                __m128i b[4];
+                for (int k = 0; k < 4; ++k) {
+                    __m128i codes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&brands[row + 4 * k]));
+                    b[k] = _mm_cmpeq_epi32(codes, brandValue);
+                }
+                __m128i brandMask = _mm_packs_epi16(_mm_packs_epi32(b[0], b[1]), _mm_packs_epi32(b[2], b[3]));
+                mask = _mm_and_si128(mask, brandMask);
+            }
+            uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(mask));
+            if (bits == 0) continue;
+
+            // price: sign of (p - min) and (max - p), 2 lanes per subtract
+            uint32_t priceBits = 0;
+            for (int k = 0; k < 8; ++k) {
+                __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&prices[row + 2 * k]));
+                int below = _mm_movemask_pd(_mm_castsi128_pd(_mm_sub_epi64(p, priceLow)));
+                int above = _mm_movemask_pd(_mm_castsi128_pd(_mm_sub_epi64(priceHigh, p)));
+                priceBits |= static_cast<uint32_t>(~(below | above) & 3) << (2 * k);
+            }
+            bits &= priceBits;
+
+            while (bits) {
+                visit(row + static_cast<uint32_t>(__builtin_ctz(bits)));
+                bits &= bits - 1;
+            }
+        }
+#endif
+        for (; row < count; ++row) {
+            if (brandCode >= 0 && brands[row] != static_cast<uint32_t>(brandCode)) continue;
+            if (years[row] < minYear || years[row] > maxYear) continue;
+            if (prices[row] < minCents || prices[row] > maxCents) continue;
+            visit(row);
+        }
+    }
+
+public:
+    void reserve(size_t count) {
+        brands.reserve(count);
+        models.reserve(count);
+        years.reserve(count);
+        prices.reserve(count);
+        kinds.reserve(count);
+        detailRow.reserve(count);
+    }
+
+    // ======================= IMPORT =======================
+    uint32_t addCar(const std::string& brand, const std::string& model, int year, double price,
+                    int doors, const std::string& fuel, double engine) {
+        uint32_t row = addCommon(VehicleKind::Car, brand, model, year, price);
+        detailRow.push_back(static_cast<uint32_t>(carFields.size()));
+        carFields.push_back(CarFields{doors, fuel, engine});
+        sportsOfCar.push_back(UINT32_MAX);
+        return row;
+    }
+
+    uint32_t addMotorcycle(const std::string& brand, const std::string& model, int year, double price,
+                           bool sidecar, const std::string& type) {
+        uint32_t row = addCommon(VehicleKind::Motorcycle, brand, model, year, price);
+        detailRow.push_back(static_cast<uint32_t>(motorcycleFields.size()));
+        motorcycleFields.push_back(MotorcycleFields{sidecar, type});
+        return row;
+    }
+
+    uint32_t addSportsCar(const std::string& brand, const std::string& model, int year, double price,
+                          int doors, const std::string& fuel, double engine,
+                          int maxSpeed, double acceleration, bool turbo) {
+        uint32_t row = addCommon(VehicleKind::SportsCar, brand, model, year, price);
+        detailRow.push_back(static_cast<uint32_t>(carFields.size()));
+        carFields.push_back(CarFields{doors, fuel, engine});
+        sportsOfCar.push_back(static_cast<uint32_t>(sportsFields.size()));
+        sportsFields.push_back(SportsFields{maxSpeed, acceleration, turbo});
+        return row;
+    }
+
+    /**
+     * Import from the class hierarchy. Other Car subclasses (e.g. SmartCar)
+     * are stored as plain Cars.
+     */
+    uint32_t add(const Vehicle& vehicle) {
+        if (auto sports = dynamic_cast<const SportsCar*>(&vehicle)) {
+            return addSportsCar(sports->getBrand(), sports->getModel(), sports->getYear(), sports->getPrice(),
+                                sports->getNumberOfDoors(), sports->getFuelType(), sports->getEngineCapacity(),
+                                sports->getMaxSpeed(), sports->getAcceleration(), sports->getHasTurbo());
+        }
+        if (auto car = dynamic_cast<const Car*>(&vehicle)) {
+            return addCar(car->getBrand(), car->getModel(), car->getYear(), car->getPrice(),
+                          car->getNumberOfDoors(), car->getFuelType(), car->getEngineCapacity());
+        }
+        if (auto bike = dynamic_cast<const Motorcycle*>(&vehicle)) {
+            return addMotorcycle(bike->getBrand(), bike->getModel(), bike->getYear(), bike->getPrice(),
+                                 bike->getHasSidecar(), bike->getMotorcycleType());
+        }
+        throw std::invalid_argument("Unsupported vehicle type");
+    }
+
+    // ======================= EXPORT =======================
+    std::unique_ptr<Vehicle> toVehicle(uint32_t row) const {
+        if (row >= kinds.size()) {
+            throw std::out_of_range("Vehicle row out of range");
+        }
+        const std::string& brand = brandDictionary.decode(brands[row]);
+        const std::string& model = modelDictionary.decode(models[row]);
+        double price = static_cast<double>(prices[row]) / 100.0;
+
+        switch (kinds[row]) {
+            case VehicleKind::Motorcycle: {
+                const MotorcycleFields& m = motorcycleFields[detailRow[row]];
+                return std::make_unique<Motorcycle>(brand, model, years[row], price, m.sidecar, m.type);
+            }
+            case VehicleKind::SportsCar: {
+                const CarFields& c = carFields[detailRow[row]];
+                const SportsFields& s = sportsFields[sportsOfCar[detailRow[row]]];
+                return std::make_unique<SportsCar>(brand, model, years[row], price, c.doors, c.fuel, c.engine,
+                                                   s.maxSpeed, s.acceleration, s.turbo);
+            }
+            case VehicleKind::Car:
+            default: {
+                const CarFields& c = carFields[detailRow[row]];
+                return std::make_unique<Car>(brand, model, years[row], price, c.doors, c.fuel, c.engine);
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Vehicle>> toVehicles() const {
+        std::vector<std::unique_ptr<Vehicle>> vehicles;
+        vehicles.reserve(kinds.size());
+        for (uint32_t row = 0; row < kinds.size(); ++row) {
+            vehicles.push_back(toVehicle(row));
+        }
+        return vehicles;
+    }
+
+    // ======================= COLUMN ACCESS =======================
+    size_t size() const { return kinds.size(); }
+    const std::string& brand(uint32_t row) const { return brandDictionary.decode(brands.at(row)); }
+    const std::string& model(uint32_t row) const { return modelDictionary.decode(models.at(row)); }
+    int year(uint32_t row) const { return years.at(row); }
+    double price(uint32_t row) const { return static_cast<double>(prices.at(row)) / 100.0; }
+    VehicleKind kind(uint32_t row) const { return kinds.at(row); }
+    size_t brandCount() const { return brandDictionary.size(); }
+
+    // ======================= QUERIES =======================
+    size_t count(const VehicleFilter& filter) const {
+        size_t matches = 0;
+        scan(filter, [&](uint32_t) { ++matches; });
+        return matches;
+    }
+
+    std::vector<uint32_t> select(const VehicleFilter& filter) const {
+        std::vector<uint32_t> rows;
+        scan(filter, [&](uint32_t row) { rows.push_back(row); });
+        return rows;
+    }
+
+    double averagePrice(const VehicleFilter& filter) const {
+        int64_t total = 0;
+        size_t matches = 0;
+        scan(filter, [&](uint32_t row) { total += prices[row]; ++matches; });
+        return matches == 0 ? 0.0 : static_cast<double>(total) / 100.0 / static_cast<double>(matches);
+    }
+
+    // Average price per brand over the matching rows
+    std::map<std::string, double> averagePriceByBrand(const VehicleFilter& filter = VehicleFilter()) const {
+        std::vector<int64_t> totals(brandDictionary.size(), 0);
+        std::vector<uint64_t> counts(brandDictionary.size(), 0);
+        scan(filter, [&](uint32_t row) {
+            totals[brands[row]] += prices[row];
+            ++counts[brands[row]];
+        });
+
+        std::map<std::string, double> averages;
+        for (uint32_t code = 0; code < totals.size(); ++code) {
+            if (counts[code] > 0) {
+                averages[brandDictionary.decode(code)] =
+                    static_cast<double>(totals[code]) / 100.0 / static_cast<double>(counts[code]);
+            }
+        }
+        return averages;
+    }
+};
+
+} // namespace BasicConcepts
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: What is dictionary encoding?
+ * A1: Replacing each repeated value (a brand name) with a small integer
+ *     code plus one shared code -> value table. Columns shrink, and
+ *     equality filters compare integers instead of strings.
+ *
+ * Q2: How do you evaluate a filter with SIMD?
+ * A2: Compare a whole register of column values against the bound at once,
+ *     AND the per-column lane masks together, and movemask the result into
+ *     one bit per row. Only rows whose bit is set are visited afterwards.
+ *
+ * Q3: When is a class hierarchy the wrong data layout?
+ * A3: When the hot operations are bulk scans over a few fields. Separate
+ *     heap objects scatter those fields across memory; columns keep them
+ *     contiguous. Behaviour-rich, one-at-a-time code still suits classes,
+ *     which is why the inventory converts back to them.
+ */
+
+#endif // VEHICLE_INVENTORY_HPP
@@ -1,6 +1,7 @@
 #ifndef ADAPTER_DECORATOR_HPP
 #define ADAPTER_DECORATOR_HPP
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -400,7 +401,7 @@ inline void demonstrateAdapterDecorator() {
     
     // Decorated coffee with multiple additions
     std::cout << "\n--- Decorated Coffee (Espresso + Milk + Sugar + Vanilla) ---" << std::endl;
-    auto coffee2 = std::make_unique<Espresso>();
+    std::unique_ptr<Coffee> coffee2 = std::make_unique<Espresso>();
     coffee2 = std::make_unique<MilkDecorator>(std::move(coffee2));
     coffee2 = std::make_unique<SugarDecorator>(std::move(coffee2));
     coffee2 = std::make_unique<VanillaDecorator>(std::move(coffee2));
@@ -411,7 +412,7 @@ inline void demonstrateAdapterDecorator() {
     
     // Luxury coffee with all decorations
     std::cout << "\n--- Luxury Coffee (All Decorations) ---" << std::endl;
-    auto coffee3 = std::make_unique<SimpleCoffee>();
+    std::unique_ptr<Coffee> coffee3 = std::make_unique<SimpleCoffee>();
     coffee3 = std::make_unique<MilkDecorator>(std::move(coffee3));
     coffee3 = std::make_unique<SugarDecorator>(std::move(coffee3));
     coffee3 = std::make_unique<VanillaDecorator>(std::move(coffee3));
@@ -435,7 +436,7 @@ inline void demonstrateAdapterDecorator() {
     
     // Multiple decorators
     std::cout << "\n--- Multiple Text Decorators ---" << std::endl;
-    auto processor2 = std::make_unique<PlainTextProcessor>();
+    std::unique_ptr<TextProcessor> processor2 = std::make_unique<PlainTextProcessor>();
     processor2 = std::make_unique<UpperCaseDecorator>(std::move(processor2));
     processor2 = std::make_unique<CompressionDecorator>(std::move(processor2));
     processor2 = std::make_unique<EncryptionDecorator>(std::move(processor2), 5);
@@ -446,7 +447,7 @@ inline void demonstrateAdapterDecorator() {
     
     // Different decorator order
     std::cout << "\n--- Different Decorator Order ---" << std::endl;
-    auto processor3 = std::make_unique<PlainTextProcessor>();
+    std::unique_ptr<TextProcessor> processor3 = std::make_unique<PlainTextProcessor>();
     processor3 = std::make_unique<EncryptionDecorator>(std::move(processor3), 2);
     processor3 = std::make_unique<UpperCaseDecorator>(std::move(processor3));
     processor3 = std::make_unique<CompressionDecorator>(std::move(processor3));
@@ -307,7 +307,7 @@ public:
 class AdvancedShapeFactory {
 private:
     using Creator = std::function<std::unique_ptr<Shape>(double, double)>;
-    static std::map<std::string, Creator> creators;
+    static inline std::map<std::string, Creator> creators;
     
 public:
     template<typename T>
@@ -338,9 +338,6 @@ public:
     }
 };
 
-// Static member definition
-std::map<std::string, AdvancedShapeFactory::Creator> AdvancedShapeFactory::creators;
-
 // ======================= DEMONSTRATION FUNCTIONS =======================
 inline void demonstrateFactory() {
     std::cout << "\n===== FACTORY PATTERNS DEMO =====\n" << std::endl;
@@ -0,0 +1,489 @@
+#ifndef FLYWEIGHT_HPP
+#define FLYWEIGHT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "factory.hpp"
+#include "../advanced/abstraction.hpp"
+
+/**
+ * FLYWEIGHT DESIGN PATTERN
+ * - Splits object state into intrinsic (shared, immutable) and extrinsic (per instance)
+ * - Intrinsic state lives once in a shared flyweight; instances keep a pointer to it
+ * - Used here for UI products: theme, name and label live once per factory in a
+ *   ProductFace, and each product is a vtable pointer, a face pointer and its
+ *   genuinely per-instance state (flags, a text field's value)
+ * - Pool allocation removes the per-object heap allocation as well
+ *
+ * Applies to both abstract factory families:
+ *   WindowsFactory / MacFactory           (factory.hpp)     -> FlyweightGUIFactory
+ *   WindowsUIFactory / MacUIFactory       (abstraction.hpp) -> FlyweightUIFactory
+ */
+
+// ======================= SHARED INTRINSIC STATE =======================
+struct PlatformTheme {
+    std::string platform;
+    std::string buttonLeft, buttonRight;
+    std::string fieldLeft, fieldRight;
+    std::string buttonRender, buttonClick;
+    std::string checkboxRender, checkboxToggle;
+
+    static const PlatformTheme& windows() {
+        static const PlatformTheme theme{
+            "Windows", "[", "]", "|", "               |",
+            "Rendering Windows-style button with blue theme",
+            "Windows button clicked with system sound",
+            "Rendering Windows-style checkbox with square design",
+            "Windows checkbox toggled with animation"};
+        return theme;
+    }
+
+    static const PlatformTheme& mac() {
+        static const PlatformTheme theme{
+            "Mac", "(", ")", "⌐", "               ¬",
+            "Rendering Mac-style button with rounded corners",
+            "Mac button clicked with haptic feedback",
+            "Rendering Mac-style checkbox with circular design",
+            "Mac checkbox toggled with smooth transition"};
+        return theme;
+    }
+};
+
+// Shared state of one product: the theme plus the strings that repeat across
+// instances (component name, label or placeholder)
+struct ProductFace {
+    const PlatformTheme* theme;
+    std::string name;
+    std::string text;
+};
+
+// Interns faces for one factory. Keeps its own copy of the theme and never
+// moves a face, so a product needs just one pointer to its shared state.
+class FaceTable {
+private:
+    PlatformTheme theme;
+    std::deque<ProductFace> faces;  // deque never moves existing elements
+    std::unordered_map<std::string, const ProductFace*> lookup;  // name + '\0' + text
+
+public:
+    explicit FaceTable(const PlatformTheme& t) : theme(t) {}
+
+    const ProductFace* intern(std::string_view name, std::string_view text) {
+        std::string key;
+        key.reserve(name.size() + 1 + text.size());
+        key.append(name).push_back('\0');
+        key.append(text);
+        auto it = lookup.find(key);
+        if (it != lookup.end()) {
+            return it->second;
+        }
+        faces.push_back(ProductFace{&theme, std::string(name), std::string(text)});
+        const ProductFace* face = &faces.back();
+        lookup.emplace(std::move(key), face);
+        return face;
+    }
+
+    const PlatformTheme& getTheme() const { return theme; }
+    size_t size() const { return faces.size(); }
+};
+
+// ======================= POOL ALLOCATION =======================
+/**
+ * Hands out objects from fixed-size blocks and recycles freed slots.
+ *
+ * Blocks are aligned to their size, so a slot finds its block header (and
+ * through it the pool) by masking its own address: objects carry no back
+ * pointer. Pools are shared through make(). When the last reference goes,
+ * objects the pool owns (create()) are destroyed, while objects handed out
+ * with createShared() keep the pool, and its keepAlive state, until each
+ * one is deleted through its type's operator delete.
+ */
+template<typename T>
+class ObjectPool {
+private:
+    static constexpr size_t BlockBytes = size_t(1) << 16;
+
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct BlockHeader {
+        ObjectPool* owner;
+        size_t number;   // Index into occupied and handedOut
+    };
+
+    static constexpr size_t HeaderSlots = (sizeof(BlockHeader) + sizeof(Slot) - 1) / sizeof(Slot);
+    static constexpr size_t SlotsPerBlock = BlockBytes / sizeof(Slot) - HeaderSlots;
+    static_assert(alignof(Slot) <= BlockBytes && BlockBytes / sizeof(Slot) > HeaderSlots,
+                  "type too large for a pool block");
+
+    std::vector<unsigned char*> blocks;
+    std::unordered_set<uintptr_t> blockStarts;
+    std::vector<std::vector<bool>> occupied;    // One bit per slot, per block
+    std::vector<std::vector<bool>> handedOut;   // Deleted by their holder, not by the pool
+    Slot* freeList = nullptr;
+    size_t nextInBlock = SlotsPerBlock;
+    size_t liveCount = 0;
+    bool retired = false;                       // No references left; waiting for handed-out objects
+    std::shared_ptr<const void> keepAlive;      // State the objects point into
+
+    explicit ObjectPool(std::shared_ptr<const void> state) : keepAlive(std::move(state)) {}
+
+    ~ObjectPool() {
+        for (unsigned char* block : blocks) {
+            ::operator delete(block, std::align_val_t(BlockBytes));
+        }
+    }
+
+    static BlockHeader* headerOf(const void* p) {
+        return reinterpret_cast<BlockHeader*>(reinterpret_cast<uintptr_t>(p) & ~uintptr_t(BlockBytes - 1));
+    }
+
+    static size_t slotIndex(const void* p) {
+        return (reinterpret_cast<uintptr_t>(p) & uintptr_t(BlockBytes - 1)) / sizeof(Slot) - HeaderSlots;
+    }
+
+    void addBlock() {
+        auto* block = static_cast<unsigned char*>(::operator new(BlockBytes, std::align_val_t(BlockBytes)));
+        new (block) BlockHeader{this, blocks.size()};
+        blocks.push_back(block);
+        blockStarts.insert(reinterpret_cast<uintptr_t>(block));
+        occupied.emplace_back(SlotsPerBlock, false);
+        handedOut.emplace_back(SlotsPerBlock, false);
+        nextInBlock = 0;
+    }
+
+    template<typename... Args>
+    T* emplace(bool shared, Args&&... args) {
+        Slot* slot;
+        if (freeList) {
+            slot = freeList;
+            freeList = freeList->next;
+        } else {
+            if (nextInBlock == SlotsPerBlock) addBlock();
+            slot = reinterpret_cast<Slot*>(blocks.back()) + HeaderSlots + nextInBlock++;
+        }
+
+        T* object = new (slot->storage) T(std::forward<Args>(args)...);
+        size_t number = headerOf(slot)->number, index = slotIndex(slot);
+        occupied[number][index] = true;
+        handedOut[number][index] = shared;
+        ++liveCount;
+        return object;
+    }
+
+    void releaseSlot(void* p) {
+        size_t number = headerOf(p)->number, index = slotIndex(p);
+        occupied[number][index] = false;
+        handedOut[number][index] = false;
+        Slot* slot = static_cast<Slot*>(p);
+        slot->next = freeList;
+        freeList = slot;
+        --liveCount;
+    }
+
+    // Last reference gone: destroy what the pool owns, linger for the rest
+    void retire() {
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            for (size_t i = 0; i < SlotsPerBlock; ++i) {
+                if (occupied[b][i] && !handedOut[b][i]) {
+                    Slot* slot = reinterpret_cast<Slot*>(blocks[b]) + HeaderSlots + i;
+                    std::launder(reinterpret_cast<T*>(slot->storage))->~T();
+                    releaseSlot(slot);
+                }
+            }
+        }
+        retired = true;
+        if (liveCount == 0) delete this;
+    }
+
+public:
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    static std::shared_ptr<ObjectPool> make(std::shared_ptr<const void> keepAlive = nullptr) {
+        return std::shared_ptr<ObjectPool>(new ObjectPool(std::move(keepAlive)),
+                                           [](ObjectPool* pool) { pool->retire(); });
+    }
+
+    // Owned by the pool until destroy(), or until the pool goes away
+    template<typename... Args>
+    T* create(Args&&... args) {
+        return emplace(false, std::forward<Args>(args)...);
+    }
+
+    // Owned by the caller, who deletes it; outlives the pool's references
+    template<typename... Args>
+    T* createShared(Args&&... args) {
+        return emplace(true, std::forward<Args>(args)...);
+    }
+
+    // True if p is the address of a live object this pool owns (not handed out)
+    bool owns(const void* p) const {
+        uintptr_t address = reinterpret_cast<uintptr_t>(p);
+        uintptr_t offset = address & uintptr_t(BlockBytes - 1);
+        if (blockStarts.count(address - offset) == 0 || offset % sizeof(Slot) != 0 ||
+            offset / sizeof(Slot) < HeaderSlots) {
+            return false;
+        }
+        size_t number = headerOf(p)->number, index = slotIndex(p);
+        return occupied[number][index] && !handedOut[number][index];
+    }
+
+    // Foreign, handed-out or already freed pointers are ignored
+    void destroy(T* object) {
+        if (!owns(object)) return;
+        object->~T();
+        releaseSlot(object);
+    }
+
+    // For a pooled type's operator delete: frees the slot of a handed-out
+    // object whose destructor has run, and the pool once it is retired and empty
+    static void reclaim(void* object) {
+        ObjectPool* pool = headerOf(object)->owner;
+        pool->releaseSlot(object);
+        if (pool->retired && pool->liveCount == 0) delete pool;
+    }
+
+    size_t live() const { return liveCount; }
+    size_t capacity() const { return blocks.size() * SlotsPerBlock; }
+};
+
+// ======================= FLYWEIGHT PRODUCTS (factory.hpp family) =======================
+// Products live only in an ObjectPool: constructors are private to the pool,
+// and operator delete hands the slot back to it
+class FlyweightButton : public Button {
+private:
+    const ProductFace* face;   // Theme and label, shared
+
+    friend class ObjectPool<FlyweightButton>;
+    explicit FlyweightButton(const ProductFace* f) : face(f) {}
+
+public:
+    static void operator delete(void* p) { ObjectPool<FlyweightButton>::reclaim(p); }
+
+    void render() override {
+        const PlatformTheme& theme = *face->theme;
+        std::cout << theme.buttonRender << ": " << theme.buttonLeft << face->text
+                  << theme.buttonRight << std::endl;
+    }
+
+    void onClick() override {
+        std::cout << face->theme->buttonClick << std::endl;
+    }
+
+    const std::string& getLabel() const { return face->text; }
+};
+
+class FlyweightCheckbox : public Checkbox {
+private:
+    const PlatformTheme* theme;
+    bool checked = false;
+
+    friend class ObjectPool<FlyweightCheckbox>;
+    explicit FlyweightCheckbox(const PlatformTheme* t) : theme(t) {}
+
+public:
+    static void operator delete(void* p) { ObjectPool<FlyweightCheckbox>::reclaim(p); }
+
+    void render() override {
+        std::cout << theme->checkboxRender << (checked ? " [x]" : " [ ]") << std::endl;
+    }
+
+    void toggle() override {
+        checked = !checked;
+        std::cout << theme->checkboxToggle << std::endl;
+    }
+
+    bool isChecked() const { return checked; }
+};
+
+/**
+ * Pool-backed GUIFactory. createButton()/createCheckbox() serve existing
+ * GUIFactory clients; the products may outlive the factory, and deleting
+ * one returns its slot to the pool. acquire*() hands out raw pointers the
+ * factory keeps owning: release() them, or they go with the factory.
+ */
+class FlyweightGUIFactory : public GUIFactory {
+private:
+    std::shared_ptr<FaceTable> faces;
+    std::shared_ptr<ObjectPool<FlyweightButton>> buttons;
+    std::shared_ptr<ObjectPool<FlyweightCheckbox>> checkboxes;
+
+public:
+    explicit FlyweightGUIFactory(const PlatformTheme& t)
+        : faces(std::make_shared<FaceTable>(t)),
+          buttons(ObjectPool<FlyweightButton>::make(faces)),
+          checkboxes(ObjectPool<FlyweightCheckbox>::make(faces)) {}
+
+    FlyweightGUIFactory(const FlyweightGUIFactory&) = delete;
+    FlyweightGUIFactory& operator=(const FlyweightGUIFactory&) = delete;
+
+    std::unique_ptr<Button> createButton() override {
+        return std::unique_ptr<Button>(buttons->createShared(faces->intern({}, "OK")));
+    }
+
+    std::unique_ptr<Checkbox> createCheckbox() override {
+        return std::unique_ptr<Checkbox>(checkboxes->createShared(&faces->getTheme()));
+    }
+
+    Button* acquireButton(std::string_view label = "OK") {
+        return buttons->create(faces->intern({}, label));
+    }
+
+    Checkbox* acquireCheckbox() {
+        return checkboxes->create(&faces->getTheme());
+    }
+
+    // Foreign, handed-out or already released pointers are ignored
+    void release(Button* button) {
+        if (buttons->owns(button)) buttons->destroy(static_cast<FlyweightButton*>(button));
+    }
+    void release(Checkbox* checkbox) {
+        if (checkboxes->owns(checkbox)) checkboxes->destroy(static_cast<FlyweightCheckbox*>(checkbox));
+    }
+
+    const PlatformTheme& getTheme() const { return faces->getTheme(); }
+    size_t liveComponents() const { return buttons->live() + checkboxes->live(); }
+};
+
+// ======================= FLYWEIGHT PRODUCTS (abstraction.hpp family) =======================
+// Name, text and style come from the shared face; only the visibility and
+// dirty flags (and a text field's value) are per instance
+class ThemedButton : public AdvancedConcepts::Button {
+private:
+    const ProductFace* face;
+
+    friend class ObjectPool<ThemedButton>;
+    explicit ThemedButton(const ProductFace* f) : face(f) {}
+
+public:
+    static void operator delete(void* p) { ObjectPool<ThemedButton>::reclaim(p); }
+
+    void render() override {
+        const PlatformTheme& theme = *face->theme;
+        std::cout << "Rendering " << theme.platform << "-style button: " << face->text << std::endl;
+        std::cout << "  " << theme.buttonLeft << face->text << theme.buttonRight << std::endl;
+    }
+
+    void handleClick() override {
+        std::cout << face->theme->platform << " button '" << face->text << "' clicked!" << std::endl;
+    }
+
+    const std::string& getName() const override { return face->name; }
+    const std::string& getText() const override { return face->text; }
+    const std::string& getStyle() const override { return face->theme->platform; }
+};
+
+class ThemedTextField : public AdvancedConcepts::TextField {
+private:
+    const ProductFace* face;
+
+    friend class ObjectPool<ThemedTextField>;
+    explicit ThemedTextField(const ProductFace* f) : face(f) {}
+
+public:
+    static void operator delete(void* p) { ObjectPool<ThemedTextField>::reclaim(p); }
+
+    void render() override {
+        const PlatformTheme& theme = *face->theme;
+        std::cout << "Rendering " << theme.platform << "-style text field" << std::endl;
+        std::cout << "  " << theme.fieldLeft << face->text << theme.fieldRight << std::endl;
+    }
+
+    void handleClick() override {
+        std::cout << face->theme->platform << " text field focused" << std::endl;
+    }
+
+    const std::string& getName() const override { return face->name; }
+    const std::string& getPlaceholder() const override { return face->text; }
+};
+
+/**
+ * Pool-backed UIFactory, usable by Application and other UIFactory clients;
+ * same ownership rules as FlyweightGUIFactory
+ */
+class FlyweightUIFactory : public AdvancedConcepts::UIFactory {
+private:
+    std::shared_ptr<FaceTable> faces;
+    std::shared_ptr<ObjectPool<ThemedButton>> buttons;
+    std::shared_ptr<ObjectPool<ThemedTextField>> textFields;
+
+public:
+    explicit FlyweightUIFactory(const PlatformTheme& t)
+        : faces(std::make_shared<FaceTable>(t)),
+          buttons(ObjectPool<ThemedButton>::make(faces)),
+          textFields(ObjectPool<ThemedTextField>::make(faces)) {}
+
+    FlyweightUIFactory(const FlyweightUIFactory&) = delete;
+    FlyweightUIFactory& operator=(const FlyweightUIFactory&) = delete;
+
+    std::unique_ptr<AdvancedConcepts::Button> createButton(const std::string& name,
+                                                           const std::string& text) override {
+        return std::unique_ptr<AdvancedConcepts::Button>(buttons->createShared(faces->intern(name, text)));
+    }
+
+    std::unique_ptr<AdvancedConcepts::TextField> createTextField(const std::string& name,
+                                                                 const std::string& placeholder) override {
+        return std::unique_ptr<AdvancedConcepts::TextField>(
+            textFields->createShared(faces->intern(name, placeholder)));
+    }
+
+    ThemedButton* acquireButton(std::string_view name, std::string_view text) {
+        return buttons->create(faces->intern(name, text));
+    }
+
+    ThemedTextField* acquireTextField(std::string_view name, std::string_view placeholder) {
+        return textFields->create(faces->intern(name, placeholder));
+    }
+
+    // Foreign, handed-out or already released pointers are ignored
+    void release(AdvancedConcepts::Button* button) {
+        if (buttons->owns(button)) buttons->destroy(static_cast<ThemedButton*>(button));
+    }
+    void release(AdvancedConcepts::TextField* field) {
+        if (textFields->owns(field)) textFields->destroy(static_cast<ThemedTextField*>(field));
+    }
+
+    std::string getPlatformName() const override { return faces->getTheme().platform; }
+    size_t liveComponents() const { return buttons->live() + textFields->live(); }
+};
+
+// ======================= DEMONSTRATION FUNCTION =======================
+inline void demonstrateFlyweight() {
+    std::cout << "\n===== FLYWEIGHT PATTERN DEMO =====\n" << std::endl;
+
+    std::cout << "1. Shared themes for GUI factory products:" << std::endl;
+    FlyweightGUIFactory windows(PlatformTheme::windows());
+    FlyweightGUIFactory mac(PlatformTheme::mac());
+    windows.acquireButton("Save")->render();
+    Checkbox* box = mac.acquireCheckbox();
+    box->toggle();
+    box->render();
+
+    std::cout << "\n2. Shared themes for UI components:" << std::endl;
+    FlyweightUIFactory ui(PlatformTheme::windows());
+    ui.acquireButton("submitBtn", "Submit")->render();
+    ui.acquireTextField("nameField", "Enter your name")->render();
+
+    std::cout << "\n3. Drop-in for existing UIFactory clients:" << std::endl;
+    AdvancedConcepts::Application app(std::make_unique<FlyweightUIFactory>(PlatformTheme::mac()));
+    app.createUI();
+    app.renderUI();
+
+    std::cout << "\nsizeof(WindowsButton) [abstraction.hpp]: " << sizeof(AdvancedConcepts::WindowsButton)
+              << " bytes, sizeof(ThemedButton): " << sizeof(ThemedButton) << " bytes" << std::endl;
+}
+
+#endif // FLYWEIGHT_HPP
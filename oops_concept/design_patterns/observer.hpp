@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <memory>
 #include <functional>
+#include <map>
+#include "../other_concepts/trace.hpp"
 
 /**
  * OBSERVER DESIGN PATTERN
@@ -33,26 +35,26 @@ public:
     
     void attach(Observer* observer) {
         observers.push_back(observer);
-        std::cout << "Observer " << observer->getName() << " attached" << std::endl;
+        OOPS_TRACE(Info, Observer, "Observer ", observer->getName(), " attached");
     }
     
     void detach(Observer* observer) {
         auto it = std::find(observers.begin(), observers.end(), observer);
         if (it != observers.end()) {
-            std::cout << "Observer " << observer->getName() << " detached" << std::endl;
+            OOPS_TRACE(Info, Observer, "Observer ", observer->getName(), " detached");
             observers.erase(it);
         }
     }
     
     void notify() {
-        std::cout << "Notifying " << observers.size() << " observers..." << std::endl;
+        OOPS_TRACE(Info, Observer, "Notifying ", observers.size(), " observers...");
         for (auto* observer : observers) {
             observer->update(state);
         }
     }
     
     void setState(const std::string& newState) {
-        std::cout << "Subject state changed to: " << newState << std::endl;
+        OOPS_TRACE(Info, Observer, "Subject state changed to: ", newState);
         state = newState;
         notify();
     }
@@ -71,7 +73,7 @@ public:
     EmailNotifier(const std::string& emailAddr) : email(emailAddr) {}
     
     void update(const std::string& message) override {
-        std::cout << "📧 Email sent to " << email << ": " << message << std::endl;
+        OOPS_TRACE(Info, Observer, "📧 Email sent to ", email, ": ", message);
     }
     
     std::string getName() const override {
@@ -87,7 +89,7 @@ public:
     SMSNotifier(const std::string& phone) : phoneNumber(phone) {}
     
     void update(const std::string& message) override {
-        std::cout << "📱 SMS sent to " << phoneNumber << ": " << message << std::endl;
+        OOPS_TRACE(Info, Observer, "📱 SMS sent to ", phoneNumber, ": ", message);
     }
     
     std::string getName() const override {
@@ -103,7 +105,7 @@ public:
     PushNotifier(const std::string& device) : deviceId(device) {}
     
     void update(const std::string& message) override {
-        std::cout << "🔔 Push notification to " << deviceId << ": " << message << std::endl;
+        OOPS_TRACE(Info, Observer, "🔔 Push notification to ", deviceId, ": ", message);
     }
     
     std::string getName() const override {
@@ -135,7 +137,7 @@ public:
     NewsChannel(const std::string& name) : channelName(name) {}
     
     void update(const std::string& message) override {
-        std::cout << "📺 " << channelName << " broadcasting: " << message << std::endl;
+        OOPS_TRACE(Info, Observer, "📺 ", channelName, " broadcasting: ", message);
     }
     
     std::string getName() const override {
@@ -195,7 +197,7 @@ public:
     StockDisplay(const std::string& name) : displayName(name) {}
     
     void update(const std::string& message) override {
-        std::cout << "📊 " << displayName << " updated: " << message << std::endl;
+        OOPS_TRACE(Info, Observer, "📊 ", displayName, " updated: ", message);
     }
     
     std::string getName() const override {
@@ -264,7 +266,7 @@ public:
             case EventType::PAYMENT_SUCCESS: eventName = "PAYMENT_SUCCESS"; break;
         }
         
-        std::cout << "🎯 Event triggered: " << eventName << " with data: " << data << std::endl;
+        OOPS_TRACE(Info, Observer, "🎯 Event triggered: ", eventName, " with data: ", data);
         
         auto it = listeners.find(type);
         if (it != listeners.end()) {
@@ -15,8 +15,9 @@
 // ======================= CLASSIC SINGLETON =======================
 class DatabaseConnection {
 private:
-    static DatabaseConnection* instance;
-    static std::mutex mutex_;
+    // inline (C++17) so the definitions can live in the header
+    static inline DatabaseConnection* instance = nullptr;
+    static inline std::mutex mutex_;
     std::string connection_string;
     
     // Private constructor prevents external instantiation
@@ -52,10 +53,6 @@ public:
     }
 };
 
-// Static member definitions
-DatabaseConnection* DatabaseConnection::instance = nullptr;
-std::mutex DatabaseConnection::mutex_;
-
 // ======================= MODERN C++ SINGLETON (RECOMMENDED) =======================
 class Logger {
 private:
@@ -6,6 +6,8 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <chrono>
+#include "../other_concepts/trace.hpp"
 
 /**
  * STRATEGY DESIGN PATTERN
@@ -167,7 +169,7 @@ template<typename T>
 class BubbleSort : public SortStrategy<T> {
 public:
     void sort(std::vector<T>& data) override {
-        std::cout << "Performing Bubble Sort..." << std::endl;
+        OOPS_TRACE(Info, Sort, "Performing Bubble Sort...");
         size_t n = data.size();
         for (size_t i = 0; i < n - 1; i++) {
             for (size_t j = 0; j < n - i - 1; j++) {
@@ -210,7 +212,7 @@ private:
     
 public:
     void sort(std::vector<T>& data) override {
-        std::cout << "Performing Quick Sort..." << std::endl;
+        OOPS_TRACE(Info, Sort, "Performing Quick Sort...");
         quickSortHelper(data, 0, static_cast<int>(data.size()) - 1);
     }
     
@@ -223,7 +225,7 @@ template<typename T>
 class STLSort : public SortStrategy<T> {
 public:
     void sort(std::vector<T>& data) override {
-        std::cout << "Performing STL Sort (typically IntroSort)..." << std::endl;
+        OOPS_TRACE(Info, Sort, "Performing STL Sort (typically IntroSort)...");
         std::sort(data.begin(), data.end());
     }
     
@@ -244,17 +246,17 @@ public:
     
     void performSort(std::vector<T>& data) {
         if (!strategy) {
-            std::cout << "No sorting strategy set!" << std::endl;
+            OOPS_TRACE(Error, Sort, "No sorting strategy set!");
             return;
         }
         
-        std::cout << "Using " << strategy->getAlgorithmName() << std::endl;
+        OOPS_TRACE(Info, Sort, "Using ", strategy->getAlgorithmName());
         auto start = std::chrono::high_resolution_clock::now();
         strategy->sort(data);
         auto end = std::chrono::high_resolution_clock::now();
         
         auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-        std::cout << "Sort completed in " << duration.count() << " microseconds" << std::endl;
+        OOPS_TRACE(Info, Sort, "Sort completed in ", duration.count(), " microseconds");
     }
 };
 
@@ -7,6 +7,7 @@
 #include <memory>
 #include <vector>
 #include <fstream>
+#include "trace.hpp"
 
 /**
  * EXCEPTION HANDLING IN C++
@@ -68,7 +69,7 @@ private:
     
     void logTransaction(const std::string& transaction) {
         transactionHistory.push_back(transaction);
-        std::cout << "📝 Transaction logged: " << transaction << std::endl;
+        OOPS_TRACE(Debug, Account, "📝 Transaction logged: ", transaction);
     }
     
 public:
@@ -80,8 +81,7 @@ public:
         if (initialBalance < 0) {
             throw std::invalid_argument("Initial balance cannot be negative");
         }
-        std::cout << "🏦 Safe account created: " << accountNumber 
-                  << " with balance $" << balance << std::endl;
+        OOPS_TRACE(Info, Account, "🏦 Safe account created: ", accountNumber, " with balance $", balance);
     }
     
     void deposit(double amount) {
@@ -98,9 +98,9 @@ public:
             logTransaction(transaction);
             balance = newBalance; // Only update if logging succeeds
             
-            std::cout << "✅ Deposited $" << amount << ". New balance: $" << balance << std::endl;
+            OOPS_TRACE(Info, Account, "✅ Deposited $", amount, ". New balance: $", balance);
         } catch (...) {
-            std::cout << "❌ Deposit failed for $" << amount << std::endl;
+            OOPS_TRACE(Error, Account, "❌ Deposit failed for $", amount);
             throw; // Re-throw the exception
         }
     }
@@ -122,9 +122,9 @@ public:
             logTransaction(transaction);
             balance = newBalance;
             
-            std::cout << "✅ Withdrew $" << amount << ". New balance: $" << balance << std::endl;
+            OOPS_TRACE(Info, Account, "✅ Withdrew $", amount, ". New balance: $", balance);
         } catch (...) {
-            std::cout << "❌ Withdrawal failed for $" << amount << std::endl;
+            OOPS_TRACE(Error, Account, "❌ Withdrawal failed for $", amount);
             throw;
         }
     }
@@ -139,8 +139,7 @@ public:
         }
         
         // Transaction safety: either both succeed or both fail
-        std::cout << "🔄 Starting transfer of $" << amount 
-                  << " to account " << toAccount.accountNumber << std::endl;
+        OOPS_TRACE(Info, Account, "🔄 Starting transfer of $", amount, " to account ", toAccount.accountNumber);
         
         try {
             // Withdraw from this account
@@ -149,15 +148,15 @@ public:
             try {
                 // Deposit to target account
                 toAccount.deposit(amount);
-                std::cout << "✅ Transfer completed successfully" << std::endl;
+                OOPS_TRACE(Info, Account, "✅ Transfer completed successfully");
             } catch (...) {
                 // Rollback: deposit back to this account
-                std::cout << "🔄 Rolling back transfer..." << std::endl;
+                OOPS_TRACE(Info, Account, "🔄 Rolling back transfer...");
                 this->deposit(amount);
                 throw; // Re-throw the original exception
             }
         } catch (...) {
-            std::cout << "❌ Transfer failed" << std::endl;
+            OOPS_TRACE(Error, Account, "❌ Transfer failed");
             throw;
         }
     }
@@ -286,7 +285,7 @@ public:
 };
 
 // ======================= NESTED TRY-CATCH EXAMPLE =======================
-void processComplexOperation() {
+inline void processComplexOperation() {
     std::cout << "\n--- NESTED EXCEPTION HANDLING ---" << std::endl;
     
     try {
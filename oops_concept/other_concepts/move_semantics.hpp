@@ -1,11 +1,13 @@
 #ifndef MOVE_SEMANTICS_HPP
 #define MOVE_SEMANTICS_HPP
 
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <memory>
 #include <utility>
+#include "trace.hpp"
 
 /**
  * MOVE SEMANTICS IN C++11/14/17
@@ -25,7 +27,7 @@ private:
 public:
     // Default constructor
     MyString() : data(nullptr), size(0) {
-        std::cout << "🔧 MyString default constructor" << std::endl;
+        OOPS_TRACE(Debug, Memory, "🔧 MyString default constructor");
     }
     
     // Constructor with C-string
@@ -34,11 +36,11 @@ public:
             size = strlen(str);
             data = new char[size + 1];
             strcpy(data, str);
-            std::cout << "🔧 MyString constructor: \"" << data << "\"" << std::endl;
+            OOPS_TRACE(Debug, Memory, "🔧 MyString constructor: \"", data, "\"");
         } else {
             data = nullptr;
             size = 0;
-            std::cout << "🔧 MyString constructor: null" << std::endl;
+            OOPS_TRACE(Debug, Memory, "🔧 MyString constructor: null");
         }
     }
     
@@ -48,10 +50,10 @@ public:
         if (other.data) {
             data = new char[size + 1];
             strcpy(data, other.data);
-            std::cout << "📋 MyString copy constructor: \"" << data << "\"" << std::endl;
+            OOPS_TRACE(Debug, Memory, "📋 MyString copy constructor: \"", data, "\"");
         } else {
             data = nullptr;
-            std::cout << "📋 MyString copy constructor: null" << std::endl;
+            OOPS_TRACE(Debug, Memory, "📋 MyString copy constructor: null");
         }
     }
     
@@ -64,12 +66,12 @@ public:
         other.data = nullptr;
         other.size = 0;
         
-        std::cout << "🚀 MyString move constructor: \"" << (data ? data : "null") << "\"" << std::endl;
+        OOPS_TRACE(Debug, Memory, "🚀 MyString move constructor: \"", (data ? data : "null"), "\"");
     }
     
     // Copy assignment operator
     MyString& operator=(const MyString& other) {
-        std::cout << "📋 MyString copy assignment" << std::endl;
+        OOPS_TRACE(Debug, Memory, "📋 MyString copy assignment");
         
         if (this != &other) {
             // Clean up current resource
@@ -89,7 +91,7 @@ public:
     
     // Move assignment operator (C++11)
     MyString& operator=(MyString&& other) noexcept {
-        std::cout << "🚀 MyString move assignment" << std::endl;
+        OOPS_TRACE(Debug, Memory, "🚀 MyString move assignment");
         
         if (this != &other) {
             // Clean up current resource
@@ -109,9 +111,9 @@ public:
     // Destructor
     ~MyString() {
         if (data) {
-            std::cout << "🗑️  MyString destructor: \"" << data << "\"" << std::endl;
+            OOPS_TRACE(Debug, Memory, "🗑️  MyString destructor: \"", data, "\"");
         } else {
-            std::cout << "🗑️  MyString destructor: null" << std::endl;
+            OOPS_TRACE(Debug, Memory, "🗑️  MyString destructor: null");
         }
         delete[] data;
     }
@@ -127,7 +129,7 @@ public:
 };
 
 // ======================= RVALUE REFERENCE EXAMPLES =======================
-void demonstrateRvalueReferences() {
+inline void demonstrateRvalueReferences() {
     std::cout << "\n--- RVALUE REFERENCES ---" << std::endl;
     
     std::cout << "1. Lvalue vs Rvalue references:" << std::endl;
@@ -151,29 +153,29 @@ void demonstrateRvalueReferences() {
 }
 
 // ======================= PERFECT FORWARDING =======================
-template<typename T>
-void processValue(T&& value) {
-    std::cout << "Processing value: " << value << std::endl;
-    
-    // Perfect forwarding to another function
-    processValueHelper(std::forward<T>(value));
-}
-
-void processValueHelper(int& value) {
+inline void processValueHelper(int& value) {
     std::cout << "  -> Processing lvalue reference: " << value << std::endl;
     value += 10; // Can modify lvalue
 }
 
-void processValueHelper(const int& value) {
+inline void processValueHelper(const int& value) {
     std::cout << "  -> Processing const lvalue reference: " << value << std::endl;
 }
 
-void processValueHelper(int&& value) {
+inline void processValueHelper(int&& value) {
     std::cout << "  -> Processing rvalue reference: " << value << std::endl;
     value += 20; // Can modify rvalue
 }
 
-void demonstratePerfectForwarding() {
+template<typename T>
+void processValue(T&& value) {
+    std::cout << "Processing value: " << value << std::endl;
+    
+    // Perfect forwarding to another function
+    processValueHelper(std::forward<T>(value));
+}
+
+inline void demonstratePerfectForwarding() {
     std::cout << "\n--- PERFECT FORWARDING ---" << std::endl;
     
     int lvalue = 42;
@@ -197,24 +199,24 @@ void demonstratePerfectForwarding() {
 // ======================= MOVE SEMANTICS IN CONTAINERS =======================
 class BigObject {
 private:
-    std::vector<int> data;
     std::string name;
+    std::vector<int> data;
     
 public:
     BigObject(const std::string& n, size_t size) : name(n), data(size) {
         std::fill(data.begin(), data.end(), 42);
-        std::cout << "🔧 BigObject created: " << name << " (size: " << size << ")" << std::endl;
+        OOPS_TRACE(Debug, Memory, "🔧 BigObject created: ", name, " (size: ", size, ")");
     }
     
     // Copy constructor
     BigObject(const BigObject& other) : name(other.name + "_copy"), data(other.data) {
-        std::cout << "📋 BigObject copied: " << name << " (size: " << data.size() << ")" << std::endl;
+        OOPS_TRACE(Debug, Memory, "📋 BigObject copied: ", name, " (size: ", data.size(), ")");
     }
     
     // Move constructor
     BigObject(BigObject&& other) noexcept 
         : name(std::move(other.name)), data(std::move(other.data)) {
-        std::cout << "🚀 BigObject moved: " << name << " (size: " << data.size() << ")" << std::endl;
+        OOPS_TRACE(Debug, Memory, "🚀 BigObject moved: ", name, " (size: ", data.size(), ")");
         other.name = "moved_from";
     }
     
@@ -223,7 +225,7 @@ public:
         if (this != &other) {
             name = other.name + "_assigned";
             data = other.data;
-            std::cout << "📋 BigObject copy assigned: " << name << std::endl;
+            OOPS_TRACE(Debug, Memory, "📋 BigObject copy assigned: ", name);
         }
         return *this;
     }
@@ -233,21 +235,21 @@ public:
         if (this != &other) {
             name = std::move(other.name);
             data = std::move(other.data);
-            std::cout << "🚀 BigObject move assigned: " << name << std::endl;
+            OOPS_TRACE(Debug, Memory, "🚀 BigObject move assigned: ", name);
             other.name = "moved_from";
         }
         return *this;
     }
     
     ~BigObject() {
-        std::cout << "🗑️  BigObject destroyed: " << name << std::endl;
+        OOPS_TRACE(Debug, Memory, "🗑️  BigObject destroyed: ", name);
     }
     
     const std::string& getName() const { return name; }
     size_t size() const { return data.size(); }
 };
 
-void demonstrateContainerMoveSemantics() {
+inline void demonstrateContainerMoveSemantics() {
     std::cout << "\n--- MOVE SEMANTICS IN CONTAINERS ---" << std::endl;
     
     std::cout << "1. Vector with move semantics:" << std::endl;
@@ -272,19 +274,19 @@ void demonstrateContainerMoveSemantics() {
 }
 
 // ======================= RETURN VALUE OPTIMIZATION =======================
-MyString createString(const std::string& content) {
+inline MyString createString(const std::string& content) {
     std::cout << "Creating string in function" << std::endl;
     return MyString(content.c_str()); // RVO/NRVO may optimize this
 }
 
-BigObject createBigObject(const std::string& name, size_t size) {
+inline BigObject createBigObject(const std::string& name, size_t size) {
     std::cout << "Creating big object in function" << std::endl;
     BigObject obj(name, size);
     // Some processing...
     return obj; // NRVO (Named Return Value Optimization)
 }
 
-void demonstrateRVO() {
+inline void demonstrateRVO() {
     std::cout << "\n--- RETURN VALUE OPTIMIZATION ---" << std::endl;
     
     std::cout << "1. RVO example:" << std::endl;
@@ -307,7 +309,7 @@ public:
     // Constructor
     MoveOnlyResource(const std::string& n, size_t s) 
         : data(std::make_unique<int[]>(s)), size(s), name(n) {
-        std::cout << "🔧 MoveOnlyResource created: " << name << std::endl;
+        OOPS_TRACE(Debug, Memory, "🔧 MoveOnlyResource created: ", name);
     }
     
     // Delete copy constructor and copy assignment
@@ -318,7 +320,7 @@ public:
     MoveOnlyResource(MoveOnlyResource&& other) noexcept
         : data(std::move(other.data)), size(other.size), name(std::move(other.name)) {
         other.size = 0;
-        std::cout << "🚀 MoveOnlyResource moved: " << name << std::endl;
+        OOPS_TRACE(Debug, Memory, "🚀 MoveOnlyResource moved: ", name);
     }
     
     // Move assignment
@@ -328,13 +330,13 @@ public:
             size = other.size;
             name = std::move(other.name);
             other.size = 0;
-            std::cout << "🚀 MoveOnlyResource move assigned: " << name << std::endl;
+            OOPS_TRACE(Debug, Memory, "🚀 MoveOnlyResource move assigned: ", name);
         }
         return *this;
     }
     
     ~MoveOnlyResource() {
-        std::cout << "🗑️  MoveOnlyResource destroyed: " << name << std::endl;
+        OOPS_TRACE(Debug, Memory, "🗑️  MoveOnlyResource destroyed: ", name);
     }
     
     const std::string& getName() const { return name; }
@@ -342,7 +344,7 @@ public:
     bool isValid() const { return data != nullptr; }
 };
 
-void demonstrateMoveOnlyTypes() {
+inline void demonstrateMoveOnlyTypes() {
     std::cout << "\n--- MOVE-ONLY TYPES ---" << std::endl;
     
     std::cout << "1. Creating move-only resource:" << std::endl;
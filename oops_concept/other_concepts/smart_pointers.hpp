@@ -38,7 +38,7 @@ public:
 };
 
 // ======================= UNIQUE_PTR EXAMPLES =======================
-void demonstrateUniquePtr() {
+inline void demonstrateUniquePtr() {
     std::cout << "\n--- UNIQUE_PTR EXAMPLES ---" << std::endl;
     
     // Basic unique_ptr usage
@@ -80,7 +80,7 @@ void demonstrateUniquePtr() {
 } // All resources automatically cleaned up here
 
 // ======================= SHARED_PTR EXAMPLES =======================
-void demonstrateSharedPtr() {
+inline void demonstrateSharedPtr() {
     std::cout << "\n--- SHARED_PTR EXAMPLES ---" << std::endl;
     
     // Basic shared_ptr usage
@@ -135,7 +135,7 @@ public:
     }
 };
 
-void demonstrateWeakPtr() {
+inline void demonstrateWeakPtr() {
     std::cout << "\n--- WEAK_PTR EXAMPLES ---" << std::endl;
     
     std::cout << "1. Breaking circular dependencies:" << std::endl;
@@ -176,7 +176,7 @@ void demonstrateWeakPtr() {
 }
 
 // ======================= COMPARISON WITH RAW POINTERS =======================
-void demonstrateRawVsSmart() {
+inline void demonstrateRawVsSmart() {
     std::cout << "\n--- RAW vs SMART POINTERS COMPARISON ---" << std::endl;
     
     std::cout << "1. Raw pointer problems:" << std::endl;
@@ -275,7 +275,7 @@ public:
     }
 };
 
-void demonstrateSmartPointerFactory() {
+inline void demonstrateSmartPointerFactory() {
     std::cout << "\n--- SMART POINTER FACTORY PATTERN ---" << std::endl;
     
     // unique_ptr factory
@@ -0,0 +1,188 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+/**
+ * ===============================================
+ * TRACE - COMPILE-TIME REMOVABLE DIAGNOSTIC OUTPUT
+ * ===============================================
+ *
+ * Methods such as deposit(), notify() and the MyString special members used
+ * to print with "std::cout << ... << std::endl": one flush and one trip
+ * through the stream lock per call, even in a tight loop. They now call
+ * OOPS_TRACE(level, category, parts...) instead.
+ *
+ *   Compile time   OOPS_TRACE_LEVEL (0 off .. 3 debug) and the
+ *                  OOPS_TRACE_CATEGORIES bit mask are constexpr. A
+ *                  disabled trace is an "if constexpr (false)": its
+ *                  arguments are never evaluated and no code is emitted.
+ *   Run time       Enabled traces go to Trace::Sink, either Unbuffered
+ *                  (default: each line written and flushed at once, the
+ *                  old behaviour) or Buffered (lines collect in a
+ *                  per-thread buffer and are written in large blocks).
+ *
+ * Both settings must be the same in every translation unit of a program,
+ * like any other macro that changes inline functions.
+ *
+ * INTERVIEW QUESTIONS COVERED:
+ * 1. Why is logging with std::endl slow?
+ * 2. How do you make disabled logging cost nothing?
+ * 3. Why buffer per thread instead of behind one lock?
+ */
+
+// Highest level that is compiled in: 0 = Off, 1 = Error, 2 = Info, 3 = Debug
+#ifndef OOPS_TRACE_LEVEL
+#define OOPS_TRACE_LEVEL 3
+#endif
+
+// Categories that are compiled in, as a mask of Trace::Category bits
+#ifndef OOPS_TRACE_CATEGORIES
+#define OOPS_TRACE_CATEGORIES 0xFFFFFFFFu
+#endif
+
+namespace Trace {
+
+enum class Level : int {
+    Off = 0,
+    Error = 1,
+    Info = 2,
+    Debug = 3
+};
+
+enum class Category : uint32_t {
+    Account = 1u << 0,   // BankAccount, SafeBankAccount
+    Observer = 1u << 1,  // Subject, observers, EventSystem
+    Memory = 1u << 2,    // Special members of MyString, BigObject, MoveOnlyResource
+    Sort = 1u << 3,      // Sort strategies
+    Employee = 1u << 4,  // Employee mutators
+    Lifecycle = 1u << 5, // Constructor/destructor prints of Shape, Vehicle and Counter demos
+    Database = 1u << 6,  // DatabaseConnection::executeQuery
+    Sprite = 1u << 7     // GameSprite movement
+};
+
+constexpr int compiledLevel = OOPS_TRACE_LEVEL;
+constexpr uint32_t compiledCategories = OOPS_TRACE_CATEGORIES;
+
+constexpr bool isEnabled(Level level, Category category) {
+    return static_cast<int>(level) <= compiledLevel &&
+           (static_cast<uint32_t>(category) & compiledCategories) != 0;
+}
+
+enum class Mode {
+    Unbuffered,  // Write and flush every line
+    Buffered     // Collect lines per thread, write when the buffer fills
+};
+
+// ======================= SINK =======================
+class Sink {
+private:
+    // One per thread; whatever is left is written when the thread exits
+    struct ThreadBuffer {
+        std::ostringstream text;
+        ~ThreadBuffer() { Sink::instance().flush(*this); }
+    };
+
+    std::mutex mutex_;
+    std::ostream* output = &std::cout;
+    Mode mode = Mode::Unbuffered;
+    size_t capacity = 64 * 1024;
+
+    Sink() = default;
+
+    static ThreadBuffer& threadBuffer() {
+        instance();  // Constructed first, so it is destroyed after every ThreadBuffer
+        thread_local ThreadBuffer buffer;
+        return buffer;
+    }
+
+    void flush(ThreadBuffer& buffer) {
+        std::string pending = buffer.text.str();
+        if (pending.empty()) return;
+        buffer.text.str(std::string());
+        std::lock_guard<std::mutex> lock(mutex_);
+        output->write(pending.data(), static_cast<std::streamsize>(pending.size()));
+        output->flush();
+    }
+
+public:
+    Sink(const Sink&) = delete;
+    Sink& operator=(const Sink&) = delete;
+
+    static Sink& instance() {
+        static Sink sink;
+        return sink;
+    }
+
+    // Set these before other threads start tracing
+    void setMode(Mode newMode) {
+        flush();
+        mode = newMode;
+    }
+
+    void setOutput(std::ostream& stream) {
+        flush();
+        output = &stream;
+    }
+
+    void setBufferCapacity(size_t bytes) { capacity = bytes; }
+
+    Mode getMode() const { return mode; }
+
+    // Writes the calling thread's buffered lines
+    void flush() { flush(threadBuffer()); }
+
+    // Formats the parts like "std::cout << a << b ..." followed by a newline.
+    // Never throws: a line that cannot be written is dropped.
+    template<typename... Parts>
+    void write(const Parts&... parts) noexcept {
+        try {
+            if (mode == Mode::Unbuffered) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                (*output << ... << parts) << std::endl;
+                return;
+            }
+            ThreadBuffer& buffer = threadBuffer();
+            (buffer.text << ... << parts) << '\n';
+            if (static_cast<size_t>(buffer.text.tellp()) >= capacity) flush(buffer);
+        } catch (...) {
+        }
+    }
+};
+
+} // namespace Trace
+
+// Parts are only evaluated when the level and category are compiled in
+#define OOPS_TRACE(level, category, ...)                                                        \
+    do {                                                                                        \
+        if constexpr (Trace::isEnabled(Trace::Level::level, Trace::Category::category)) {       \
+            Trace::Sink::instance().write(__VA_ARGS__);                                         \
+        }                                                                                       \
+    } while (0)
+
+/**
+ * ===============================================
+ * INTERVIEW QUESTIONS AND ANSWERS
+ * ===============================================
+ *
+ * Q1: Why is logging with std::endl slow?
+ * A1: std::endl flushes, so every line becomes a write system call, and
+ *     threads sharing std::cout take turns on its lock. In a loop the
+ *     logging costs far more than the work being logged.
+ *
+ * Q2: How do you make disabled logging cost nothing?
+ * A2: Decide at compile time. A macro wrapping "if constexpr" on a constant
+ *     level drops the whole statement, including the evaluation of its
+ *     arguments; a runtime check would still build the strings.
+ *
+ * Q3: Why buffer per thread instead of behind one lock?
+ * A3: Appending to a thread_local buffer needs no synchronisation; the lock
+ *     is taken once per block instead of once per line, and lines from
+ *     different threads never interleave mid-line.
+ */
+
+#endif // TRACE_HPP
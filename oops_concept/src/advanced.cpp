@@ -0,0 +1,17 @@
+// Compiles every advanced/ header once
+#include "oops_core.hpp"
+#include "advanced/abstraction.hpp"
+#include "advanced/document_codec.hpp"
+#include "advanced/document_sort.hpp"
+#include "advanced/document_store.hpp"
+#include "advanced/inverted_index.hpp"
+#include "advanced/query_cache.hpp"
+#include "advanced/retained_ui.hpp"
+
+namespace OopsCore {
+
+void runAdvancedDemos() {
+    demonstrateAbstraction();
+}
+
+} // namespace OopsCore
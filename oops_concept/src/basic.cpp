@@ -0,0 +1,27 @@
+// Compiles every basic/ header once; the library build fails if one of them
+// stops being self-contained.
+#include "oops_core.hpp"
+#include "basic/account_store.hpp"
+#include "basic/class_object.hpp"
+#include "basic/complex_array.hpp"
+#include "basic/employee_directory.hpp"
+#include "basic/encapsulation.hpp"
+#include "basic/inheritance.hpp"
+#include "basic/instance_counter.hpp"
+#include "basic/payroll.hpp"
+#include "basic/polymorphism.hpp"
+#include "basic/shape_buckets.hpp"
+#include "basic/skill_set.hpp"
+#include "basic/sprite_world.hpp"
+#include "basic/vehicle_inventory.hpp"
+
+namespace OopsCore {
+
+void runBasicDemos() {
+    demonstrateClassObject();
+    BasicConcepts::demonstrateEncapsulation();
+    demonstrateInheritance();
+    demonstratePolymorphism();
+}
+
+} // namespace OopsCore
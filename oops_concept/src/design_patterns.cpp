@@ -0,0 +1,21 @@
+// Compiles every design_patterns/ header once
+#include "oops_core.hpp"
+#include "design_patterns/adapter_decorator.hpp"
+#include "design_patterns/factory.hpp"
+#include "design_patterns/flyweight.hpp"
+#include "design_patterns/observer.hpp"
+#include "design_patterns/singleton.hpp"
+#include "design_patterns/strategy.hpp"
+
+namespace OopsCore {
+
+void runDesignPatternDemos() {
+    demonstrateSingleton();
+    demonstrateFactory();
+    demonstrateObserver();
+    demonstrateStrategy();
+    demonstrateAdapterDecorator();
+    demonstrateFlyweight();
+}
+
+} // namespace OopsCore
@@ -0,0 +1,25 @@
+#ifndef OOPS_CORE_HPP
+#define OOPS_CORE_HPP
+
+/**
+ * ===============================================
+ * OOPS_CORE - COMPILED ENTRY POINTS
+ * ===============================================
+ *
+ * The concept headers stay header-only: every static member and free
+ * function in them is inline, so any number of translation units may
+ * include them. The oops_core library compiles each module once (one .cpp
+ * per directory) and exposes these functions, so a program that only
+ * wants the demonstrations links them instead of recompiling the headers.
+ */
+
+namespace OopsCore {
+
+void runBasicDemos();          // basic/: classes, encapsulation, inheritance, polymorphism
+void runAdvancedDemos();       // advanced/: abstraction
+void runDesignPatternDemos();  // design_patterns/: singleton, factory, observer, ...
+void runOtherConceptDemos();   // other_concepts/: exceptions, move semantics
+
+} // namespace OopsCore
+
+#endif // OOPS_CORE_HPP
@@ -0,0 +1,36 @@
+// Links oops_core and includes the same headers again, so a non-inline
+// definition left in any of them shows up as a "multiple definition" link
+// error here.
+#include "oops_core.hpp"
+#include "basic/class_object.hpp"
+#include "basic/encapsulation.hpp"
+#include "basic/inheritance.hpp"
+#include "basic/polymorphism.hpp"
+#include "advanced/abstraction.hpp"
+#include "design_patterns/factory.hpp"
+#include "design_patterns/singleton.hpp"
+#include "other_concepts/exception_handling.hpp"
+#include "other_concepts/move_semantics.hpp"
+#include <iostream>
+
+int main() {
+    std::cout << "🎯 OOPS_CORE - ALL MODULE DEMONSTRATIONS\n" << std::endl;
+    try {
+        OopsCore::runBasicDemos();
+        OopsCore::runAdvancedDemos();
+        OopsCore::runDesignPatternDemos();
+        OopsCore::runOtherConceptDemos();
+
+        // The same statics seen from this TU and from the library's
+        BasicConcepts::Counter counter;
+        DatabaseConnection* connection = DatabaseConnection::getInstance();
+        std::cout << "\nCounters created: " << BasicConcepts::Counter::getTotalObjects()
+                  << ", database singleton shared: " << (connection == DatabaseConnection::getInstance() ? "Yes" : "No")
+                  << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    std::cout << "\n✅ oops_core demonstrations completed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,23 @@
+// Precompiled header for oops_core and the test programs: the standard
+// headers nearly every concept header pulls in. Project headers are left
+// out so each test still only sees the classes it includes.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
@@ -0,0 +1,16 @@
+// Compiles the other_concepts/ headers once. smart_pointers.hpp is left out:
+// its global Shape/Circle/Rectangle/ShapeFactory differ from the ones in
+// design_patterns/factory.hpp, and two different classes with one name in
+// the same program break the one-definition rule.
+#include "oops_core.hpp"
+#include "other_concepts/exception_handling.hpp"
+#include "other_concepts/move_semantics.hpp"
+
+namespace OopsCore {
+
+void runOtherConceptDemos() {
+    demonstrateExceptionHandling();
+    demonstrateMoveSemantics();
+}
+
+} // namespace OopsCore
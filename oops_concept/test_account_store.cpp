@@ -0,0 +1,154 @@
+#include "basic/account_store.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::string accountNumber(size_t i) {
+    std::string digits = std::to_string(i);
+    return std::string(10 - std::min<size_t>(10, digits.size()), '0') + digits;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Sharded Account Store\n" << std::endl;
+
+    try {
+        size_t totalOps = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 400000;
+        using BasicConcepts::AccountOpStatus;
+        BasicConcepts::AccountStore store;
+
+        // 1. Single operations
+        std::cout << "1. Single Operations:" << std::endl;
+        store.openAccount("Alice Johnson", "1234567890", "1234", 1000.0);
+        store.deposit("1234567890", 500.0);
+        AccountOpStatus status = store.withdraw("1234567890", 5000.0, "1234");
+        std::cout << "Overdraft rejected: " << (status == AccountOpStatus::InsufficientFunds ? "Yes" : "No") << std::endl;
+        std::cout << "Balance of " << store.getHolder("1234567890") << ": $"
+                  << store.getBalance("1234567890", "1234") << std::endl;
+        status = store.withdraw("1234567890", 100.0, "9999");
+        std::cout << "Wrong PIN rejected: " << (status == AccountOpStatus::InvalidPin ? "Yes" : "No") << std::endl;
+        bool balanceLocked = false;
+        try {
+            store.getBalance("1234567890", "9999");
+        } catch (const std::runtime_error&) {
+            balanceLocked = true;
+        }
+        if (status != AccountOpStatus::InvalidPin || !balanceLocked ||
+            store.getBalance("1234567890", "1234") != 1500.0) {
+            throw std::runtime_error("PIN is not enforced");
+        }
+        store.setActive("1234567890", false);
+        if (store.deposit("1234567890", 1.0) != AccountOpStatus::AccountInactive) {
+            throw std::runtime_error("single-operation results are wrong");
+        }
+        store.setActive("1234567890", true);
+        if (store.getBalance("1234567890", "1234") != 1500.0) {
+            throw std::runtime_error("single-operation results are wrong");
+        }
+        try {
+            store.openAccount("Bob", "123", "1234");
+        } catch (const std::invalid_argument& e) {
+            std::cout << "Validation: " << e.what() << std::endl;
+        }
+
+        // 2. Concurrent correctness
+        std::cout << "\n2. Concurrent Deposits and Withdrawals:" << std::endl;
+        const size_t accounts = 10000;
+        for (size_t i = 0; i < accounts; ++i) {
+            store.openAccount("Holder", accountNumber(i), "0000", 100.0);
+        }
+        BasicConcepts::ShardStats before = store.totalStats();
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 8; ++t) {
+            workers.emplace_back([&store, t] {
+                for (int i = 0; i < 10000; ++i) {
+                    // Everyone hammers account 0: withdrawals must never overdraw it
+                    store.withdraw(accountNumber(0), 1.0, "0000");
+                    store.deposit(accountNumber(1 + (t * 10000 + i) % 9999), 0.5);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        double sum = 0;
+        for (size_t i = 1; i < accounts; ++i) sum += store.getBalance(accountNumber(i), "0000");
+        std::cout << "Hot account balance: $" << store.getBalance(accountNumber(0), "0000") << std::endl;
+        if (store.getBalance(accountNumber(0), "0000") != 0.0 || sum != 9999 * 100.0 + 8 * 10000 * 0.5) {
+            throw std::runtime_error("concurrent updates lost money");
+        }
+        // Per-thread counter stripes must add up to every operation
+        BasicConcepts::ShardStats after = store.totalStats();
+        std::cout << "Counted: " << after.deposits - before.deposits << " deposits, "
+                  << after.withdrawals - before.withdrawals << " withdrawals, "
+                  << after.rejected - before.rejected << " rejected" << std::endl;
+        if (after.deposits - before.deposits != 80000 || after.withdrawals - before.withdrawals != 100 ||
+            after.rejected - before.rejected != 79900 || after.lookups - before.lookups < 160000) {
+            throw std::runtime_error("operation counters are wrong");
+        }
+
+        // 3. Batches and per-shard statistics
+        std::cout << "\n3. Batch API:" << std::endl;
+        std::vector<BasicConcepts::AccountOp> batch;
+        for (size_t i = 0; i < 1000; ++i) batch.push_back({accountNumber(i + 1), 10.0, "0000"});
+        batch.push_back({accountNumber(1), 10.0, "1111"});
+        batch.push_back({"9999999999", 10.0, "0000"});
+        auto results = store.withdrawBatch(batch);
+        size_t ok = std::count(results.begin(), results.end(), AccountOpStatus::Ok);
+        std::cout << "Batch withdrawals applied: " << ok << "/" << batch.size() << std::endl;
+        if (ok != 1000 || results[1000] != AccountOpStatus::InvalidPin ||
+            results.back() != AccountOpStatus::NoSuchAccount) {
+            throw std::runtime_error("batch results are wrong");
+        }
+        BasicConcepts::ShardStats first = store.shardStats(0);
+        BasicConcepts::ShardStats total = store.totalStats();
+        std::cout << "Shard 0: " << first.accounts << " accounts, " << first.deposits << " deposits, "
+                  << first.withdrawals << " withdrawals" << std::endl;
+        std::cout << "All shards: " << total.accounts << " accounts, " << total.rejected << " rejected" << std::endl;
+
+        // 4. Throughput and p99 with hot-key skew (90% of ops on 1% of accounts)
+        std::cout << "\n4. Throughput, " << totalOps << " ops, 90% on 1% hot accounts:" << std::endl;
+        for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+            std::vector<std::vector<double>> latencies(threads);
+            size_t perThread = totalOps / threads;
+            auto start = std::chrono::steady_clock::now();
+            workers.clear();
+            for (unsigned t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t] {
+                    std::mt19937 rng(t + 1);
+                    std::vector<double>& samples = latencies[t];
+                    samples.reserve(perThread);
+                    for (size_t i = 0; i < perThread; ++i) {
+                        size_t key = (rng() % 10 != 0) ? rng() % (accounts / 100) : rng() % accounts;
+                        std::string number = accountNumber(key);
+                        auto opStart = std::chrono::steady_clock::now();
+                        if (i & 1) store.withdraw(number, 0.25, "0000");
+                        else store.deposit(number, 0.25);
+                        samples.push_back(std::chrono::duration<double, std::nano>(
+                            std::chrono::steady_clock::now() - opStart).count());
+                    }
+                });
+            }
+            for (auto& worker : workers) worker.join();
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::vector<double> all;
+            for (const auto& samples : latencies) all.insert(all.end(), samples.begin(), samples.end());
+            std::nth_element(all.begin(), all.begin() + all.size() * 99 / 100, all.end());
+            std::cout << "  " << threads << " threads: " << static_cast<size_t>(all.size() / seconds)
+                      << " ops/s, p99 " << all[all.size() * 99 / 100] << " ns" << std::endl;
+        }
+        std::cout << "  (hardware threads available: " << std::thread::hardware_concurrency() << ")" << std::endl;
+
+        std::cout << "\n✅ Sharded account store test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 -pthread test_account_store.cpp -o test_account_store
+// Run: ./test_account_store [total_ops]
@@ -15,17 +15,19 @@ BLUE='\033[0;34m'
 YELLOW='\033[1;33m'
 NC='\033[0m' # No Color
 
-# Function to run a test
+# Function to run a test; arguments after the name are passed to the program
+# (benchmarks get the same small sizes as in CMakeLists.txt)
 run_test() {
     local file=$1
     local name=$2
+    shift 2
     
     echo -e "${BLUE}📋 Testing: $name${NC}"
-    echo "Command: g++ -std=c++17 $file -o test && ./test"
+    echo "Command: g++ -std=c++17 $file -o test && ./test $*"
     echo "----------------------------------------"
     
     if g++ -std=c++17 "$file" -o test 2>/dev/null; then
-        if ./test; then
+        if ./test "$@"; then
             echo -e "${GREEN}✅ $name - PASSED${NC}"
             rm -f test
         else
@@ -47,20 +49,38 @@ echo -e "${YELLOW}🧪 BASIC OOP CONCEPTS${NC}"
 echo ""
 
 run_test "test_basic.cpp" "Classes and Objects"
+run_test "test_instance_counter.cpp" "Sharded Instance Counters" 20000
 run_test "test_encapsulation.cpp" "Encapsulation"
+run_test "test_bank_session.cpp" "Bank Account Sessions" 20000
+run_test "test_employee_directory.cpp" "Employee Directory" 20000
+run_test "test_skill_set.cpp" "Interned Skill Sets" 20000
+run_test "test_payroll.cpp" "Bulk Payroll" 20000
+run_test "test_account_store.cpp" "Sharded Account Store" 20000
 run_test "test_inheritance.cpp" "Inheritance"
+run_test "test_vehicle_inventory.cpp" "Columnar Vehicle Inventory" 20000
 run_test "test_polymorphism.cpp" "Polymorphism"
+run_test "test_container_policies.cpp" "Container Execution Policies" 20000
+run_test "test_complex_array.cpp" "Complex Arrays and FFT" 4096
+run_test "test_sprite_world.cpp" "Sprite World" 20000
+run_test "test_shape_buckets.cpp" "Type-Bucketed Shapes" 20000 20000
 
 echo -e "${YELLOW}🎓 ADVANCED OOP CONCEPTS${NC}"
 echo ""
 
 run_test "test_abstraction.cpp" "Abstraction"
+run_test "test_query_cache.cpp" "Prepared Statement & Result Cache" 20000
+run_test "test_document_codec.cpp" "Binary Document Codec" 20000
+run_test "test_document_store.cpp" "Memory-Mapped Document Store" 20000
+run_test "test_document_sort.cpp" "Devirtualized Document Sort" 20000
+run_test "test_inverted_index.cpp" "Full-Text Inverted Index" 20000
+run_test "test_retained_ui.cpp" "Retained-Mode UI Renderer" 20000
 
 echo -e "${YELLOW}🏗️ DESIGN PATTERNS${NC}"
 echo ""
 
 run_test "test_singleton.cpp" "Singleton Pattern"
 run_test "test_factory.cpp" "Factory Pattern"
+run_test "test_flyweight.cpp" "Flyweight UI Theming" 20000
 run_test "test_strategy.cpp" "Strategy Pattern"
 run_test "test_adapter_decorator.cpp" "Adapter & Decorator Patterns"
 run_test "test_observer.cpp" "Observer Pattern"
@@ -71,6 +91,7 @@ echo ""
 run_test "test_smart_pointers.cpp" "Smart Pointers"
 run_test "test_move_semantics.cpp" "Move Semantics"
 run_test "test_exception_handling.cpp" "Exception Handling"
+run_test "test_trace.cpp" "Trace Sink" 20000
 
 # Test comprehensive demos
 echo -e "${YELLOW}🎯 COMPREHENSIVE DEMOS${NC}"
@@ -89,16 +110,34 @@ echo -e "${BLUE}📚 INDIVIDUAL COMMANDS TO RUN EACH FILE:${NC}"
 echo ""
 echo "# Basic OOP Concepts:"
 echo "g++ -std=c++17 test_basic.cpp -o test_basic && ./test_basic"
+echo "g++ -std=c++17 -O2 -pthread test_instance_counter.cpp -o test_instance_counter && ./test_instance_counter"
 echo "g++ -std=c++17 test_encapsulation.cpp -o test_encapsulation && ./test_encapsulation"
+echo "g++ -std=c++17 -O2 test_bank_session.cpp -o test_bank_session && ./test_bank_session"
+echo "g++ -std=c++17 -O2 test_employee_directory.cpp -o test_employee_directory && ./test_employee_directory"
+echo "g++ -std=c++17 -O2 test_skill_set.cpp -o test_skill_set && ./test_skill_set"
+echo "g++ -std=c++17 -O2 test_payroll.cpp -o test_payroll && ./test_payroll"
+echo "g++ -std=c++17 -O2 -pthread test_account_store.cpp -o test_account_store && ./test_account_store"
 echo "g++ -std=c++17 test_inheritance.cpp -o test_inheritance && ./test_inheritance"
+echo "g++ -std=c++17 -O2 test_vehicle_inventory.cpp -o test_vehicle_inventory && ./test_vehicle_inventory"
 echo "g++ -std=c++17 test_polymorphism.cpp -o test_polymorphism && ./test_polymorphism"
+echo "g++ -std=c++17 -O2 -pthread test_container_policies.cpp -o test_container_policies && ./test_container_policies"
+echo "g++ -std=c++17 -O2 test_complex_array.cpp -o test_complex_array && ./test_complex_array"
+echo "g++ -std=c++17 -O2 test_sprite_world.cpp -o test_sprite_world && ./test_sprite_world"
+echo "g++ -std=c++17 -O2 test_shape_buckets.cpp -o test_shape_buckets && ./test_shape_buckets"
 echo ""
 echo "# Advanced OOP Concepts:"
 echo "g++ -std=c++17 test_abstraction.cpp -o test_abstraction && ./test_abstraction"
+echo "g++ -std=c++17 test_query_cache.cpp -o test_query_cache && ./test_query_cache"
+echo "g++ -std=c++17 test_document_codec.cpp -o test_document_codec && ./test_document_codec"
+echo "g++ -std=c++17 test_document_store.cpp -o test_document_store && ./test_document_store"
+echo "g++ -std=c++17 -pthread test_document_sort.cpp -o test_document_sort && ./test_document_sort"
+echo "g++ -std=c++17 -O2 test_inverted_index.cpp -o test_inverted_index && ./test_inverted_index"
+echo "g++ -std=c++17 test_retained_ui.cpp -o test_retained_ui && ./test_retained_ui"
 echo ""
 echo "# Design Patterns:"
 echo "g++ -std=c++17 test_singleton.cpp -o test_singleton && ./test_singleton"
 echo "g++ -std=c++17 test_factory.cpp -o test_factory && ./test_factory"
+echo "g++ -std=c++17 -O2 test_flyweight.cpp -o test_flyweight && ./test_flyweight"
 echo "g++ -std=c++17 test_strategy.cpp -o test_strategy && ./test_strategy"
 echo "g++ -std=c++17 test_adapter_decorator.cpp -o test_adapter_decorator && ./test_adapter_decorator"
 echo "g++ -std=c++17 test_observer.cpp -o test_observer && ./test_observer"
@@ -107,6 +146,8 @@ echo "# Modern C++ Features:"
 echo "g++ -std=c++17 test_smart_pointers.cpp -o test_smart_pointers && ./test_smart_pointers"
 echo "g++ -std=c++17 test_move_semantics.cpp -o test_move_semantics && ./test_move_semantics"
 echo "g++ -std=c++17 test_exception_handling.cpp -o test_exception_handling && ./test_exception_handling"
+echo "g++ -std=c++17 -O2 -pthread test_trace.cpp -o test_trace && ./test_trace"
+echo "g++ -std=c++17 -O2 -pthread -DOOPS_TRACE_LEVEL=0 test_trace.cpp -o test_trace_off && ./test_trace_off"
 echo ""
 echo "# Comprehensive Demos:"
 echo "g++ -std=c++17 main_simple_demo.cpp -o simple_demo && ./simple_demo"
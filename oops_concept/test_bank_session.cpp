@@ -0,0 +1,132 @@
+#include "basic/encapsulation.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <streambuf>
+#include <string>
+
+// Discards everything written to it, so console logging does not dominate the timings
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Bank Account Sessions\n" << std::endl;
+
+    try {
+        size_t ops = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+        BasicConcepts::BankAccount account("John Doe", "1234567890", "1234", 1000.0);
+
+        // 1. Login once, then operate with the session
+        std::cout << "1. Session Operations:" << std::endl;
+        BasicConcepts::BankAccount::Session session = account.login("1234");
+        account.deposit(250.0, session);
+        account.withdraw(100.0, session);
+        std::cout << "Balance via session: $" << account.getBalance(session) << std::endl;
+        if (account.getBalance(session) != account.getBalance("1234")) {
+            throw std::runtime_error("session and PIN paths disagree");
+        }
+
+        try {
+            account.login("0000");
+        } catch (const std::runtime_error& e) {
+            std::cout << "Bad login rejected: " << e.what() << std::endl;
+        }
+
+        // 2. Invalidation
+        std::cout << "\n2. Session Invalidation:" << std::endl;
+        account.changePin("1234", "5678");
+        std::cout << "Session valid after PIN change: " << (account.isSessionValid(session) ? "Yes" : "No") << std::endl;
+        try {
+            account.deposit(10.0, session);
+            throw std::logic_error("stale session was accepted");
+        } catch (const std::runtime_error& e) {
+            std::cout << "Stale session rejected: " << e.what() << std::endl;
+        }
+
+        BasicConcepts::BankAccount::Session fresh = account.login("5678");
+        BasicConcepts::BankAccount other("Jane Roe", "9876543210", "5678", 10.0);
+        if (other.isSessionValid(fresh)) {
+            throw std::runtime_error("a session must only work on its own account");
+        }
+        account.deactivateAccount("5678");
+        account.activateAccount("5678");
+        std::cout << "Session valid after deactivation: " << (account.isSessionValid(fresh) ? "Yes" : "No") << std::endl;
+        if (account.isSessionValid(fresh)) {
+            throw std::runtime_error("deactivation must end sessions");
+        }
+
+        // Assignment, moves and a new account at a reused address end sessions too
+        BasicConcepts::BankAccount target("Joe Bloggs", "1111111111", "1111", 100.0);
+        BasicConcepts::BankAccount::Session old = target.login("1111");
+        target = BasicConcepts::BankAccount("Eve", "9999999999", "2222", 5000.0);
+        if (target.isSessionValid(old)) {
+            throw std::runtime_error("a session must not survive assignment of another account");
+        }
+        try {
+            target.getBalance(old);
+            throw std::logic_error("session read the assigned account's balance");
+        } catch (const std::runtime_error& e) {
+            std::cout << "Session rejected after assignment: " << e.what() << std::endl;
+        }
+        BasicConcepts::BankAccount::Session eve = target.login("2222");
+        BasicConcepts::BankAccount moved(std::move(target));
+        if (target.isSessionValid(eve) || moved.isSessionValid(eve)) {
+            throw std::runtime_error("a session must not survive a move");
+        }
+
+        std::optional<BasicConcepts::BankAccount> slot;
+        slot.emplace("Joe Bloggs", "1111111111", "1111", 100.0);
+        BasicConcepts::BankAccount::Session first = slot->login("1111");
+        slot.reset();
+        slot.emplace("Eve", "9999999999", "1111", 5000.0);
+        if (slot->isSessionValid(first)) {
+            throw std::runtime_error("a session must not work on a new account at the same address");
+        }
+        std::cout << "Sessions end on assignment, move and address reuse" << std::endl;
+
+        // 3. Throughput
+        std::cout << "\n3. " << ops << " operations with and without a session:" << std::endl;
+        session = account.login("5678");
+        volatile double sink = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ops; ++i) sink = sink + account.getBalance("5678");
+        double pinReadMs = elapsedMs(start);
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ops; ++i) sink = sink + account.getBalance(session);
+        double sessionReadMs = elapsedMs(start);
+
+        NullBuffer nullBuffer;
+        std::streambuf* console = std::cout.rdbuf(&nullBuffer);
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ops / 10; ++i) account.deposit(1.0, "5678");
+        double pinDepositMs = elapsedMs(start);
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ops / 10; ++i) account.deposit(1.0, session);
+        double sessionDepositMs = elapsedMs(start);
+        std::cout.rdbuf(console);
+
+        auto rate = [](size_t n, double ms) { return static_cast<size_t>(n / (ms / 1000.0)); };
+        std::cout << "  getBalance with PIN:     " << rate(ops, pinReadMs) << " ops/s" << std::endl;
+        std::cout << "  getBalance with session: " << rate(ops, sessionReadMs) << " ops/s" << std::endl;
+        std::cout << "  deposit with PIN:        " << rate(ops / 10, pinDepositMs) << " ops/s (logging included)" << std::endl;
+        std::cout << "  deposit with session:    " << rate(ops / 10, sessionDepositMs) << " ops/s (logging included)" << std::endl;
+
+        std::cout << "\n✅ Bank account session test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_bank_session.cpp -o test_bank_session
+// Run: ./test_bank_session [operations]
@@ -0,0 +1,208 @@
+#include "basic/complex_array.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using BasicConcepts::Complex;
+using BasicConcepts::ComplexArray;
+
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static ComplexArray randomArray(size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    ComplexArray values(n);
+    for (size_t i = 0; i < n; ++i) values.set(i, Complex(dist(rng), dist(rng)));
+    return values;
+}
+
+static double maxError(const ComplexArray& a, const std::vector<Complex>& b) {
+    double worst = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        Complex d = a[i] - b[i];
+        worst = std::max(worst, std::hypot(d.getReal(), d.getImaginary()));
+    }
+    return worst;
+}
+
+// O(n^2) reference
+static std::vector<Complex> naiveDft(const std::vector<Complex>& x) {
+    const double pi = std::acos(-1.0);
+    std::vector<Complex> out(x.size());
+    for (size_t k = 0; k < x.size(); ++k) {
+        Complex sum;
+        for (size_t t = 0; t < x.size(); ++t) {
+            double angle = -2.0 * pi * static_cast<double>(k * t % x.size()) / static_cast<double>(x.size());
+            sum = sum + x[t] * Complex(std::cos(angle), std::sin(angle));
+        }
+        out[k] = sum;
+    }
+    return out;
+}
+
+// Textbook radix-2 FFT on std::vector<Complex>, twiddles computed on the fly
+static void naiveFft(std::vector<Complex>& x) {
+    const double pi = std::acos(-1.0);
+    size_t n = x.size();
+    if (n & (n - 1)) {
+        // The bit-reversal and butterflies would index past the end
+        throw std::invalid_argument("Naive FFT size must be a power of two");
+    }
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(x[i], x[j]);
+    }
+    for (size_t length = 2; length <= n; length <<= 1) {
+        for (size_t block = 0; block < n; block += length) {
+            for (size_t k = 0; k < length / 2; ++k) {
+                double angle = -2.0 * pi * static_cast<double>(k) / static_cast<double>(length);
+                Complex w(std::cos(angle), std::sin(angle));
+                Complex u = x[block + k];
+                Complex v = x[block + k + length / 2] * w;
+                x[block + k] = u + v;
+                x[block + k + length / 2] = u - v;
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Complex Arrays and FFT\n" << std::endl;
+
+    try {
+        size_t fftSize = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 65536;
+
+        // 1. Element-wise kernels agree with Complex
+        std::cout << "1. Element-wise Kernels:" << std::endl;
+        ComplexArray a = randomArray(1001, 1), b = randomArray(1001, 2), out;
+        std::vector<Complex> va = a.toComplexVector(), vb = b.toComplexVector(), expected(va.size());
+        BasicConcepts::addArrays(a, b, out);
+        for (size_t i = 0; i < va.size(); ++i) expected[i] = va[i] + vb[i];
+        double addError = maxError(out, expected);
+        BasicConcepts::multiplyArrays(a, b, out);
+        for (size_t i = 0; i < va.size(); ++i) expected[i] = va[i] * vb[i];
+        double mulError = maxError(out, expected);
+        BasicConcepts::conjMultiplyArrays(a, b, out);
+        for (size_t i = 0; i < va.size(); ++i) expected[i] = va[i] * Complex(vb[i].getReal(), -vb[i].getImaginary());
+        double conjError = maxError(out, expected);
+        std::cout << "Max error add / mul / conj-mul: " << addError << " / " << mulError << " / " << conjError << std::endl;
+        if (addError > 1e-15 || mulError > 1e-15 || conjError > 1e-15) {
+            throw std::runtime_error("kernels disagree with Complex");
+        }
+        try {
+            BasicConcepts::addArrays(a, ComplexArray(3), out);
+        } catch (const std::invalid_argument& e) {
+            std::cout << "Size mismatch rejected: " << e.what() << std::endl;
+        }
+
+        // 2. FFT against the O(n^2) DFT for every power of two up to 1024
+        std::cout << "\n2. FFT Accuracy:" << std::endl;
+        double worst = 0;
+        for (size_t n = 1; n <= 1024; n *= 2) {
+            ComplexArray x = randomArray(n, static_cast<unsigned>(n));
+            std::vector<Complex> reference = naiveDft(x.toComplexVector());
+            ComplexArray original = x;
+            BasicConcepts::fft(x);
+            worst = std::max(worst, maxError(x, reference));
+            BasicConcepts::ifft(x);
+            worst = std::max(worst, maxError(x, original.toComplexVector()));
+        }
+        std::cout << "Max error vs DFT and round trip (n = 1..1024): " << worst << std::endl;
+        if (worst > 1e-9) {
+            throw std::runtime_error("FFT is inaccurate");
+        }
+        try {
+            BasicConcepts::FFTPlan bad(1000);
+        } catch (const std::invalid_argument& e) {
+            std::cout << "Non power of two rejected: " << e.what() << std::endl;
+        }
+
+        // 3. Batch API and plan cache
+        std::cout << "\n3. Batch FFT:" << std::endl;
+        size_t plansBefore = BasicConcepts::FFTPlanCache::instance().planCount();
+        ComplexArray frames = randomArray(64 * 256, 7);
+        ComplexArray firstFrame(256);
+        for (size_t i = 0; i < 256; ++i) firstFrame.set(i, frames[i]);
+        BasicConcepts::fftBatch(frames, 256);
+        BasicConcepts::fft(firstFrame);
+        double batchError = 0;
+        for (size_t i = 0; i < 256; ++i) {
+            Complex d = frames[i] - firstFrame[i];
+            batchError = std::max(batchError, std::hypot(d.getReal(), d.getImaginary()));
+        }
+        std::cout << "64 frames of 256, plans cached: " << BasicConcepts::FFTPlanCache::instance().planCount()
+                  << " (new: " << BasicConcepts::FFTPlanCache::instance().planCount() - plansBefore << ")" << std::endl;
+        if (batchError != 0.0) {
+            throw std::runtime_error("batch and single transforms differ");
+        }
+
+        // 4. Throughput against std::vector<Complex>
+        std::cout << "\n4. Throughput:" << std::endl;
+        const size_t kernelSize = 1 << 20;
+        const int kernelReps = 50;
+        ComplexArray ka = randomArray(kernelSize, 3), kb = randomArray(kernelSize, 4), kout(kernelSize);
+        std::vector<Complex> ca = ka.toComplexVector(), cb = kb.toComplexVector(), products(kernelSize);
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < kernelReps; ++r) {
+            for (size_t i = 0; i < kernelSize; ++i) products[i] = ca[i] * cb[i];
+        }
+        double vectorSeconds = elapsedSeconds(start);
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < kernelReps; ++r) BasicConcepts::multiplyArrays(ka, kb, kout);
+        double splitSeconds = elapsedSeconds(start);
+        double kernelFlops = 6.0 * kernelSize * kernelReps;
+        std::cout << "  multiply, vector<Complex>: " << kernelFlops / vectorSeconds / 1e9 << " GFLOPS" << std::endl;
+        std::cout << "  multiply, ComplexArray:    " << kernelFlops / splitSeconds / 1e9 << " GFLOPS" << std::endl;
+        if (maxError(kout, products) != 0.0) {
+            throw std::runtime_error("benchmark results differ");
+        }
+
+        // 5 n log2 n is the conventional flop count for a complex FFT
+        double logN = std::log2(static_cast<double>(fftSize));
+        int fftReps = static_cast<int>(std::max<size_t>(1, (1 << 24) / fftSize));
+        // Each repetition restarts from the same input so magnitudes stay bounded
+        const ComplexArray source = randomArray(fftSize, 5);
+        const std::vector<Complex> naiveSource = source.toComplexVector();
+        // Fetch the plan before timing anything: a bad size fails with the
+        // library's error rather than the reference implementation's
+        auto plan = BasicConcepts::FFTPlanCache::instance().get(fftSize);
+        ComplexArray signal;
+        std::vector<Complex> naiveSignal;
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < fftReps; ++r) {
+            naiveSignal = naiveSource;
+            naiveFft(naiveSignal);
+        }
+        double naiveSeconds = elapsedSeconds(start);
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < fftReps; ++r) {
+            signal = source;
+            plan->forward(signal);
+        }
+        double planSeconds = elapsedSeconds(start);
+        double fftFlops = 5.0 * fftSize * logN * fftReps;
+        std::cout << "  FFT n=" << fftSize << ", naive radix-2 on vector<Complex>: "
+                  << fftFlops / naiveSeconds / 1e9 << " GFLOPS" << std::endl;
+        std::cout << "  FFT n=" << fftSize << ", FFTPlan on ComplexArray:          "
+                  << fftFlops / planSeconds / 1e9 << " GFLOPS" << std::endl;
+        if (maxError(signal, naiveSignal) > 1e-9 * fftSize) {
+            throw std::runtime_error("FFT results differ from the naive transform");
+        }
+
+        std::cout << "\n✅ Complex array test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_complex_array.cpp -o test_complex_array
+// Run: ./test_complex_array [fft_size]
@@ -0,0 +1,109 @@
+#include "basic/polymorphism.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+using BasicConcepts::ExecutionPolicy;
+
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static const char* policyName(ExecutionPolicy policy) {
+    switch (policy) {
+    case ExecutionPolicy::Sequential: return "Sequential ";
+    case ExecutionPolicy::Unsequenced: return "Unsequenced";
+    case ExecutionPolicy::Parallel: return "Parallel   ";
+    }
+    return "?";
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Container Execution Policies\n" << std::endl;
+
+    try {
+        size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000000;
+        const ExecutionPolicy policies[] = {ExecutionPolicy::Sequential, ExecutionPolicy::Unsequenced,
+                                            ExecutionPolicy::Parallel};
+
+        // 1. Every policy gives the same answer
+        std::cout << "1. Policies Agree:" << std::endl;
+        auto squareSum = [](const BasicConcepts::Container<int>& c, ExecutionPolicy policy) {
+            return c.transformReduce(0LL, std::plus<long long>(),
+                                     [](int x) { return static_cast<long long>(x) * x; }, policy);
+        };
+        for (size_t n : {0, 1, 7, 8, 9, 1000, 300000}) {
+            for (ExecutionPolicy policy : policies) {
+                BasicConcepts::Container<int> c;
+                for (size_t i = 0; i < n; ++i) c.add(static_cast<int>(i % 1000));
+                c.applyFunction(BasicConcepts::Functor(3), policy);
+                long long expected = 0;
+                for (size_t i = 0; i < n; ++i) expected += 9LL * (i % 1000) * (i % 1000);
+                int expectedMax = n == 0 ? INT_MIN : 3 * static_cast<int>(std::min<size_t>(n - 1, 999));
+                if (squareSum(c, policy) != expected ||
+                    c.reduce(INT_MIN, [](int a, int b) { return std::max(a, b); }, policy) != expectedMax) {
+                    throw std::runtime_error("policies disagree");
+                }
+            }
+        }
+        std::cout << "Sizes 0..300000 checked for all three policies" << std::endl;
+
+        // 2. Span access
+        std::cout << "\n2. Unchecked Span:" << std::endl;
+        BasicConcepts::Container<double> prices;
+        prices.add(9.99);
+        prices.add(24.50);
+        for (double& price : prices.span()) price *= 2;
+        std::cout << "Doubled prices: " << prices.span()[0] << ", " << prices.span()[1] << std::endl;
+        if (prices.get(1) != 49.0) {
+            throw std::runtime_error("span writes were lost");
+        }
+        try {
+            prices.get(2);
+        } catch (const std::out_of_range& e) {
+            std::cout << "get() still checks bounds: " << e.what() << std::endl;
+        }
+
+        // 3. Throughput
+        std::cout << "\n3. " << count << " elements:" << std::endl;
+        BasicConcepts::Container<int> values;
+        values.reserve(count);
+        for (size_t i = 0; i < count; ++i) values.add(static_cast<int>(i & 1023));
+
+        auto start = std::chrono::steady_clock::now();
+        long long checkedSum = 0;
+        for (size_t i = 0; i < values.size(); ++i) checkedSum += values.get(i);
+        double checkedSeconds = elapsedSeconds(start);
+        std::cout << "  sum via get(i):          " << static_cast<size_t>(count / checkedSeconds) << " elements/s" << std::endl;
+
+        auto widen = [](int x) { return static_cast<long long>(x); };
+        for (ExecutionPolicy policy : policies) {
+            start = std::chrono::steady_clock::now();
+            values.applyFunction(BasicConcepts::Functor(3), policy);
+            double applySeconds = elapsedSeconds(start);
+            start = std::chrono::steady_clock::now();
+            long long sum = values.transformReduce(0LL, std::plus<long long>(), widen, policy);
+            double reduceSeconds = elapsedSeconds(start);
+            values.applyFunction([](int x) { return x / 3; }, ExecutionPolicy::Parallel);
+            std::cout << "  " << policyName(policy) << " apply x3: " << static_cast<size_t>(count / applySeconds)
+                      << " elements/s, sum: " << static_cast<size_t>(count / reduceSeconds) << " elements/s" << std::endl;
+            if (sum != 3 * checkedSum) {
+                throw std::runtime_error("benchmark sums disagree");
+            }
+        }
+        std::cout << "  (hardware threads available: " << std::thread::hardware_concurrency() << ")" << std::endl;
+
+        std::cout << "\n✅ Container execution policy test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 -pthread test_container_policies.cpp -o test_container_policies
+// Run: ./test_container_policies [elements]
@@ -0,0 +1,137 @@
+#include "advanced/document_codec.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static std::vector<AdvancedConcepts::Document> makeDocuments(size_t count) {
+    std::vector<AdvancedConcepts::Document> docs;
+    docs.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        docs.emplace_back("Report " + std::to_string(i),
+                          "Quarterly figures for region " + std::to_string(i % 17) +
+                          " - revenue grew while costs stayed flat across all units.",
+                          "Author " + std::to_string(i % 101),
+                          static_cast<int>(1 + i % 400));
+    }
+    return docs;
+}
+
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING ADVANCED CONCEPTS - Binary Document Codec\n" << std::endl;
+
+    try {
+        // 1. Round trip with a delimiter inside the content
+        std::cout << "1. Round Trip with '|' in Content:" << std::endl;
+        AdvancedConcepts::Document tricky("Pipes", "a|b|c", "Ann|Lee", -3);
+
+        AdvancedConcepts::Document viaText("", "", "", 0);
+        try {
+            viaText.deserialize(tricky.serialize());
+            std::cout << "Pipe-delimited author: '" << viaText.getAuthor() << "'" << std::endl;
+        } catch (const std::exception& e) {
+            std::cout << "Pipe-delimited round trip failed: " << e.what() << std::endl;
+        }
+
+        std::string buffer;
+        AdvancedConcepts::encodeDocument(tricky, buffer);
+        AdvancedConcepts::DocumentView view;
+        size_t offset = 0;
+        if (!AdvancedConcepts::decodeDocument(buffer, offset, view) ||
+            view.content != "a|b|c" || view.author != "Ann|Lee" || view.pageCount != -3) {
+            throw std::runtime_error("binary round trip failed");
+        }
+        std::cout << "Binary author: '" << view.author << "', " << buffer.size() << " bytes" << std::endl;
+
+        // 2. Malformed input is rejected, never over-read
+        std::cout << "\n2. Truncated Input:" << std::endl;
+        offset = 0;
+        bool decoded = AdvancedConcepts::decodeDocument(
+            std::string_view(buffer).substr(0, buffer.size() - 2), offset, view);
+        std::cout << "Truncated buffer decoded: " << (decoded ? "Yes" : "No") << std::endl;
+        if (decoded) {
+            throw std::runtime_error("truncated buffer accepted");
+        }
+
+        // Ten-byte varints: UINT64_MAX round-trips, a tenth byte above 1 overflows
+        std::string largest;
+        AdvancedConcepts::appendVarint(largest, UINT64_MAX);
+        std::string overflowing = largest;
+        overflowing.back() = 0x02;
+        uint64_t varint = 0;
+        size_t varintOffset = 0;
+        bool largestRead = AdvancedConcepts::readVarint(largest, varintOffset, varint) && varint == UINT64_MAX;
+        varintOffset = 0;
+        bool overflowRead = AdvancedConcepts::readVarint(overflowing, varintOffset, varint);
+        std::cout << "Overflowing varint decoded: " << (overflowRead ? "Yes" : "No") << std::endl;
+        if (largest.size() != 10 || !largestRead || overflowRead) {
+            throw std::runtime_error("ten-byte varints are decoded wrongly");
+        }
+
+        // 3. Benchmark batch encode/decode against the pipe-delimited path
+        size_t count = argc > 1 ? std::stoul(argv[1]) : 200000;
+        std::cout << "\n3. Benchmark (" << count << " documents):" << std::endl;
+        auto docs = makeDocuments(count);
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::string> textRecords;
+        textRecords.reserve(docs.size());
+        size_t textBytes = 0;
+        for (const auto& doc : docs) {
+            textRecords.push_back(doc.serialize());
+            textBytes += textRecords.back().size();
+        }
+        double textEncode = elapsedSeconds(start);
+
+        start = std::chrono::steady_clock::now();
+        AdvancedConcepts::Document target("", "", "", 0);
+        long long pageSum = 0;
+        for (const auto& record : textRecords) {
+            target.deserialize(record);
+            pageSum += target.getPageCount();
+        }
+        double textDecode = elapsedSeconds(start);
+
+        start = std::chrono::steady_clock::now();
+        std::string batch = AdvancedConcepts::encodeDocuments(docs);
+        double binaryEncode = elapsedSeconds(start);
+
+        start = std::chrono::steady_clock::now();
+        std::vector<AdvancedConcepts::DocumentView> views;
+        if (!AdvancedConcepts::decodeDocuments(batch, views)) {
+            throw std::runtime_error("batch decode failed");
+        }
+        long long binaryPageSum = 0;
+        for (const auto& v : views) {
+            binaryPageSum += v.pageCount;
+        }
+        double binaryDecode = elapsedSeconds(start);
+
+        if (views.size() != docs.size() || binaryPageSum != pageSum ||
+            views.back().title != docs.back().getTitle()) {
+            throw std::runtime_error("batch contents mismatch");
+        }
+
+        double textMB = textBytes / 1e6;
+        double binaryMB = batch.size() / 1e6;
+        std::cout << "Pipe-delimited: " << textMB << " MB, encode " << textMB / textEncode
+                  << " MB/s, decode " << textMB / textDecode << " MB/s" << std::endl;
+        std::cout << "Binary batch:   " << binaryMB << " MB, encode " << binaryMB / binaryEncode
+                  << " MB/s, decode " << binaryMB / binaryDecode << " MB/s" << std::endl;
+
+        std::cout << "\n✅ Document codec test completed successfully!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_document_codec.cpp -o test_document_codec
+// Run: ./test_document_codec [documentCount]
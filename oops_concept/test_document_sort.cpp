@@ -0,0 +1,112 @@
+#include "advanced/document_sort.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::vector<AdvancedConcepts::Document> makeDocuments(size_t count) {
+    std::mt19937 rng(42);
+    std::vector<AdvancedConcepts::Document> docs;
+    docs.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        // Shared prefixes force some full-title tie breaks
+        std::string title = (rng() % 4 == 0 ? "Annual Report Volume " : "Memo ") + std::to_string(rng() % 100000);
+        docs.emplace_back(title, "content", "author", static_cast<int>(rng() % 300));
+    }
+    return docs;
+}
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING ADVANCED CONCEPTS - Devirtualized Document Sort\n" << std::endl;
+
+    try {
+        // 1. Keys agree with compareTo
+        std::cout << "1. Sort Key Ordering:" << std::endl;
+        AdvancedConcepts::Document a("Alpha", "", "", 10);
+        AdvancedConcepts::Document b("Beta", "", "", 10);
+        AdvancedConcepts::Document c("Aardvark", "", "", -5);
+        std::vector<AdvancedConcepts::Document> small = {a, b, c};
+        AdvancedConcepts::sortDocuments(small, 1);
+        for (const auto& doc : small) {
+            std::cout << "  " << doc.toString() << std::endl;
+        }
+        if (small[0].getTitle() != "Aardvark" || small[2].getTitle() != "Beta") {
+            throw std::runtime_error("unexpected key order");
+        }
+
+        // 2. Benchmark against sorting through the Comparable interface
+        size_t count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+        // At least 4 runs so the merge path is exercised even on small machines
+        unsigned threads = std::max(4u, std::thread::hardware_concurrency());
+        std::cout << "\n2. Benchmark (" << count << " documents, " << threads << " threads):" << std::endl;
+        auto docs = makeDocuments(count);
+
+        std::vector<const AdvancedConcepts::Comparable*> pointers;
+        pointers.reserve(docs.size());
+        for (const auto& doc : docs) {
+            pointers.push_back(&doc);
+        }
+        size_t virtualComparisons = 0;
+        auto start = std::chrono::steady_clock::now();
+        std::sort(pointers.begin(), pointers.end(),
+                  [&](const AdvancedConcepts::Comparable* x, const AdvancedConcepts::Comparable* y) {
+                      ++virtualComparisons;
+                      return x->compareTo(*y) < 0;
+                  });
+        double virtualMs = elapsedMs(start);
+
+        size_t keyComparisons = 0;
+        std::vector<AdvancedConcepts::DocumentSortKey> keys;
+        for (size_t i = 0; i < docs.size(); ++i) {
+            keys.push_back(AdvancedConcepts::DocumentSortKey::from(docs[i], static_cast<uint32_t>(i)));
+        }
+        AdvancedConcepts::DocumentKeyLess less(docs);
+        start = std::chrono::steady_clock::now();
+        std::sort(keys.begin(), keys.end(), [&](const auto& x, const auto& y) {
+            ++keyComparisons;
+            return less(x, y);
+        });
+        double keyMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::vector<uint32_t> serialOrder = AdvancedConcepts::sortedOrder(docs, 1);
+        double serialMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::vector<uint32_t> parallelOrder = AdvancedConcepts::sortedOrder(docs, threads);
+        double parallelMs = elapsedMs(start);
+
+        // Every path must produce the same compareTo order
+        for (size_t i = 0; i < docs.size(); ++i) {
+            const auto& expected = static_cast<const AdvancedConcepts::Document&>(*pointers[i]);
+            if (docs[parallelOrder[i]].compareTo(expected) != 0 ||
+                docs[serialOrder[i]].compareTo(expected) != 0) {
+                throw std::runtime_error("sorted orders differ at " + std::to_string(i));
+            }
+        }
+
+        std::cout << "Comparable (virtual):  " << virtualMs << " ms, "
+                  << virtualComparisons / (virtualMs / 1000.0) / 1e6 << " M comparisons/s" << std::endl;
+        std::cout << "Packed keys (sort):    " << keyMs << " ms, "
+                  << keyComparisons / (keyMs / 1000.0) / 1e6 << " M comparisons/s" << std::endl;
+        std::cout << "sortedOrder, 1 thread: " << serialMs << " ms (incl. key extraction)" << std::endl;
+        std::cout << "sortedOrder, parallel: " << parallelMs << " ms" << std::endl;
+
+        std::cout << "\n✅ Document sort test completed successfully!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 -pthread test_document_sort.cpp -o test_document_sort
+// Run: ./test_document_sort [documentCount]
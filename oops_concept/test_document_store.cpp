@@ -0,0 +1,115 @@
+#include "advanced/document_store.hpp"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void removeStore(const std::string& base) {
+    std::remove((base + ".dat").c_str());
+    std::remove((base + ".idx").c_str());
+    std::remove((base + ".ord").c_str());
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING ADVANCED CONCEPTS - Memory-Mapped Document Store\n" << std::endl;
+
+    const std::string base = "document_store_test";
+    size_t count = argc > 1 ? std::stoul(argv[1]) : 100000;
+    removeStore(base);
+
+    try {
+        // 1. Append documents and build the sorted index
+        std::cout << "1. Writing " << count << " documents:" << std::endl;
+        auto start = std::chrono::steady_clock::now();
+        {
+            AdvancedConcepts::DocumentStoreWriter writer(base);
+            for (size_t i = 0; i < count; ++i) {
+                AdvancedConcepts::Document doc("Title " + std::to_string((i * 7919) % count),
+                                               "Archived content for record " + std::to_string(i),
+                                               "Author " + std::to_string(i % 97),
+                                               static_cast<int>(1 + (i * 31) % 500));
+                writer.append(doc);
+            }
+            std::cout << "Append: " << elapsedMs(start) << " ms" << std::endl;
+
+            start = std::chrono::steady_clock::now();
+            writer.finish();
+            std::cout << "Sorted index build: " << elapsedMs(start) << " ms" << std::endl;
+        }
+
+        // 2. Startup cost is independent of the number of documents
+        std::cout << "\n2. Opening the store:" << std::endl;
+        start = std::chrono::steady_clock::now();
+        AdvancedConcepts::DocumentStore store(base);
+        std::cout << "Startup: " << elapsedMs(start) << " ms for " << store.size()
+                  << " documents" << std::endl;
+        if (store.size() != count || !store.hasSortedIndex()) {
+            throw std::runtime_error("store size or index mismatch");
+        }
+
+        // 3. Zero-copy lookups
+        std::cout << "\n3. Random Lookups:" << std::endl;
+        AdvancedConcepts::DocumentView first = store.get(0);
+        std::cout << "Record 0: " << first.title << " by " << first.author
+                  << ", " << first.pageCount << " pages" << std::endl;
+
+        start = std::chrono::steady_clock::now();
+        long long pages = 0;
+        const size_t lookups = 1000000;
+        for (size_t i = 0; i < lookups; ++i) {
+            pages += store.get((i * 2654435761u) % count).pageCount;
+        }
+        std::cout << "Lookup latency: " << elapsedMs(start) * 1e6 / lookups
+                  << " ns (checksum " << pages << ")" << std::endl;
+
+        // 4. Sorted iteration follows Document::compareTo
+        std::cout << "\n4. Sorted Iteration:" << std::endl;
+        start = std::chrono::steady_clock::now();
+        AdvancedConcepts::Document previous("", "", "", 0);
+        bool havePrevious = false;
+        size_t visited = 0;
+        store.forEachSorted([&](const AdvancedConcepts::DocumentView& view) {
+            AdvancedConcepts::Document current = view.toDocument();
+            if (havePrevious && previous.compareTo(current) > 0) {
+                throw std::runtime_error("sorted index out of order");
+            }
+            previous = current;
+            havePrevious = true;
+            ++visited;
+        });
+        std::cout << "Visited " << visited << " documents in order in "
+                  << elapsedMs(start) << " ms" << std::endl;
+        AdvancedConcepts::DocumentView smallest = store.getSorted(0);
+        std::cout << "Smallest: " << smallest.title << " (" << smallest.pageCount << " pages)" << std::endl;
+
+        // 5. Appending invalidates the sorted index until finish() runs again
+        std::cout << "\n5. Append After Finish:" << std::endl;
+        {
+            AdvancedConcepts::DocumentStoreWriter writer(base);
+            writer.append(AdvancedConcepts::Document("Late", "Added later", "Zed", 1));
+        }
+        AdvancedConcepts::DocumentStore reopened(base);
+        std::cout << "Documents: " << reopened.size() << ", sorted index available: "
+                  << (reopened.hasSortedIndex() ? "Yes" : "No") << std::endl;
+        if (reopened.hasSortedIndex() || reopened.get(count).title != "Late") {
+            throw std::runtime_error("stale sorted index was not detected");
+        }
+
+        std::cout << "\n✅ Document store test completed successfully!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        removeStore(base);
+        return 1;
+    }
+
+    removeStore(base);
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_document_store.cpp -o test_document_store
+// Run: ./test_document_store [documentCount]   (e.g. 10000000 for the 10M startup figure)
@@ -0,0 +1,139 @@
+#include "basic/employee_directory.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static double elapsedUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static const std::vector<std::string> departments = {
+    "Engineering", "Sales", "Marketing", "Finance", "HR", "Legal", "Support", "Research"};
+static const std::vector<std::string> skills = {
+    "C++", "Python", "SQL", "Go", "Rust", "Java", "Leadership", "Statistics",
+    "Negotiation", "Design", "Kubernetes", "Accounting"};
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Employee Directory\n" << std::endl;
+
+    try {
+        size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+        // 1. Importing Employee objects
+        std::cout << "1. Importing Employees:" << std::endl;
+        BasicConcepts::EmployeeDirectory small;
+        BasicConcepts::Employee alice("Alice", "Johnson", "Engineering", 75000.0, 3);
+        BasicConcepts::Employee bob("Bob", "Smith", "Sales", 52000.0, 5);
+        alice.addSkill("C++");
+        alice.addSkill("SQL");
+        bob.addSkill("SQL");
+        small.add(alice);
+        small.add(bob);
+
+        int64_t row = small.findById(alice.getEmployeeId());
+        std::cout << "Found by id: " << small.name(static_cast<uint32_t>(row)) << std::endl;
+        std::cout << "Sales headcount: " << small.inDepartment("Sales").size() << std::endl;
+        std::cout << "Earning 50k-60k: " << small.salaryBetween(50000, 60000).size() << std::endl;
+        std::cout << "With C++ and SQL: " << small.withAllSkills({"C++", "SQL"}).count() << std::endl;
+        if (row != 0 || small.withAnySkill({"SQL"}).count() != 2 || small.findById(-5) != -1) {
+            throw std::runtime_error("index lookups disagree with imported data");
+        }
+
+        try {
+            small.add(alice);
+        } catch (const std::invalid_argument& e) {
+            std::cout << "Duplicate rejected: " << e.what() << std::endl;
+        }
+
+        small.setSalary(1, 90000);
+        if (small.salaryBetween(50000, 60000).size() != 0 || small.countSalaryBetween(85000, 95000) != 1) {
+            throw std::runtime_error("salary index should follow updates");
+        }
+
+        // NaN fails every comparison, so it must be rejected before it reaches the sorted index
+        const double notANumber = std::numeric_limits<double>::quiet_NaN();
+        size_t nanRejected = 0;
+        try {
+            small.setSalary(1, notANumber);
+        } catch (const std::invalid_argument&) {
+            ++nanRejected;
+        }
+        try {
+            small.add(99, "Nan Salary", "HR", notANumber, 1);
+        } catch (const std::invalid_argument&) {
+            ++nanRejected;
+        }
+        std::cout << "NaN salaries rejected: " << nanRejected << "/2" << std::endl;
+        if (nanRejected != 2 || small.countSalaryBetween(85000, 95000) != 1) {
+            throw std::runtime_error("NaN salary was accepted");
+        }
+
+        // 2. Bulk load
+        std::cout << "\n2. Loading " << count << " employees:" << std::endl;
+        BasicConcepts::EmployeeDirectory directory;
+        directory.reserve(count);
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<double> salaryDist(30000, 300000);
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t r = directory.add(static_cast<int>(i + 1), "Emp" + std::to_string(i),
+                                       departments[rng() % departments.size()],
+                                       salaryDist(rng), static_cast<int>(rng() % 40));
+            directory.addSkill(r, skills[rng() % skills.size()]);
+            directory.addSkill(r, skills[rng() % skills.size()]);
+        }
+        std::cout << "Load time: " << elapsedUs(start) / 1000 << " ms" << std::endl;
+        directory.countSalaryBetween(0, 0); // Build the salary index outside the timings
+
+        // 3. Query latency
+        std::cout << "\n3. Query Latency:" << std::endl;
+        const int lookups = 100000;
+        size_t found = 0;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < lookups; ++i) {
+            found += directory.findById(static_cast<int>(rng() % count) + 1) >= 0;
+        }
+        std::cout << "  id lookup:           " << elapsedUs(start) * 1000 / lookups << " ns" << std::endl;
+        if (found != static_cast<size_t>(lookups)) {
+            throw std::runtime_error("id lookups missed");
+        }
+
+        start = std::chrono::steady_clock::now();
+        size_t engineers = directory.inDepartment("Engineering").size();
+        std::cout << "  department:          " << elapsedUs(start) << " us (" << engineers << " rows)" << std::endl;
+
+        start = std::chrono::steady_clock::now();
+        size_t inRange = directory.countSalaryBetween(100000, 101000);
+        double indexedUs = elapsedUs(start);
+        std::cout << "  salary range:        " << indexedUs << " us (" << inRange << " rows)" << std::endl;
+
+        start = std::chrono::steady_clock::now();
+        size_t scanned = 0;
+        for (uint32_t r = 0; r < directory.size(); ++r) {
+            double s = directory.salary(r);
+            scanned += s >= 100000 && s <= 101000;
+        }
+        std::cout << "  salary range (scan): " << elapsedUs(start) << " us" << std::endl;
+        if (scanned != inRange) {
+            throw std::runtime_error("salary index disagrees with a full scan");
+        }
+
+        start = std::chrono::steady_clock::now();
+        size_t both = directory.withAllSkills({"C++", "Rust"}).count();
+        std::cout << "  skills C++ AND Rust: " << elapsedUs(start) << " us (" << both << " rows)" << std::endl;
+
+        std::cout << "\n✅ Employee directory test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_employee_directory.cpp -o test_employee_directory
+// Run: ./test_employee_directory [employees]   (pass 10000000 for the 10M figures)
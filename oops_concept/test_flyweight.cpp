@@ -0,0 +1,209 @@
+#include "design_patterns/flyweight.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// Count heap bytes so memory per component can be reported. Each request is
+// charged as a typical 64-bit malloc chunk: 8-byte header, 16-byte
+// granularity, 32 bytes minimum.
+static size_t heapBytes = 0;
+
+static size_t chunkBytes(size_t size) {
+    size_t chunk = (size + 8 + 15) & ~size_t(15);
+    return chunk < 32 ? 32 : chunk;
+}
+
+void* operator new(size_t size) {
+    heapBytes += chunkBytes(size);
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t align) {
+    size_t alignment = static_cast<size_t>(align);
+    heapBytes += chunkBytes(size);
+    if (void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double report(const char* label, size_t count, size_t bytes, double ms) {
+    double perComponent = static_cast<double>(bytes) / count;
+    std::cout << "  " << label << ": " << perComponent << " bytes/component, "
+              << static_cast<size_t>(count / (ms / 1000.0)) << " components/s" << std::endl;
+    return perComponent;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING DESIGN PATTERNS - Flyweight UI Theming\n" << std::endl;
+
+    try {
+        size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+        // 1. Flyweight products behave like the originals
+        std::cout << "1. Shared Themes:" << std::endl;
+        demonstrateFlyweight();
+
+        FlyweightUIFactory ui(PlatformTheme::mac());
+        ThemedButton* a = ui.acquireButton("ok", "OK");
+        ThemedButton* b = ui.acquireButton("ok", "OK");
+        if (a == b || &a->getText() != &b->getText() || &a->getName() != &b->getName() ||
+            a->getStyle() != "Mac") {
+            throw std::runtime_error("name, label and theme should be shared");
+        }
+
+        // 2. Pool recycles released slots
+        std::cout << "\n2. Pool Reuse:" << std::endl;
+        ThemedTextField* field = ui.acquireTextField("f", "Search");
+        field->setValue("query");
+        ui.release(field);
+        ThemedTextField* reused = ui.acquireTextField("g", "Search");
+        std::cout << "Released slot reused: " << (reused == field ? "Yes" : "No") << std::endl;
+        std::cout << "Live components: " << ui.liveComponents() << std::endl;
+        if (reused != field || ui.liveComponents() != 3 || !reused->getValue().empty()) {
+            throw std::runtime_error("pool should hand back the freed slot, freshly constructed");
+        }
+
+        // 3. Through the abstract factory interfaces, with default unique_ptr deleters
+        std::cout << "\n3. Abstract Factory Interfaces:" << std::endl;
+        {
+            AdvancedConcepts::UIFactory& factory = ui;
+            std::unique_ptr<AdvancedConcepts::Button> button = factory.createButton("c", "OK");
+            AdvancedConcepts::Button* slot = button.get();
+            if (button->getText() != "OK" || button->getStyle() != "Mac" || ui.liveComponents() != 4) {
+                throw std::runtime_error("UIFactory product is wrong");
+            }
+            button.reset();
+            ThemedButton* next = ui.acquireButton("d", "OK");
+            std::cout << "Deleted product went back to the pool: " << (next == slot ? "Yes" : "No") << std::endl;
+            if (next != slot || ui.liveComponents() != 4) {
+                throw std::runtime_error("deleting a pooled product should free its slot");
+            }
+
+            // A foreign product is not the pool's to free
+            AdvancedConcepts::WindowsButton foreign("x", "Foreign");
+            ui.release(&foreign);
+            FlyweightUIFactory other(PlatformTheme::mac());
+            ui.release(other.acquireButton("y", "Other"));
+            if (ui.liveComponents() != 4 || other.liveComponents() != 1) {
+                throw std::runtime_error("release should ignore foreign products");
+            }
+
+            FlyweightGUIFactory gui(PlatformTheme::windows());
+            GUIFactory& abstractGui = gui;
+            {
+                std::unique_ptr<Button> guiButton = abstractGui.createButton();
+                std::unique_ptr<Checkbox> guiBox = abstractGui.createCheckbox();
+                WindowsButton plain;
+                gui.release(&plain);
+                if (gui.liveComponents() != 2) {
+                    throw std::runtime_error("GUIFactory products should come from the pools");
+                }
+            }
+            if (gui.liveComponents() != 0) {
+                throw std::runtime_error("deleted GUIFactory products should leave the pools");
+            }
+
+            AdvancedConcepts::Application app(std::make_unique<FlyweightUIFactory>(PlatformTheme::windows()));
+            app.createUI();
+            std::cout << "Application runs on FlyweightUIFactory: Yes" << std::endl;
+
+            // Handed-out products keep their pool and shared state alive
+            std::unique_ptr<AdvancedConcepts::Button> survivor;
+            std::unique_ptr<Checkbox> survivorBox;
+            {
+                FlyweightUIFactory shortLived(PlatformTheme::mac());
+                FlyweightGUIFactory shortLivedGui(PlatformTheme::mac());
+                survivor = shortLived.createButton("keep", "Survivor");
+                survivorBox = shortLivedGui.createCheckbox();
+                shortLived.acquireButton("drop", "Owned by the factory");
+            }
+            std::cout << "Product outlives its factory: " << survivor->getText() << " ("
+                      << survivor->getStyle() << ")" << std::endl;
+            if (survivor->getText() != "Survivor" || survivor->getName() != "keep") {
+                throw std::runtime_error("product lost its shared state with the factory");
+            }
+            survivorBox->render();
+            survivor.reset();      // Frees the retired pool and its faces
+            survivorBox.reset();
+        }
+
+        // 4. Memory and creation rate
+        std::cout << "\n4. Creating " << count << " components:" << std::endl;
+        std::cout << "  sizeof WindowsButton=" << sizeof(AdvancedConcepts::WindowsButton)
+                  << " ThemedButton=" << sizeof(ThemedButton)
+                  << " | WindowsButton(factory.hpp)=" << sizeof(WindowsButton)
+                  << " FlyweightButton=" << sizeof(FlyweightButton) << std::endl;
+
+        double classicUi = 0, flyweightUi = 0, classicGui = 0, flyweightGui = 0;
+        {
+            AdvancedConcepts::WindowsUIFactory classic;
+            std::vector<std::unique_ptr<AdvancedConcepts::Button>> buttons;
+            buttons.reserve(count);
+            size_t before = heapBytes;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i) {
+                buttons.push_back(classic.createButton("btn", "Submit form"));
+            }
+            double ms = elapsedMs(start);
+            classicUi = report("WindowsUIFactory   ", count, heapBytes - before, ms);
+        }
+        {
+            FlyweightUIFactory themed(PlatformTheme::windows());
+            size_t before = heapBytes;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i) {
+                themed.acquireButton("btn", "Submit form");
+            }
+            double ms = elapsedMs(start);
+            flyweightUi = report("FlyweightUIFactory ", count, heapBytes - before, ms);
+            if (themed.liveComponents() != count) {
+                throw std::runtime_error("pool lost components");
+            }
+        }
+        {
+            WindowsFactory classic;
+            std::vector<std::unique_ptr<Button>> buttons;
+            buttons.reserve(count);
+            size_t before = heapBytes;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i) {
+                buttons.push_back(classic.createButton());
+            }
+            double ms = elapsedMs(start);
+            classicGui = report("WindowsFactory     ", count, heapBytes - before, ms);
+        }
+        {
+            FlyweightGUIFactory themed(PlatformTheme::windows());
+            size_t before = heapBytes;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i) {
+                themed.acquireButton("OK");
+            }
+            double ms = elapsedMs(start);
+            flyweightGui = report("FlyweightGUIFactory", count, heapBytes - before, ms);
+        }
+        if (flyweightUi >= classicUi || flyweightGui >= classicGui) {
+            throw std::runtime_error("flyweight products should take less memory than the classic ones");
+        }
+
+        std::cout << "\n✅ Flyweight UI theming test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_flyweight.cpp -o test_flyweight
+// Run: ./test_flyweight [components]
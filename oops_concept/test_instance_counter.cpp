@@ -0,0 +1,147 @@
+#include "basic/class_object.hpp"
+#include "basic/inheritance.hpp"
+#include "basic/instance_counter.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+// Discards everything written to it; Counter and Vehicle constructors print
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+static std::atomic<int> plainCount{0};
+static BasicConcepts::ShardedCounter liveOnlyCount;
+static BasicConcepts::InstanceCounter shardedCount("ShardedWidget");
+
+struct PlainWidget {
+    PlainWidget() { plainCount.fetch_add(1, std::memory_order_relaxed); }
+    ~PlainWidget() { plainCount.fetch_sub(1, std::memory_order_relaxed); }
+};
+
+struct LiveOnlyWidget {
+    LiveOnlyWidget() { liveOnlyCount.add(1); }
+    ~LiveOnlyWidget() { liveOnlyCount.add(-1); }
+};
+
+struct ShardedWidget {
+    ShardedWidget() { shardedCount.onConstruct(); }
+    ~ShardedWidget() { shardedCount.onDestroy(); }
+};
+
+// Constructs and destroys perThread widgets on each thread; returns objects/s
+template <typename Widget>
+static double constructionRate(unsigned threads, size_t perThread) {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([perThread] {
+            for (size_t i = 0; i < perThread; ++i) {
+                Widget widget;
+                std::atomic_signal_fence(std::memory_order_seq_cst); // keep the object alive
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return threads * perThread / seconds;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Sharded Instance Counters\n" << std::endl;
+
+    NullBuffer nullBuffer;
+    std::streambuf* console = std::cout.rdbuf();
+    try {
+        size_t perThread = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+
+        // 1. Single-threaded behaviour is unchanged
+        std::cout << "1. Sequential Ids:" << std::endl;
+        BasicConcepts::Counter::resetCounter();
+        std::cout.rdbuf(&nullBuffer);
+        {
+            BasicConcepts::Counter a, b, c;
+            std::cout.rdbuf(console);
+            std::cout << "Ids: " << a.getId() << ", " << b.getId() << ", " << c.getId() << std::endl;
+            if (a.getId() != 1 || c.getId() != 3 || BasicConcepts::Counter::getTotalObjects() != 3) {
+                throw std::runtime_error("single-threaded ids must stay 1, 2, 3");
+            }
+            std::cout.rdbuf(&nullBuffer);
+        }
+        BasicConcepts::Counter::resetCounter();
+        BasicConcepts::Counter again;
+        std::cout.rdbuf(console);
+        if (again.getId() != 1) {
+            throw std::runtime_error("reset must restart ids");
+        }
+        std::cout << "Id after reset: " << again.getId() << std::endl;
+
+        // 2. Concurrent construction stays exact
+        std::cout << "\n2. Concurrent Construction:" << std::endl;
+        std::vector<std::thread> workers;
+        std::vector<std::vector<int>> ids(8);
+        std::vector<std::vector<std::unique_ptr<BasicConcepts::Vehicle>>> garages(8);
+        int vehiclesBefore = BasicConcepts::Vehicle::getTotalVehicles();
+        std::cout.rdbuf(&nullBuffer);
+        for (int t = 0; t < 8; ++t) {
+            workers.emplace_back([&ids, &garages, t] {
+                for (int i = 0; i < 1000; ++i) {
+                    garages[t].push_back(std::make_unique<BasicConcepts::Car>("Toyota", "Camry", 2022, 1.0, 4, "Gas", 2.0));
+                    ids[t].push_back(BasicConcepts::Counter().getId());
+                }
+                if (t % 2 == 0) garages[t].clear(); // half the threads scrap their cars
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        std::cout.rdbuf(console);
+        std::set<int> unique;
+        for (const auto& list : ids) unique.insert(list.begin(), list.end());
+        int vehiclesAlive = BasicConcepts::Vehicle::getTotalVehicles() - vehiclesBefore;
+        std::cout << "Vehicles alive: " << vehiclesAlive << std::endl;
+        std::cout << "Counter ids handed out: " << unique.size() << " unique of 8000" << std::endl;
+        if (vehiclesAlive != 4000 || unique.size() != 8000 || BasicConcepts::Counter::getTotalObjects() != 8001) {
+            throw std::runtime_error("concurrent counters lost updates");
+        }
+
+        // 3. Benchmark: 32 threads constructing objects
+        std::cout << "\n3. 32 threads x " << perThread << " constructions:" << std::endl;
+        double plainRate = constructionRate<PlainWidget>(32, perThread);
+        double liveOnlyRate = constructionRate<LiveOnlyWidget>(32, perThread);
+        double shardedRate = constructionRate<ShardedWidget>(32, perThread);
+        std::cout << "  std::atomic<int>:                  " << static_cast<size_t>(plainRate) << " objects/s" << std::endl;
+        std::cout << "  ShardedCounter:                    " << static_cast<size_t>(liveOnlyRate) << " objects/s" << std::endl;
+        std::cout << "  InstanceCounter (live+created+id): " << static_cast<size_t>(shardedRate) << " objects/s" << std::endl;
+        std::cout << "  (hardware threads available: " << std::thread::hardware_concurrency() << ")" << std::endl;
+        if (plainCount.load() != 0 || liveOnlyCount.read() != 0 || shardedCount.liveCount() != 0 ||
+            shardedCount.createdCount() != static_cast<int64_t>(32 * perThread)) {
+            throw std::runtime_error("benchmark counts are wrong");
+        }
+
+        // 4. Diagnostics
+        std::cout << "\n4. Live Objects by Type:" << std::endl;
+        for (const auto& stats : BasicConcepts::InstanceRegistry::instance().snapshot()) {
+            std::cout << "  " << stats.typeName << ": " << stats.live << " live, "
+                      << stats.created << " created" << std::endl;
+        }
+
+        std::cout.rdbuf(&nullBuffer);
+    } catch (const std::exception& e) {
+        std::cout.rdbuf(console);
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    std::cout.rdbuf(console);
+    std::cout << "\n✅ Instance counter test completed successfully!" << std::endl;
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 -pthread test_instance_counter.cpp -o test_instance_counter
+// Run: ./test_instance_counter [constructions_per_thread]
@@ -0,0 +1,113 @@
+#include "advanced/inverted_index.hpp"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Zipf-like synthetic text: word k appears with probability ~ 1/k
+static std::string makeContent(std::mt19937& rng, size_t words, size_t vocabulary) {
+    std::string text;
+    for (size_t i = 0; i < words; ++i) {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        size_t rank = static_cast<size_t>(std::pow(static_cast<double>(vocabulary), u));
+        text += "w" + std::to_string(rank) + ' ';
+    }
+    return text;
+}
+
+static bool containsAll(const AdvancedConcepts::Document& doc, const std::vector<std::string>& terms) {
+    std::vector<std::string> tokens;
+    std::string buffer;
+    for (const std::string* field : {&doc.getTitle(), &doc.getAuthor(), &doc.getContent()}) {
+        AdvancedConcepts::tokenize(*field, buffer, [&](std::string_view t) { tokens.emplace_back(t); });
+    }
+    for (const auto& term : terms) {
+        if (std::find(tokens.begin(), tokens.end(), term) == tokens.end()) return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING ADVANCED CONCEPTS - Full-Text Inverted Index\n" << std::endl;
+
+    try {
+        // 1. Small index checked against a linear scan
+        std::cout << "1. Correctness Against Linear Scan:" << std::endl;
+        std::mt19937 rng(7);
+        std::vector<AdvancedConcepts::Document> docs;
+        AdvancedConcepts::InvertedIndex small;
+        for (int i = 0; i < 3000; ++i) {
+            docs.emplace_back("Doc " + std::to_string(i), makeContent(rng, 40, 500),
+                              i % 2 ? "Ada Lovelace" : "Alan Turing", 1);
+            small.addDocument(docs.back());
+        }
+        std::vector<std::vector<std::string>> queries = {
+            {"w1"}, {"w1", "w2"}, {"w3", "w17", "ada"}, {"w250", "turing"}, {"w499", "w2", "w1"}
+        };
+        for (const auto& terms : queries) {
+            std::string query;
+            for (const auto& term : terms) query += term + ' ';
+            std::vector<uint32_t> hits = small.search(query);
+            std::vector<uint32_t> expected;
+            for (uint32_t id = 0; id < docs.size(); ++id) {
+                if (containsAll(docs[id], terms)) expected.push_back(id);
+            }
+            std::cout << "  '" << query << "' -> " << hits.size() << " documents" << std::endl;
+            if (hits != expected) {
+                throw std::runtime_error("index disagrees with linear scan for '" + query + "'");
+            }
+        }
+        if (!small.search("unknownterm w1").empty()) {
+            throw std::runtime_error("unknown term should match nothing");
+        }
+
+        // 2. Build and query a large synthetic index
+        size_t count = argc > 1 ? std::stoul(argv[1]) : 200000;
+        std::cout << "\n2. Benchmark (" << count << " synthetic documents):" << std::endl;
+        AdvancedConcepts::InvertedIndex index;
+        std::string content;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            content = makeContent(rng, 30, 50000);
+            index.addDocument("Report " + std::to_string(i), "Author", content);
+        }
+        double buildMs = elapsedMs(start);
+
+        size_t postings = index.postingCount();
+        std::cout << "Build: " << buildMs << " ms, " << index.termCount() << " terms, "
+                  << postings << " postings" << std::endl;
+        std::cout << "Index size: " << index.indexBytes() / 1e6 << " MB (uncompressed ids: "
+                  << postings * sizeof(uint32_t) / 1e6 << " MB)" << std::endl;
+
+        std::vector<std::string> benchQueries = {
+            "w1 w2", "w1 w2 w3", "w10 w100", "w5 w5000", "w42 w4242 w1", "report w7"
+        };
+        for (const auto& query : benchQueries) {
+            const int repeats = 20;
+            size_t hits = 0;
+            start = std::chrono::steady_clock::now();
+            for (int r = 0; r < repeats; ++r) {
+                hits = index.search(query).size();
+            }
+            std::cout << "  '" << query << "': " << hits << " hits, "
+                      << elapsedMs(start) * 1000.0 / repeats << " us/query" << std::endl;
+        }
+
+        std::cout << "\n✅ Inverted index test completed successfully!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_inverted_index.cpp -o test_inverted_index
+// Run: ./test_inverted_index [documentCount]   (e.g. 1000000 for the 1M-document figures)
@@ -0,0 +1,154 @@
+#include "basic/payroll.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Discards everything written to it, so the per-object path is timed without a terminal
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Bulk Payroll\n" << std::endl;
+
+    try {
+        size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+        using BasicConcepts::CommitMode;
+        using BasicConcepts::EmployeeDirectory;
+        using BasicConcepts::PayrollBatch;
+
+        // 1. Failures are collected, not thrown
+        std::cout << "1. Validation Failures:" << std::endl;
+        EmployeeDirectory staff;
+        staff.add(1, "Ann Lee", "Engineering", 100000, 5);
+        staff.add(2, "Raj Patel", "Engineering", 990000, 10);   // Raise would pass the cap
+        staff.add(3, "Mia Wong", "Sales", 60000, 49);           // Experience would pass 50
+        staff.add(4, "Tom Hall", "Sales", 55000, 2, false);     // Inactive
+        staff.add(5, "Eve Park", "Legal", 70000, 1);
+
+        PayrollBatch strict(staff);
+        strict.applyRaise(10);
+        strict.addExperience(2);
+        for (const auto& failure : strict.getFailures()) {
+            std::cout << "  Employee " << failure.employeeId << ": " << failure.reason << std::endl;
+        }
+        bool applied = strict.commit(CommitMode::AllOrNothing);
+        std::cout << "All-or-nothing commit applied: " << (applied ? "Yes" : "No") << std::endl;
+        if (applied || strict.getFailures().size() != 3 || staff.salary(0) != 100000) {
+            throw std::runtime_error("all-or-nothing commit must leave the directory untouched");
+        }
+
+        // 2. Best-effort commit
+        std::cout << "\n2. Best-Effort Commit:" << std::endl;
+        PayrollBatch lenient(staff);
+        lenient.applyRaise(10);
+        lenient.addExperience(2);
+        lenient.commit(CommitMode::BestEffort);
+        std::cout << "Ann: $" << staff.salary(0) << ", " << staff.yearsOfExperience(0) << " years" << std::endl;
+        std::cout << "Raj: $" << staff.salary(1) << " (unchanged)" << std::endl;
+        if (std::abs(staff.salary(0) - 110000) > 1e-6 || staff.yearsOfExperience(0) != 7 ||
+            staff.salary(1) != 990000 || staff.yearsOfExperience(2) != 49 ||
+            std::abs(staff.salary(4) - 77000) > 1e-6 || staff.countSalaryBetween(109999, 110001) != 1) {
+            throw std::runtime_error("best-effort commit applied the wrong rows");
+        }
+        try {
+            lenient.applyRaise(5);
+        } catch (const std::logic_error& e) {
+            std::cout << "Reuse after commit rejected: " << e.what() << std::endl;
+        }
+        try {
+            PayrollBatch(staff).addExperience(2147483647);
+            throw std::runtime_error("out-of-range years were accepted");
+        } catch (const std::invalid_argument& e) {
+            std::cout << "Huge experience increment rejected: " << e.what() << std::endl;
+        }
+
+        // 3. Interleaved updates
+        std::cout << "\n3. Interleaved Updates:" << std::endl;
+        PayrollBatch first(staff);
+        PayrollBatch second(staff);
+        first.applyRaise(5);
+        second.addExperience(1);
+        staff.setSalary(4, 80000);          // Direct update while both batches are open
+        bool firstThrew = false;
+        try {
+            first.commit();
+        } catch (const std::logic_error& e) {
+            firstThrew = true;
+            std::cout << "Stale batch rejected: " << e.what() << std::endl;
+        }
+        if (!firstThrew || staff.salary(4) != 80000 || std::abs(staff.salary(0) - 110000) > 1e-6) {
+            throw std::runtime_error("stale batch overwrote a concurrent setSalary");
+        }
+        PayrollBatch third(staff);
+        third.addExperience(1);
+        third.commit(CommitMode::BestEffort);
+        bool secondThrew = false;
+        try {
+            second.commit(CommitMode::BestEffort);
+        } catch (const std::logic_error&) {
+            secondThrew = true;
+        }
+        std::cout << "Second batch after another commit rejected: " << (secondThrew ? "Yes" : "No") << std::endl;
+        if (!secondThrew || staff.yearsOfExperience(0) != 8 || staff.salary(4) != 80000) {
+            throw std::runtime_error("interleaved batch commits lost an update");
+        }
+
+        // 4. Throughput against Employee::increaseSalary
+        std::cout << "\n4. Annual raise for " << count << " employees:" << std::endl;
+        NullBuffer nullBuffer;
+        std::streambuf* console = std::cout.rdbuf(&nullBuffer);
+        std::vector<std::unique_ptr<BasicConcepts::Employee>> objects;
+        objects.reserve(count);
+        EmployeeDirectory directory;
+        directory.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            double salary = 40000 + static_cast<double>(i % 1000) * 100;
+            objects.push_back(std::make_unique<BasicConcepts::Employee>("First", "Last", "Ops", salary, 3));
+            directory.add(static_cast<int>(i), "First Last", "Ops", salary, 3);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto& employee : objects) {
+            employee->increaseSalary(3);
+            employee->addExperience(1);
+        }
+        double objectMs = elapsedMs(start);
+        std::cout.rdbuf(console);
+
+        start = std::chrono::steady_clock::now();
+        PayrollBatch batch(directory);
+        batch.applyRaise(3);
+        batch.addExperience(1);
+        bool ok = batch.commit();
+        double bulkMs = elapsedMs(start);
+
+        std::cout << "  Employee::increaseSalary: " << objectMs << " ms ("
+                  << static_cast<size_t>(count / (objectMs / 1000)) << " employees/s)" << std::endl;
+        std::cout << "  PayrollBatch:             " << bulkMs << " ms ("
+                  << static_cast<size_t>(count / (bulkMs / 1000)) << " employees/s)" << std::endl;
+        if (!ok || std::abs(directory.salary(static_cast<uint32_t>(count - 1)) - objects.back()->getSalary()) > 1e-6 ||
+            directory.yearsOfExperience(0) != 4) {
+            throw std::runtime_error("bulk and per-object payroll disagree");
+        }
+
+        std::cout << "\n✅ Bulk payroll test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_payroll.cpp -o test_payroll
+// Run: ./test_payroll [employees]
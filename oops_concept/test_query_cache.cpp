@@ -0,0 +1,156 @@
+#include "advanced/abstraction.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Runs the same read-heavy workload with and without the result cache
+static double runWorkload(AdvancedConcepts::DatabaseConnection& db, int iterations) {
+    std::ostringstream sink;
+    std::streambuf* original = std::cout.rdbuf(sink.rdbuf());
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        db.executeQuery("SELECT * FROM users WHERE id = " + std::to_string(i % 50));
+        db.executeQuery("SHOW TABLES");
+        if (i % 100 == 0) {
+            db.executeQuery("UPDATE users SET visits = visits + 1 WHERE id = 7");
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout.rdbuf(original);
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 10000;
+    if (iterations <= 0) {
+        iterations = 10000;
+    }
+
+    std::cout << "🧪 TESTING ADVANCED CONCEPTS - Prepared Statement & Result Cache\n" << std::endl;
+
+    try {
+        // 1. Query normalization
+        std::cout << "1. Query Normalization:" << std::endl;
+        size_t params = 0;
+        std::string a = AdvancedConcepts::normalizeQuery("select *  from users where id = 42;", &params);
+        std::string b = AdvancedConcepts::normalizeQuery("SELECT * FROM users\n WHERE id = 7");
+        std::cout << "Normalized: " << a << " (" << params << " parameter)" << std::endl;
+        std::cout << "Same fingerprint: "
+                  << (AdvancedConcepts::fingerprintQuery(a) == AdvancedConcepts::fingerprintQuery(b) ? "Yes" : "No")
+                  << std::endl;
+        if (a != b || params != 1) {
+            throw std::runtime_error("normalization mismatch");
+        }
+        std::cout << "Literal with quote: "
+                  << AdvancedConcepts::normalizeQuery("INSERT INTO t1 VALUES ('it''s', 3.5)") << std::endl;
+
+        // 2. Statement and result caching on a connection
+        std::cout << "\n2. Cached MySQL Connection:" << std::endl;
+        AdvancedConcepts::MySQLConnection mysql("localhost", "shop", "admin", "secret");
+        mysql.connect();
+        mysql.enableResultCache(4096);
+
+        mysql.showTables();
+        mysql.showTables();  // Served from the result cache
+        mysql.executeQuery("SELECT * FROM orders WHERE id = 1");
+        mysql.executeQuery("SELECT * FROM orders WHERE id = 2");  // Same statement, new result
+        mysql.printCacheStatistics();
+
+        if (mysql.getResultCache()->getHits() != 1 || mysql.getStatementCache().size() != 2) {
+            throw std::runtime_error("unexpected cache counters");
+        }
+
+        // 3. Invalidation inside a transaction
+        std::cout << "\n3. Invalidation on Transactional Writes:" << std::endl;
+        const AdvancedConcepts::ResultCache& results = *mysql.getResultCache();
+        const AdvancedConcepts::StatementCache& statements = mysql.getStatementCache();
+        size_t hitsBefore = results.getHits(), missesBefore = results.getMisses();
+        size_t invalidationsBefore = results.getInvalidations();
+        size_t statementHitsBefore = statements.getHits(), statementMissesBefore = statements.getMisses();
+        mysql.beginTransaction();
+        mysql.executeQuery("SHOW TABLES");                          // Still clean: cache hit
+        mysql.executeQuery("CREATE TABLE audit (id INT)");          // Write: invalidates
+        mysql.executeQuery("SHOW TABLES");                          // Bypasses cache
+        mysql.commitTransaction();
+        mysql.executeQuery("SHOW TABLES");                          // Re-populates
+        mysql.executeQuery("SHOW TABLES");                          // Hit again
+        mysql.printCacheStatistics();
+
+        // Two hits, one miss after the commit, and one invalidation: the
+        // commit finds the cache already emptied by the write
+        if (results.getHits() - hitsBefore != 2 || results.getMisses() - missesBefore != 1 ||
+            results.getInvalidations() - invalidationsBefore != 1 || results.size() != 1 ||
+            statements.getHits() - statementHitsBefore != 4 || statements.getMisses() - statementMissesBefore != 1) {
+            throw std::runtime_error("transactional invalidation counters are wrong");
+        }
+
+        // Statements not provably read-only must invalidate like any write
+        const char* const sideEffects[] = {
+            "CALL refresh_totals()",
+            "WITH gone AS (DELETE FROM orders WHERE id = 1 RETURNING id) SELECT * FROM gone",
+            "SELECT * INTO orders_backup FROM orders",
+            "GRANT SELECT ON orders TO auditor"
+        };
+        for (const char* sql : sideEffects) {
+            mysql.executeQuery("SELECT * FROM orders WHERE id = 1");
+            size_t misses = results.getMisses();
+            mysql.executeQuery(sql);
+            mysql.executeQuery("SELECT * FROM orders WHERE id = 1");
+            std::cout << sql << " -> " << (results.getMisses() - misses == 1 ? "invalidated" : "stale") << std::endl;
+            if (results.getMisses() - misses != 1) {
+                throw std::runtime_error(std::string("stale result served after: ") + sql);
+            }
+        }
+        mysql.executeQuery("WITH recent AS (SELECT * FROM orders WHERE id > 1) SELECT * FROM recent");
+        size_t missesBeforeCte = results.getMisses();
+        mysql.executeQuery("WITH recent AS (SELECT * FROM orders WHERE id > 1) SELECT * FROM recent");
+        if (results.getMisses() != missesBeforeCte) {
+            throw std::runtime_error("read-only WITH query was not cached");
+        }
+        mysql.disconnect();
+
+        // 4. Benchmark: read-through cache vs. always executing, with every
+        // executed query paying a simulated 10 us server round trip
+        std::cout << "\n4. Benchmark (" << iterations << " iterations, 2 reads each, 10 us per execution):"
+                  << std::endl;
+        AdvancedConcepts::PostgreSQLConnection uncached("localhost", "shop", "admin", "secret");
+        AdvancedConcepts::PostgreSQLConnection cached("localhost", "shop", "admin", "secret");
+        uncached.connect();
+        cached.connect();
+        uncached.setSimulatedLatency(std::chrono::microseconds(10));
+        cached.setSimulatedLatency(std::chrono::microseconds(10));
+        cached.enableResultCache();
+
+        double uncachedMs = runWorkload(uncached, iterations);
+        double cachedMs = runWorkload(cached, iterations);
+        const AdvancedConcepts::ResultCache& benchmarkCache = *cached.getResultCache();
+
+        std::cout << "Without result cache: " << uncachedMs << " ms" << std::endl;
+        std::cout << "With result cache:    " << cachedMs << " ms" << std::endl;
+        std::cout << "Measured saving:      " << uncachedMs - cachedMs << " ms" << std::endl;
+        std::cout << "Statement cache hit rate: "
+                  << cached.getStatementCache().hitRate() * 100.0 << "%" << std::endl;
+        std::cout << "Result cache hit rate:    " << benchmarkCache.hitRate() * 100.0 << "%" << std::endl;
+        std::cout << "Cache accounting: " << benchmarkCache.getGrossNanosSaved() / 1e6
+                  << " ms of executions skipped - " << benchmarkCache.getNanosSpent() / 1e6
+                  << " ms cache overhead = " << benchmarkCache.getNetNanosSaved() / 1e6 << " ms net" << std::endl;
+        if (cachedMs >= uncachedMs || benchmarkCache.getNetNanosSaved() <= 0) {
+            throw std::runtime_error("result cache did not pay for itself");
+        }
+
+        std::cout << "\n✅ Query cache test completed successfully!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_query_cache.cpp -o test_query_cache
+// Run: ./test_query_cache [iterations]
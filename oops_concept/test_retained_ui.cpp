@@ -0,0 +1,147 @@
+#include "advanced/retained_ui.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Discards everything written to it, so console-rendering costs can be timed
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::unique_ptr<AdvancedConcepts::UIComponent> makeComponent(size_t i) {
+    std::string name = "c" + std::to_string(i);
+    switch (i % 4) {
+        case 0: return std::make_unique<AdvancedConcepts::WindowsButton>(name, "OK");
+        case 1: return std::make_unique<AdvancedConcepts::MacButton>(name, "OK");
+        case 2: return std::make_unique<AdvancedConcepts::WindowsTextField>(name, "Type here");
+        default: return std::make_unique<AdvancedConcepts::MacTextField>(name, "Type here");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING ADVANCED CONCEPTS - Retained-Mode UI Renderer\n" << std::endl;
+
+    try {
+        // 1. Small scene rendered to the console
+        std::cout << "1. Incremental Rendering:" << std::endl;
+        AdvancedConcepts::RetainedScene scene;
+        AdvancedConcepts::WindowsUIFactory factory;
+        uint32_t ok = scene.add(factory.createButton("okBtn", "OK"), {0, 0, 80, 30});
+        uint32_t name = scene.add(factory.createTextField("nameField", "Name"), {0, 40, 200, 30});
+        scene.add(factory.createButton("cancelBtn", "Cancel"), {90, 0, 80, 30});
+
+        AdvancedConcepts::ConsoleBackend console;
+        size_t rendered = scene.renderFrame(console);
+        std::cout << "First frame re-rendered " << rendered << " components" << std::endl;
+        rendered = scene.renderFrame(console);
+        std::cout << "Idle frame re-rendered " << rendered << " components" << std::endl;
+        static_cast<AdvancedConcepts::TextField&>(scene.get(name)).setValue("Ada");
+        rendered = scene.renderFrame(console);
+        std::cout << "After edit re-rendered " << rendered << " component" << std::endl;
+        if (rendered != 1) {
+            throw std::runtime_error("only the edited field should re-render");
+        }
+
+        // 2. Clicks go only to the component under the cursor
+        std::cout << "\n2. Hit-Testing:" << std::endl;
+        scene.click(10, 10);
+        scene.click(100, 10);
+        scene.get(ok).setVisible(false);
+        std::cout << "Click on hidden button handled: " << (scene.click(10, 10) ? "Yes" : "No") << std::endl;
+        if (scene.hitTest(10, 10) != nullptr || scene.hitTest(100, 50) != &scene.get(name)) {
+            throw std::runtime_error("hit-test returned the wrong component");
+        }
+
+        // 3. Headless benchmark
+        size_t count = argc > 1 ? std::stoul(argv[1]) : 100000;
+        const size_t columns = 400;
+        const size_t gridRows = std::max<size_t>(1, (count + columns - 1) / columns);  // At least one, even below a full row
+        std::cout << "\n3. Benchmark (" << count << " components, 1% changing per frame):" << std::endl;
+
+        AdvancedConcepts::RetainedScene big;
+        std::vector<std::unique_ptr<AdvancedConcepts::UIComponent>> immediate;
+        for (size_t i = 0; i < count; ++i) {
+            AdvancedConcepts::Rect area{static_cast<float>(i % columns) * 20.0f,
+                                        static_cast<float>(i / columns) * 12.0f, 18.0f, 10.0f};
+            big.add(makeComponent(i), area);
+            immediate.push_back(makeComponent(i));
+        }
+
+        NullBuffer nullBuffer;
+        std::streambuf* original = std::cout.rdbuf(&nullBuffer);
+        AdvancedConcepts::HeadlessBackend headless;
+        big.renderFrame(headless);  // Initial full frame
+        headless.reset();
+
+        const int frames = 20;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            for (const auto& component : immediate) {
+                if (component->isVisible()) component->render();
+            }
+        }
+        double immediateMs = elapsedMs(start) / frames;
+
+        AdvancedConcepts::ConsoleBackend nullConsole;
+        start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            for (size_t i = frame; i < count; i += 101) big.get(static_cast<uint32_t>(i)).markDirty();
+            big.renderFrame(nullConsole);
+        }
+        double retainedConsoleMs = elapsedMs(start) / frames;
+
+        start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            for (size_t i = frame; i < count; i += 101) big.get(static_cast<uint32_t>(i)).markDirty();
+            big.renderFrame(headless);
+        }
+        double retainedHeadlessMs = elapsedMs(start) / frames;
+
+        const int clicks = 1000;
+        start = std::chrono::steady_clock::now();
+        for (int c = 0; c < 10; ++c) {
+            for (const auto& component : immediate) component->handleClick();
+        }
+        double broadcastUs = elapsedMs(start) * 1000.0 / 10;
+
+        size_t handled = 0;
+        start = std::chrono::steady_clock::now();
+        for (int c = 0; c < clicks; ++c) {
+            float x = static_cast<float>((c * 37) % (columns * 20));
+            float y = static_cast<float>((c * 53) % (gridRows * 12));
+            handled += big.click(x, y);
+        }
+        double hitTestUs = elapsedMs(start) * 1000.0 / clicks;
+        std::cout.rdbuf(original);
+
+        std::cout << "Immediate mode frame:         " << immediateMs << " ms" << std::endl;
+        std::cout << "Retained frame (console):     " << retainedConsoleMs << " ms" << std::endl;
+        std::cout << "Retained frame (headless):    " << retainedHeadlessMs << " ms, "
+                  << headless.getDraws() / frames << " draws in "
+                  << headless.getBatches() / frames << " batches" << std::endl;
+        std::cout << "Broadcast click:              " << broadcastUs << " us" << std::endl;
+        std::cout << "Hit-tested click (incl. first R-tree build): " << hitTestUs << " us, "
+                  << handled << "/" << clicks << " landed on a component" << std::endl;
+
+        std::cout << "\n✅ Retained-mode UI test completed successfully!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_retained_ui.cpp -o test_retained_ui
+// Run: ./test_retained_ui [componentCount]
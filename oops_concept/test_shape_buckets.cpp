@@ -0,0 +1,256 @@
+#include "basic/shape_buckets.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Discards everything written to it; Shape constructors and destructors print
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<typename Manager>
+static std::string captureOutput(const Manager& manager) {
+    std::ostringstream captured;
+    std::streambuf* previous = std::cout.rdbuf(captured.rdbuf());
+    manager.drawAllShapes();
+    manager.displayAllInfo();
+    std::cout.rdbuf(previous);
+    return captured.str();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Type-Bucketed Shapes\n" << std::endl;
+
+    NullBuffer nullBuffer;
+    std::streambuf* console = std::cout.rdbuf();
+    try {
+        size_t largest = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+        size_t churnCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000000;
+        const size_t pointerLimit = 10000000;  // About 100 bytes per heap shape
+
+        // 1. Same output and totals as ShapeManager
+        std::cout << "1. Parity with ShapeManager:" << std::endl;
+        BasicConcepts::ShapeManager pointers;
+        BasicConcepts::BucketedShapeManager buckets;
+        std::cout.rdbuf(&nullBuffer);
+        pointers.addShape(std::make_unique<BasicConcepts::Circle>("red", 5.0));
+        pointers.addShape(std::make_unique<BasicConcepts::Circle>("blue", 1.5));
+        pointers.addShape(std::make_unique<BasicConcepts::Rectangle>("green", 4.0, 6.0));
+        pointers.addShape(std::make_unique<BasicConcepts::Triangle>("yellow", 3.0, 4.0, 5.0));
+        buckets.addShape(std::make_unique<BasicConcepts::Circle>("red", 5.0));
+        buckets.addCircle("blue", 1.5);
+        buckets.addRectangle("green", 4.0, 6.0);
+        buckets.addShape(std::make_unique<BasicConcepts::Triangle>("yellow", 3.0, 4.0, 5.0));
+        std::cout.rdbuf(console);
+        bool sameOutput = captureOutput(pointers) == captureOutput(buckets);
+        std::cout << "Same draw/display output: " << (sameOutput ? "Yes" : "No") << std::endl;
+        std::cout << "Total area: " << pointers.getTotalArea() << " vs " << buckets.getTotalArea() << std::endl;
+        if (!sameOutput || pointers.getTotalArea() != buckets.getTotalArea()) {
+            throw std::runtime_error("bucketed manager differs from ShapeManager");
+        }
+
+        // 2. Type queries
+        std::cout << "\n2. Type Queries:" << std::endl;
+        std::cout << "Circles: " << buckets.getShapeCountByType("Circle")
+                  << " (ShapeManager: " << pointers.getShapesByType("Circle").size() << ")" << std::endl;
+        std::cout.rdbuf(&nullBuffer);
+        auto rebuilt = buckets.toShape(BasicConcepts::ShapeKind::Triangle, 0);
+        std::cout.rdbuf(console);
+        std::cout << "Rebuilt triangle area: " << rebuilt->calculateArea() << std::endl;
+        if (buckets.circles().radius[1] != 1.5 || rebuilt->calculateArea() != 6.0) {
+            throw std::runtime_error("bucket access is wrong");
+        }
+        try {
+            buckets.getShapeCountByType("Hexagon");
+        } catch (const std::invalid_argument& e) {
+            std::cout << "Unknown type rejected: " << e.what() << std::endl;
+        }
+        std::cout.rdbuf(&nullBuffer);
+        rebuilt.reset();
+        std::cout.rdbuf(console);
+
+        // 3. Throughput
+        std::cout << "\n3. Total Area and Type Query:" << std::endl;
+        for (size_t n = 1000000; n <= largest; n *= 10) {
+            BasicConcepts::BucketedShapeManager bucketed;
+            for (auto kind : {BasicConcepts::ShapeKind::Circle, BasicConcepts::ShapeKind::Rectangle,
+                              BasicConcepts::ShapeKind::Triangle}) {
+                bucketed.reserve(kind, n / 3 + 1);
+            }
+            for (size_t i = 0; i < n; ++i) {
+                double size = 1.0 + static_cast<double>(i % 100);
+                if (i % 3 == 0) bucketed.addCircle("red", size);
+                else if (i % 3 == 1) bucketed.addRectangle("green", size, 2.0);
+                else bucketed.addTriangle("blue", size, size, size);
+            }
+            auto start = std::chrono::steady_clock::now();
+            double bucketArea = bucketed.getTotalArea();
+            double bucketAreaMs = elapsedMs(start);
+            start = std::chrono::steady_clock::now();
+            size_t circleCount = bucketed.getShapeCountByType("Circle");
+            double bucketQueryMs = elapsedMs(start);
+            std::cout << "  " << n << " shapes, buckets:  area " << bucketAreaMs << " ms, circles "
+                      << bucketQueryMs << " ms" << std::endl;
+
+            if (n > pointerLimit) {
+                std::cout << "  " << n << " shapes, pointers: skipped (too much memory)" << std::endl;
+                continue;
+            }
+            BasicConcepts::ShapeManager manager;
+            std::cout.rdbuf(&nullBuffer);
+            for (size_t i = 0; i < n; ++i) {
+                double size = 1.0 + static_cast<double>(i % 100);
+                if (i % 3 == 0) manager.addShape(std::make_unique<BasicConcepts::Circle>("red", size));
+                else if (i % 3 == 1) manager.addShape(std::make_unique<BasicConcepts::Rectangle>("green", size, 2.0));
+                else manager.addShape(std::make_unique<BasicConcepts::Triangle>("blue", size, size, size));
+            }
+            std::cout.rdbuf(console);
+            start = std::chrono::steady_clock::now();
+            double pointerArea = manager.getTotalArea();
+            double pointerAreaMs = elapsedMs(start);
+            start = std::chrono::steady_clock::now();
+            size_t pointerCircles = manager.getShapesByType("Circle").size();
+            double pointerQueryMs = elapsedMs(start);
+            std::cout << "  " << n << " shapes, pointers: area " << pointerAreaMs << " ms, circles "
+                      << pointerQueryMs << " ms" << std::endl;
+            if (pointerCircles != circleCount || std::abs(pointerArea - bucketArea) > 1e-9 * pointerArea) {
+                throw std::runtime_error("benchmark results differ");
+            }
+            std::cout.rdbuf(&nullBuffer);
+            manager = BasicConcepts::ShapeManager();
+            std::cout.rdbuf(console);
+        }
+
+        // 4. Tombstones and color bitmaps
+        std::cout << "\n4. Removal by Color:" << std::endl;
+        BasicConcepts::BucketedShapeManager palette;
+        palette.setCompactionThreshold(0.5);
+        for (int i = 0; i < 100; ++i) {
+            const char* color = i % 4 == 0 ? "red" : (i % 4 == 1 ? "green" : "blue");
+            palette.addCircle(color, 1.0 + i);
+            palette.addRectangle(color, 1.0, 1.0 + i);
+        }
+        double redArea = palette.getTotalAreaByColor("red");
+        size_t removed = palette.removeShapesByColor("red");
+        std::cout << "Removed " << removed << " red shapes, tombstones: " << palette.getTombstoneCount()
+                  << ", compactions: " << palette.getCompactionCount() << std::endl;
+        if (removed != 50 || palette.getShapeCount() != 150 || palette.getShapeCountByColor("red") != 0 ||
+            palette.getCompactionCount() != 0 || palette.circles().index.isLive(0) ||
+            redArea <= 0.0 || std::abs(palette.getTotalArea() - palette.getTotalAreaByColor("green") -
+                                       palette.getTotalAreaByColor("blue")) > 1e-9) {
+            throw std::runtime_error("tombstone removal is wrong");
+        }
+        palette.removeShapesByColor("blue");
+        std::cout << "After removing blue: " << palette.getShapeCount() << " shapes, tombstones: "
+                  << palette.getTombstoneCount() << ", compactions: " << palette.getCompactionCount() << std::endl;
+        if (palette.getShapeCount() != 50 || palette.getTombstoneCount() != 0 ||
+            palette.getShapeCountByColor("green") != 50 || palette.circles().rows() != 25) {
+            throw std::runtime_error("compaction is wrong");
+        }
+
+        // 5. Remove-and-reinsert churn: one of 8 colors out and back in per round
+        std::cout << "\n5. Churn, " << churnCount << " shapes, 8 colors:" << std::endl;
+        const std::vector<std::string> colors = {"red", "green", "blue", "cyan", "magenta", "yellow", "black", "white"};
+        const int rounds = 4;
+        BasicConcepts::BucketedShapeManager churn;
+        for (size_t i = 0; i < churnCount; ++i) churn.addCircle(colors[i % 8], 1.0 + static_cast<double>(i % 100));
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            const std::string& color = colors[round % 8];
+            size_t gone = churn.removeShapesByColor(color);
+            for (size_t i = 0; i < gone; ++i) churn.addCircle(color, 1.0 + static_cast<double>(i % 100));
+        }
+        double bucketChurnMs = elapsedMs(start) / rounds;
+        start = std::chrono::steady_clock::now();
+        double bucketFilter = churn.getTotalAreaByColor("white");
+        double bucketFilterMs = elapsedMs(start);
+        std::cout << "  buckets:  " << bucketChurnMs << " ms per round, area of one color " << bucketFilterMs
+                  << " ms (" << churn.getCompactionCount() << " compactions)" << std::endl;
+
+        if (churnCount <= pointerLimit) {
+            BasicConcepts::ShapeManager pointerChurn;
+            std::cout.rdbuf(&nullBuffer);
+            for (size_t i = 0; i < churnCount; ++i) {
+                pointerChurn.addShape(std::make_unique<BasicConcepts::Circle>(colors[i % 8], 1.0 + static_cast<double>(i % 100)));
+            }
+            start = std::chrono::steady_clock::now();
+            for (int round = 0; round < rounds; ++round) {
+                const std::string& color = colors[round % 8];
+                size_t before = pointerChurn.getShapeCount();
+                pointerChurn.removeShapesByColor(color);
+                size_t gone = before - pointerChurn.getShapeCount();
+                for (size_t i = 0; i < gone; ++i) {
+                    pointerChurn.addShape(std::make_unique<BasicConcepts::Circle>(color, 1.0 + static_cast<double>(i % 100)));
+                }
+            }
+            double pointerChurnMs = elapsedMs(start) / rounds;
+            std::cout.rdbuf(console);
+            // ShapeManager has no color filter; this is the loop callers write
+            start = std::chrono::steady_clock::now();
+            double pointerFilter = 0.0;
+            for (BasicConcepts::Shape* shape : pointerChurn.getShapesByType("Circle")) {
+                if (shape->getColor() == "white") pointerFilter += shape->calculateArea();
+            }
+            double pointerFilterMs = elapsedMs(start);
+            std::cout << "  pointers: " << pointerChurnMs << " ms per round, area of one color " << pointerFilterMs
+                      << " ms (constructor/destructor output discarded)" << std::endl;
+            if (pointerChurn.getShapeCount() != churn.getShapeCount() ||
+                std::abs(pointerFilter - bucketFilter) > 1e-9 * pointerFilter) {
+                throw std::runtime_error("churn results differ");
+            }
+            std::cout.rdbuf(&nullBuffer);
+        }
+        std::cout.rdbuf(console);
+
+        // 6. Many distinct colors: the color index must stay O(rows)
+        std::cout << "\n6. Distinct Colors:" << std::endl;
+        for (size_t distinct : {size_t(10000), size_t(80000)}) {
+            BasicConcepts::BucketedShapeManager rainbow;
+            for (size_t i = 0; i < distinct; ++i) rainbow.addCircle("c" + std::to_string(i), 1.0);
+            size_t indexBytes = rainbow.circles().index.memoryBytes();
+            std::cout << "  " << distinct << " colors: index " << indexBytes / 1024 << " KiB ("
+                      << indexBytes / distinct << " bytes per row)" << std::endl;
+            if (indexBytes > 256 * distinct) {
+                throw std::runtime_error("color index grows faster than the row count");
+            }
+            size_t last = distinct - 1;
+            std::string lastColor = "c" + std::to_string(last);
+            if (rainbow.getShapeCountByColor(lastColor) != 1 ||
+                std::abs(rainbow.getTotalAreaByColor(lastColor) - BasicConcepts::Circle::area(1.0)) > 1e-9) {
+                throw std::runtime_error("distinct color lookup is wrong");
+            }
+            // Remove every other color, enough to force a compaction
+            size_t gone = 0;
+            for (size_t i = 0; i < distinct; i += 2) gone += rainbow.removeShapesByColor("c" + std::to_string(i));
+            if (gone != distinct / 2 || rainbow.getShapeCount() != distinct - gone ||
+                rainbow.getCompactionCount() == 0 || rainbow.getShapeCountByColor("c0") != 0 ||
+                rainbow.getShapeCountByColor(lastColor) != 1 ||
+                std::abs(rainbow.getTotalAreaByColor(lastColor) - BasicConcepts::Circle::area(1.0)) > 1e-9) {
+                throw std::runtime_error("distinct color removal is wrong");
+            }
+        }
+
+        std::cout.rdbuf(&nullBuffer);
+    } catch (const std::exception& e) {
+        std::cout.rdbuf(console);
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    std::cout.rdbuf(console);
+    std::cout << "\n✅ Type-bucketed shape test completed successfully!" << std::endl;
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_shape_buckets.cpp -o test_shape_buckets
+// Run: ./test_shape_buckets [largest_shape_count] [churn_shape_count]
@@ -0,0 +1,154 @@
+#include "basic/encapsulation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The previous representation, for comparison
+static bool hasAllStrings(const std::vector<std::string>& have, const std::vector<std::string>& need) {
+    for (const auto& skill : need) {
+        if (std::find(have.begin(), have.end(), skill) == have.end()) return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Interned Skill Sets\n" << std::endl;
+
+    try {
+        size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+        using BasicConcepts::SkillSet;
+        using BasicConcepts::SkillRegistry;
+
+        // 1. Employee skills through the registry
+        std::cout << "1. Employee Skills:" << std::endl;
+        SkillRegistry::instance().intern("Compilers");   // Interned before COBOL, added after it
+        BasicConcepts::Employee emp("Grace", "Hopper", "Engineering", 90000.0, 10);
+        emp.addSkill("COBOL");
+        emp.addSkill("Compilers");
+        emp.addSkill("COBOL");
+        std::cout << "Skills:";
+        for (const auto& skill : emp.getSkills()) {
+            std::cout << " " << skill;
+        }
+        std::cout << std::endl;
+        std::vector<std::string> listed = emp.getSkills();   // Old vector-returning usage still compiles
+        if (emp.getSkills().size() != 2 || !emp.hasSkill("Compilers") || emp.hasSkill("Java") ||
+            listed != std::vector<std::string>{"COBOL", "Compilers"}) {
+            throw std::runtime_error("skill set contents or insertion order are wrong");
+        }
+
+        // 2. Set operations
+        std::cout << "\n2. Set Operations:" << std::endl;
+        SkillSet a{"C++", "SQL", "Go"};
+        SkillSet b{"SQL", "Go", "Rust", "Python"};
+        SkillSet need{"SQL", "Go"};
+        std::cout << "a has all of {SQL, Go}: " << (a.hasAll(need) ? "Yes" : "No") << std::endl;
+        std::cout << "a has any of b: " << (a.hasAny(b) ? "Yes" : "No") << std::endl;
+        std::cout << "Jaccard(a, b): " << a.jaccard(b) << std::endl;
+        if (!a.hasAll(need) || b.hasAll(a) || a.jaccard(b) != 2.0 / 5.0 || SkillSet().jaccard(SkillSet()) != 1.0) {
+            throw std::runtime_error("set operation results are wrong");
+        }
+
+        // 3. Interning from several threads while others read names
+        std::cout << "\n3. Concurrent Interning:" << std::endl;
+        const int writers = 4, perWriter = 2000;
+        std::atomic<bool> done{false};
+        std::atomic<size_t> mismatches{0};
+        SkillSet held{"C++", "SQL", "Go"};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < writers; ++t) {
+            threads.emplace_back([t, &mismatches] {
+                // Writers overlap on half their names, so lookups race with inserts
+                for (int i = 0; i < perWriter; ++i) {
+                    std::string skill = "shared-" + std::to_string((t % 2) * perWriter / 2 + i);
+                    SkillRegistry& registry = SkillRegistry::instance();
+                    if (registry.name(registry.intern(skill)) != skill) ++mismatches;
+                }
+            });
+        }
+        threads.emplace_back([&] {
+            while (!done.load()) {
+                size_t seen = 0;
+                for (const std::string& skill : held.view()) seen += skill.empty() ? 0 : 1;
+                if (seen != 3) ++mismatches;
+            }
+        });
+        for (int t = 0; t < writers; ++t) threads[t].join();
+        done = true;
+        threads.back().join();
+        size_t distinct = 0;
+        for (int i = 0; i < perWriter * 3 / 2; ++i) {
+            distinct += SkillRegistry::instance().find("shared-" + std::to_string(i)) >= 0 ? 1 : 0;
+        }
+        std::cout << "Distinct skills interned by " << writers << " threads: " << distinct
+                  << ", bad reads: " << mismatches.load() << std::endl;
+        if (distinct != static_cast<size_t>(perWriter * 3 / 2) || mismatches.load() != 0) {
+            throw std::runtime_error("concurrent interning lost or corrupted skills");
+        }
+
+        // 4. Benchmark
+        std::cout << "\n4. Skill queries over " << count << " employees:" << std::endl;
+        std::vector<std::string> vocabulary;
+        for (int i = 0; i < 200; ++i) vocabulary.push_back("skill-" + std::to_string(i));
+
+        std::mt19937 rng(11);
+        std::vector<SkillSet> sets(count);
+        std::vector<std::vector<std::string>> strings(count);
+        for (size_t i = 0; i < count; ++i) {
+            size_t n = 3 + rng() % 4;
+            for (size_t k = 0; k < n; ++k) {
+                // Skew towards common skills, like real skill distributions
+                const std::string& skill = vocabulary[(rng() % 20) * (rng() % 10)];
+                if (sets[i].insert(skill)) strings[i].push_back(skill);
+            }
+        }
+
+        SkillSet query{"skill-0", "skill-3"};
+        std::vector<std::string> queryStrings{"skill-0", "skill-3"};
+        const SkillSet& reference = sets[0];
+
+        auto start = std::chrono::steady_clock::now();
+        size_t matchStrings = 0;
+        for (const auto& s : strings) matchStrings += hasAllStrings(s, queryStrings);
+        double stringMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        size_t matchAll = 0, matchAny = 0;
+        double similarity = 0;
+        for (const auto& s : sets) matchAll += s.hasAll(query);
+        double allMs = elapsedMs(start);
+        start = std::chrono::steady_clock::now();
+        for (const auto& s : sets) matchAny += s.hasAny(query);
+        double anyMs = elapsedMs(start);
+        start = std::chrono::steady_clock::now();
+        for (const auto& s : sets) similarity += s.jaccard(reference);
+        double jaccardMs = elapsedMs(start);
+
+        std::cout << "  has-all (vector<string>): " << stringMs << " ms" << std::endl;
+        std::cout << "  has-all (bitset):         " << allMs << " ms (" << matchAll << " matches)" << std::endl;
+        std::cout << "  has-any (bitset):         " << anyMs << " ms (" << matchAny << " matches)" << std::endl;
+        std::cout << "  jaccard (bitset):         " << jaccardMs << " ms (mean " << similarity / count << ")" << std::endl;
+        if (matchAll != matchStrings) {
+            throw std::runtime_error("bitset and string has-all disagree");
+        }
+
+        std::cout << "\n✅ Skill set test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_skill_set.cpp -o test_skill_set
+// Run: ./test_skill_set [employees]
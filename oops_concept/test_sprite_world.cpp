@@ -0,0 +1,226 @@
+#include "basic/sprite_world.hpp"
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <set>
+#include <streambuf>
+#include <vector>
+
+// Discards everything written to it; GameSprite::move prints
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Sprite World\n" << std::endl;
+
+    NullBuffer nullBuffer;
+    std::streambuf* console = std::cout.rdbuf();
+    try {
+        size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+        const double worldSize = 10000.0, dt = 1.0 / 60.0;
+
+        // 1. Import, movement and export
+        std::cout << "1. Basic Movement:" << std::endl;
+        BasicConcepts::SpriteWorld small(10.0);
+        BasicConcepts::GameSprite hero("Hero", 0, 0, "hero.png");
+        uint32_t heroId = small.add(hero, 60.0, 0.0);
+        uint32_t enemyId = small.add("Enemy", 12, 0.5, "enemy.png");
+        small.add("Tree", 100, 100, "tree.png");
+        for (int tick = 0; tick < 10; ++tick) small.integrate(dt);
+        small.move(enemyId, -1.0, 0.0);
+        BasicConcepts::GameSprite exported = small.toSprite(heroId);
+        std::cout << exported.getDescription() << " at (" << exported.getPosition().first << ", "
+                  << exported.getPosition().second << ") with " << exported.getTexture() << std::endl;
+        auto collisions = small.findCollisions(2.0);
+        std::cout << "Collisions within 2.0: " << collisions.size() << std::endl;
+        if (std::abs(exported.getPosition().first - 10.0) > 1e-9 || collisions.size() != 1 ||
+            collisions[0] != std::make_pair(heroId, enemyId)) {
+            throw std::runtime_error("movement or collision results are wrong");
+        }
+        size_t badDistances = 0;
+        for (double distance : {50.0, -1.0, std::nan("")}) {
+            try {
+                small.findCollisions(distance);
+            } catch (const std::invalid_argument& e) {
+                if (++badDistances == 1) std::cout << "Bad distance rejected: " << e.what() << std::endl;
+            }
+        }
+        // Hero and Enemy share a cell, the Tree has one; the cell the Hero left is gone
+        std::cout << "Occupied cells: " << small.cellCount() << std::endl;
+        if (badDistances != 3 || small.cellCount() != 2) {
+            throw std::runtime_error("bad collision distances or empty cells were kept");
+        }
+
+        // Extreme coordinates share the edge cells; non-finite input is rejected
+        BasicConcepts::SpriteWorld edges(1.0);
+        uint32_t farId = edges.add("Far", 1e300, -1e300, "far.png");
+        uint32_t nearId = edges.add("Near", 0.5, 0.5, "near.png", 1.0, 0.0);
+        size_t rejected = 0;
+        for (auto attempt : std::vector<std::function<void()>>{
+                 [&] { edges.setVelocity(nearId, std::nan(""), 0.0); },
+                 [&] { edges.setVelocity(nearId, 0.0, INFINITY); },
+                 [&] { edges.move(nearId, INFINITY, 0.0); },
+                 [&] { edges.move(farId, std::numeric_limits<double>::max(), 0.0); },
+                 [&] { edges.integrate(std::nan("")); },
+                 [&] { edges.queryRadius(0.0, 0.0, INFINITY); }}) {
+            try {
+                attempt();
+            } catch (const std::invalid_argument&) {
+                ++rejected;
+            }
+        }
+        edges.setVelocity(farId, 1e300, 0.0);
+        try {
+            edges.integrate(1e10);
+        } catch (const std::overflow_error&) {
+            ++rejected;
+        }
+        edges.integrate(1.0);
+        size_t everything = edges.queryRadius(0.0, 0.0, 1e301).size();
+        std::cout << "Non-finite inputs rejected: " << rejected << " of 7, sprites found by a huge query: "
+                  << everything << std::endl;
+        if (rejected != 7 || everything != 2 || edges.getX(nearId) != 1.5 || edges.getX(farId) != 2e300 ||
+            edges.queryRadius(1.5, 0.5, 0.1).size() != 1) {
+            throw std::runtime_error("extreme coordinates are handled wrongly");
+        }
+
+        // 2. Grid queries match brute force after many ticks
+        std::cout << "\n2. Queries vs Brute Force:" << std::endl;
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<double> position(0.0, worldSize), speed(-100.0, 100.0);
+        BasicConcepts::SpriteWorld world(32.0);
+        world.reserve(count);
+        std::vector<std::unique_ptr<BasicConcepts::GameSprite>> sprites;
+        std::vector<std::pair<double, double>> velocities;
+        sprites.reserve(count);
+        velocities.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            double x = position(rng), y = position(rng), vx = speed(rng), vy = speed(rng);
+            sprites.push_back(std::make_unique<BasicConcepts::GameSprite>("S", x, y, "sprite.png"));
+            velocities.emplace_back(vx, vy);
+            world.add(*sprites.back(), vx, vy);
+        }
+        size_t crossed = 0;
+        for (int tick = 0; tick < 5; ++tick) crossed += world.integrate(dt);
+        std::cout.rdbuf(&nullBuffer);
+        for (int tick = 0; tick < 5; ++tick) {
+            for (size_t i = 0; i < count; ++i) {
+                BasicConcepts::Movable& movable = *sprites[i];
+                movable.move(velocities[i].first * dt, velocities[i].second * dt);
+            }
+        }
+        std::cout.rdbuf(console);
+        std::cout << "Sprites that changed cell over 5 ticks: " << crossed << " of " << 5 * count << std::endl;
+        std::set<std::pair<int64_t, int64_t>> occupied;
+        for (uint32_t i = 0; i < count; ++i) {
+            occupied.insert({static_cast<int64_t>(std::floor(world.getX(i) / 32.0)),
+                             static_cast<int64_t>(std::floor(world.getY(i) / 32.0))});
+        }
+        if (world.cellCount() != occupied.size()) {
+            throw std::runtime_error("grid keeps cells with no sprites");
+        }
+
+        for (int q = 0; q < 20; ++q) {
+            double cx = position(rng), cy = position(rng), radius = 50.0;
+            std::vector<uint32_t> found = world.queryRadius(cx, cy, radius);
+            std::set<uint32_t> grid(found.begin(), found.end()), brute;
+            for (uint32_t i = 0; i < count; ++i) {
+                auto p = sprites[i]->getPosition();
+                double dx = p.first - cx, dy = p.second - cy;
+                // The two paths round differently; ignore sprites sitting on the boundary
+                if (std::abs(dx * dx + dy * dy - radius * radius) < 1e-6) grid.erase(i);
+                else if (dx * dx + dy * dy <= radius * radius) brute.insert(i);
+            }
+            if (grid != brute) {
+                throw std::runtime_error("grid query disagrees with brute force");
+            }
+        }
+        std::cout << "20 radius queries agree with brute force" << std::endl;
+
+        BasicConcepts::SpriteWorld crowd(8.0);
+        std::uniform_real_distribution<double> near(0.0, 200.0);
+        for (int i = 0; i < 3000; ++i) crowd.add("C", near(rng), near(rng), "crowd.png");
+        std::set<std::pair<uint32_t, uint32_t>> gridPairs, brutePairs;
+        for (const auto& pair : crowd.findCollisions(3.0)) gridPairs.insert(pair);
+        for (uint32_t a = 0; a < crowd.size(); ++a) {
+            for (uint32_t b = a + 1; b < crowd.size(); ++b) {
+                double dx = crowd.getX(b) - crowd.getX(a), dy = crowd.getY(b) - crowd.getY(a);
+                if (dx * dx + dy * dy < 9.0) brutePairs.insert({a, b});
+            }
+        }
+        std::cout << "Collision pairs in a crowd of 3000: " << gridPairs.size() << std::endl;
+        if (gridPairs != brutePairs) {
+            throw std::runtime_error("collision pairs disagree with brute force");
+        }
+
+        // 3. Throughput and latency
+        std::cout << "\n3. " << count << " sprites:" << std::endl;
+        const int ticks = 10;
+        std::cout.rdbuf(&nullBuffer);
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < ticks; ++tick) {
+            for (size_t i = 0; i < count; ++i) {
+                BasicConcepts::Movable& movable = *sprites[i];
+                movable.move(velocities[i].first * dt, velocities[i].second * dt);
+            }
+        }
+        double objectSeconds = elapsedSeconds(start);
+        std::cout.rdbuf(console);
+
+        start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < ticks; ++tick) world.integrate(dt);
+        double worldSeconds = elapsedSeconds(start);
+        std::cout << "  GameSprite::move per sprite:  " << ticks / objectSeconds << " ticks/s (console output discarded)" << std::endl;
+        std::cout << "  SpriteWorld::integrate:       " << ticks / worldSeconds << " ticks/s (grid kept up to date)" << std::endl;
+
+        const int queries = 1000;
+        std::vector<std::pair<double, double>> centres;
+        for (int q = 0; q < queries; ++q) centres.emplace_back(position(rng), position(rng));
+        size_t hits = 0;
+        start = std::chrono::steady_clock::now();
+        for (const auto& c : centres) hits += world.queryRadius(c.first, c.second, 50.0).size();
+        double gridQuerySeconds = elapsedSeconds(start);
+        start = std::chrono::steady_clock::now();
+        size_t bruteHits = 0;
+        for (int q = 0; q < 10; ++q) {
+            for (const auto& sprite : sprites) {
+                auto p = sprite->getPosition();
+                double dx = p.first - centres[q].first, dy = p.second - centres[q].second;
+                bruteHits += dx * dx + dy * dy <= 2500.0;
+            }
+        }
+        double bruteQuerySeconds = elapsedSeconds(start);
+        std::cout << "  radius-50 query, grid:        " << gridQuerySeconds / queries * 1e6 << " us ("
+                  << static_cast<double>(hits) / queries << " hits avg)" << std::endl;
+        std::cout << "  radius-50 query, brute force: " << bruteQuerySeconds / 10 * 1e6 << " us" << std::endl;
+
+        start = std::chrono::steady_clock::now();
+        size_t pairs = world.findCollisions(1.0).size();
+        std::cout << "  all collisions within 1.0:    " << pairs << " pairs in " << elapsedSeconds(start) * 1000
+                  << " ms" << std::endl;
+        (void)bruteHits;
+
+        std::cout << "\n✅ Sprite world test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout.rdbuf(console);
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_sprite_world.cpp -o test_sprite_world
+// Run: ./test_sprite_world [sprites]
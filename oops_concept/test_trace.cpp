@@ -0,0 +1,180 @@
+#include "basic/encapsulation.hpp"
+#include "design_patterns/observer.hpp"
+#include "design_patterns/strategy.hpp"
+#include "other_concepts/exception_handling.hpp"
+#include "other_concepts/move_semantics.hpp"
+#include "other_concepts/trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Build twice: as is, and with -DOOPS_TRACE_LEVEL=0 for the "compiled out" numbers
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Workload {
+    const char* name;
+    std::function<void(size_t)> run;
+};
+
+static size_t countLines(const std::string& text) {
+    return static_cast<size_t>(std::count(text.begin(), text.end(), '\n'));
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING OTHER CONCEPTS - Trace Sink\n" << std::endl;
+
+    // Declared outside the try block: the sink may still point at them in the catch
+    std::ostringstream setupLog, unbufferedText, bufferedText, threadText;
+    std::ofstream devNull("/dev/null");
+    try {
+        size_t ops = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+        Trace::Sink& sink = Trace::Sink::instance();
+        const bool compiledOut = !Trace::isEnabled(Trace::Level::Error, Trace::Category::Account);
+        sink.setOutput(setupLog);
+
+        BasicConcepts::BankAccount account("John Doe", "1234567890", "1234", 1000.0);
+        BasicConcepts::BankAccount::Session session = account.login("1234");
+        SafeBankAccount safe("SAFE-001", 1000.0);
+        NewsAgency agency;
+        EmailNotifier email("news@example.com");
+        SMSNotifier sms("+1-555-0100");
+        NewsChannel channel("CNN");
+        agency.attach(&email);
+        agency.attach(&sms);
+        agency.attach(&channel);
+        QuickSort<int> quickSort;
+        std::vector<int> unsorted = {9, 3, 7, 1, 8, 2, 6, 4, 5, 0, 15, 11, 13, 12, 10, 14};
+
+        const std::vector<Workload> workloads = {
+            {"BankAccount deposit+withdraw", [&](size_t n) {
+                for (size_t i = 0; i < n; ++i) {
+                    account.deposit(10.0, session);
+                    account.withdraw(10.0, session);
+                }
+            }},
+            {"SafeBankAccount deposit     ", [&](size_t n) {
+                for (size_t i = 0; i < n; ++i) safe.deposit(1.0);
+            }},
+            {"Subject notify, 3 observers ", [&](size_t n) {
+                for (size_t i = 0; i < n; ++i) agency.publishNews("Markets open");
+            }},
+            {"MyString copy + move        ", [&](size_t n) {
+                for (size_t i = 0; i < n; ++i) {
+                    MyString original("payload");
+                    MyString copy = original;
+                    MyString moved = std::move(copy);
+                }
+            }},
+            {"QuickSort of 16 ints        ", [&](size_t n) {
+                for (size_t i = 0; i < n; ++i) {
+                    std::vector<int> data = unsorted;
+                    quickSort.sort(data);
+                }
+            }},
+        };
+
+        // 1. Buffered and unbuffered sinks produce the same lines
+        std::cout << "1. Same Output in Both Modes:" << std::endl;
+        auto script = [] {
+            BasicConcepts::BankAccount fresh("Jane Roe", "9876543210", "4321", 50.0);
+            fresh.deposit(25.0, fresh.login("4321"));
+            fresh.withdraw(500.0, "4321");
+            SafeBankAccount freshSafe("SAFE-002", 5.0);
+            freshSafe.deposit(2.5);
+            NewsAgency freshAgency;
+            PushNotifier push("device-7");
+            freshAgency.attach(&push);
+            freshAgency.publishNews("Rates unchanged");
+            MyString text("trace");
+            MyString copy = text;
+            std::vector<int> data = {3, 1, 2};
+            QuickSort<int>().sort(data);
+        };
+        sink.setMode(Trace::Mode::Unbuffered);
+        sink.setOutput(unbufferedText);
+        script();
+        sink.setMode(Trace::Mode::Buffered);
+        sink.setOutput(bufferedText);
+        script();
+        sink.flush();
+        std::cout << "Lines per mode: " << countLines(unbufferedText.str()) << std::endl;
+        if (unbufferedText.str() != bufferedText.str()) {
+            throw std::runtime_error("buffered output differs from unbuffered output");
+        }
+        if (compiledOut != unbufferedText.str().empty() || compiledOut != setupLog.str().empty()) {
+            throw std::runtime_error("compile-time level not respected");
+        }
+        std::cout << (compiledOut ? "Tracing compiled out: nothing written" : "Tracing compiled in") << std::endl;
+
+        // 2. Threads never interleave within a line
+        std::cout << "\n2. Buffered Sink with 4 Threads:" << std::endl;
+        sink.setOutput(threadText);
+        sink.setBufferCapacity(4096);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([] {
+                SafeBankAccount own("THREAD", 0.0);
+                for (int i = 0; i < 1000; ++i) own.deposit(1.0);
+            });
+        }
+        for (std::thread& thread : threads) thread.join();
+        sink.setBufferCapacity(64 * 1024);
+        std::istringstream lines(threadText.str());
+        size_t lineCount = 0;
+        for (std::string line; std::getline(lines, line); ++lineCount) {
+            bool whole = line.rfind("🏦 Safe account created: THREAD", 0) == 0 ||
+                         line.rfind("📝 Transaction logged: Deposit: +$1.0", 0) == 0 ||
+                         line.rfind("✅ Deposited $1. New balance: $", 0) == 0;
+            if (!whole) {
+                throw std::runtime_error("interleaved trace line: " + line);
+            }
+        }
+        std::cout << "Lines from 4 threads: " << lineCount << ", all intact" << std::endl;
+        if (lineCount != (compiledOut ? 0u : 4u * 2001)) {
+            throw std::runtime_error("lines were lost");
+        }
+
+        // 3. Throughput, traces written to /dev/null
+        std::cout << "\n3. " << ops << " operations per workload:" << std::endl;
+        sink.setOutput(devNull);
+        std::vector<Trace::Mode> modes = {Trace::Mode::Unbuffered, Trace::Mode::Buffered};
+        if (compiledOut) modes.resize(1);
+        for (const Workload& workload : workloads) {
+            for (Trace::Mode mode : modes) {
+                sink.setMode(mode);
+                auto start = std::chrono::steady_clock::now();
+                workload.run(ops);
+                sink.flush();
+                double ms = elapsedMs(start);
+                const char* label = compiledOut ? "compiled out" : (mode == Trace::Mode::Buffered ? "buffered    " : "unbuffered  ");
+                std::cout << "  " << workload.name << " " << label << ": " << ms << " ms ("
+                          << ms * 1e6 / static_cast<double>(ops) << " ns/op)" << std::endl;
+            }
+        }
+        sink.setMode(Trace::Mode::Unbuffered);
+        sink.setOutput(std::cout);
+        std::cout << "Final balances: $" << account.getBalance(session) << ", $" << safe.getBalance() << std::endl;
+
+        std::cout << "\n✅ Trace sink test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        Trace::Sink::instance().setMode(Trace::Mode::Unbuffered);
+        Trace::Sink::instance().setOutput(std::cout);
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 -pthread test_trace.cpp -o test_trace
+//          g++ -std=c++17 -O2 -pthread -DOOPS_TRACE_LEVEL=0 test_trace.cpp -o test_trace_off
+// Run: ./test_trace [operations] && ./test_trace_off [operations]
@@ -0,0 +1,148 @@
+#include "basic/vehicle_inventory.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Discards everything written to it; Vehicle constructors and destructors print
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "🧪 TESTING BASIC OOP CONCEPTS - Columnar Vehicle Inventory\n" << std::endl;
+
+    NullBuffer nullBuffer;
+    std::streambuf* console = std::cout.rdbuf();
+    try {
+        size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+        using BasicConcepts::VehicleFilter;
+
+        // 1. Round trip through the class hierarchy
+        std::cout << "1. Import / Export:" << std::endl;
+        BasicConcepts::VehicleInventory inventory;
+        {
+            std::cout.rdbuf(&nullBuffer);
+            BasicConcepts::Car car("Toyota", "Camry", 2022, 28000.0, 4, "Hybrid", 2.5);
+            BasicConcepts::Motorcycle bike("Harley", "Street 750", 2021, 7500.0, false, "Cruiser");
+            BasicConcepts::SportsCar sports("Porsche", "911", 2023, 120000.0, 2, "Gasoline", 3.0, 190, 3.5, true);
+            inventory.add(car);
+            inventory.add(bike);
+            inventory.add(sports);
+        }
+        auto exported = inventory.toVehicles();
+        std::cout.rdbuf(console);
+        auto* porsche = dynamic_cast<BasicConcepts::SportsCar*>(exported[2].get());
+        auto* harley = dynamic_cast<BasicConcepts::Motorcycle*>(exported[1].get());
+        if (!porsche || !harley || !porsche->getHasTurbo() || porsche->getPrice() != 120000.0 ||
+            harley->getYear() != 2021) {
+            throw std::runtime_error("round trip lost fields");
+        }
+        std::cout << "Exported: " << exported[0]->getBrand() << " " << exported[0]->getModel() << ", "
+                  << harley->getBrand() << " " << harley->getMotorcycleType() << ", "
+                  << porsche->getModel() << " (" << porsche->getMaxSpeed() << " mph)" << std::endl;
+
+        // 2. Filters and aggregates
+        std::cout << "\n2. Queries:" << std::endl;
+        VehicleFilter recent;
+        recent.minYear = 2022;
+        std::cout << "Vehicles from 2022 on: " << inventory.count(recent) << std::endl;
+        VehicleFilter cheap;
+        cheap.maxPrice = 30000;
+        std::cout << "Average price under $30k: $" << inventory.averagePrice(cheap) << std::endl;
+        if (inventory.count(recent) != 2 || inventory.averagePrice(cheap) != (28000.0 + 7500.0) / 2) {
+            throw std::runtime_error("small query results are wrong");
+        }
+
+        // 3. Benchmark against std::vector<std::unique_ptr<Vehicle>>
+        std::cout << "\n3. " << count << " vehicles:" << std::endl;
+        const std::vector<std::string> brands = {"Toyota", "Honda", "Ford", "BMW", "Audi", "Tesla",
+                                                 "Kia", "Mazda", "Volvo", "Subaru", "Harley", "Ducati"};
+        std::mt19937 rng(3);
+        std::vector<std::unique_ptr<BasicConcepts::Vehicle>> objects;
+        objects.reserve(count);
+        BasicConcepts::VehicleInventory columns;
+        columns.reserve(count);
+        std::cout.rdbuf(&nullBuffer);
+        for (size_t i = 0; i < count; ++i) {
+            const std::string& brand = brands[rng() % brands.size()];
+            int year = 2000 + static_cast<int>(rng() % 25);
+            double price = 5000 + static_cast<double>(rng() % 9500000) / 100.0;
+            if (i % 3 == 2) {
+                objects.push_back(std::make_unique<BasicConcepts::Motorcycle>(brand, "M", year, price, false, "Sport"));
+            } else {
+                objects.push_back(std::make_unique<BasicConcepts::Car>(brand, "C", year, price, 4, "Gasoline", 2.0));
+            }
+            columns.add(*objects.back());
+        }
+        std::cout.rdbuf(console);
+
+        VehicleFilter query;
+        query.brand = "Toyota";
+        query.minYear = 2015;
+        query.maxYear = 2020;
+        query.minPrice = 20000;
+        query.maxPrice = 40000;
+
+        auto start = std::chrono::steady_clock::now();
+        size_t objectMatches = 0;
+        for (const auto& v : objects) {
+            objectMatches += v->getBrand() == query.brand && v->getYear() >= query.minYear &&
+                             v->getYear() <= query.maxYear && v->getPrice() >= query.minPrice &&
+                             v->getPrice() <= query.maxPrice;
+        }
+        double objectFilterMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        size_t columnMatches = columns.count(query);
+        double columnFilterMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::map<std::string, std::pair<double, size_t>> objectTotals;
+        for (const auto& v : objects) {
+            auto& entry = objectTotals[v->getBrand()];
+            entry.first += v->getPrice();
+            ++entry.second;
+        }
+        double objectGroupMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::map<std::string, double> averages = columns.averagePriceByBrand();
+        double columnGroupMs = elapsedMs(start);
+
+        std::cout << "  filter (brand, year, price): objects " << objectFilterMs << " ms, columns "
+                  << columnFilterMs << " ms (" << columnMatches << " matches)" << std::endl;
+        std::cout << "  avg price by brand:          objects " << objectGroupMs << " ms, columns "
+                  << columnGroupMs << " ms" << std::endl;
+        std::cout << "  Toyota average: $" << averages["Toyota"] << std::endl;
+        double toyotaObjects = objectTotals["Toyota"].first / objectTotals["Toyota"].second;
+        if (columnMatches != objectMatches || std::abs(averages["Toyota"] - toyotaObjects) > 0.01) {
+            throw std::runtime_error("columnar and object queries disagree");
+        }
+
+        std::cout.rdbuf(&nullBuffer);
+        objects.clear();
+        exported.clear();
+        std::cout.rdbuf(console);
+        std::cout << "\n✅ Vehicle inventory test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cout.rdbuf(console);
+        std::cout << "❌ Exception occurred: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Compile: g++ -std=c++17 -O2 test_vehicle_inventory.cpp -o test_vehicle_inventory
+// Run: ./test_vehicle_inventory [vehicles]